@@ -0,0 +1,211 @@
+import argparse
+import json
+import os
+import re
+import resource
+import shutil
+import subprocess
+import time
+
+import mklib
+
+# End-to-end benchmark of relm3u on a fabricated library (see mklib.py).
+#
+# Each phase runs relm3u on the corpus as made (playlists are restored and the
+# files relm3u writes removed before each run) and reports wall and CPU time,
+# playlist entries per second and, where strace is installed, the system calls
+# made. Spawns (processes and threads) are counted with strace, or else from
+# the fork counter of the system (/proc/stat), so keep the box quiet meanwhile.
+#
+# Results are stored as JSON; with --baseline a phase slower than the
+# baseline by more than --tolerance percent (and by 50 ms at least, below that
+# it is noise) fails the run (exit code 1).
+
+PHASES = [
+    # name, arguments, prepare: None or a phase run once before (not measured)
+    ("test", [], None),
+    ("test -j", ["-j", "{jobs}"], None),
+    ("serious", ["s"], None),
+    ("serious -j", ["s", "-j", "{jobs}"], None),
+    ("rerun converted", [], ["s"]),
+    ("incremental unchanged", ["s", "--incremental"], ["s", "--incremental"]),
+    ]
+
+def forks_so_far():
+    try:
+        with open("/proc/stat") as f:
+            for line in f:
+                if(line.startswith("processes ")):
+                    return int(line.split()[1])
+    except OSError:
+        pass
+    return None
+
+def parse_strace_summary(path):
+    # strace -c table: % time, seconds, usecs/call, calls, errors, syscall
+    syscalls = 0
+    spawns = 0
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if(len(fields) < 5 or not fields[3].isdigit()):
+                continue
+            if(fields[-1] == "total"):
+                syscalls = int(fields[3])
+            elif(fields[-1] in ("fork", "vfork", "clone", "clone3")):
+                spawns += int(fields[3])
+    return syscalls, spawns
+
+def run_relm3u(relm3u, cwd, args, strace_log=None):
+    cmd = [relm3u, "Music/"] + args
+    if(strace_log):
+        cmd = ["strace", "-f", "-c", "-o", strace_log] + cmd
+    before = resource.getrusage(resource.RUSAGE_CHILDREN)
+    forks = forks_so_far()
+    start = time.perf_counter()
+    proc = subprocess.run(cmd, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True, errors="replace")
+    wall = time.perf_counter() - start
+    after = resource.getrusage(resource.RUSAGE_CHILDREN)
+    forks_after = forks_so_far()
+    found = total = 0
+    for m in re.finditer(r"^FOUND: (\d+) / (\d+)$", proc.stdout, re.M):
+        found += int(m.group(1))
+        total += int(m.group(2))
+    return {
+        "wall": wall,
+        "user": after.ru_utime - before.ru_utime,
+        "sys": after.ru_stime - before.ru_stime,
+        "forks": None if forks is None else forks_after - forks - 1,  # minus relm3u itself
+        "found": found,
+        "entries": total,
+        "status": proc.returncode,
+        }
+
+def reset_corpus(corpus, originals, manifest):
+    # library files are never touched, only playlists, back-ups and the
+    # index and state files of relm3u need to be put back
+    for dirpath, dirnames, filenames in os.walk(os.path.join(corpus, "Music")):
+        for name in filenames:
+            if(name.endswith(".bak") or name.startswith(".relm3u.")):
+                os.remove(os.path.join(dirpath, name))
+    for path in manifest["playlists"]:
+        shutil.copyfile(os.path.join(originals, path), os.path.join(corpus, path))
+
+def run_phase(relm3u, corpus, originals, manifest, workdir, args, prepare, repeat, use_strace):
+    best = None
+    for r in range(repeat):
+        reset_corpus(corpus, originals, manifest)
+        if(prepare is not None):
+            run_relm3u(relm3u, corpus, prepare)
+        res = run_relm3u(relm3u, corpus, args)
+        if(best is None or res["wall"] < best["wall"]):
+            best = res
+    best["syscalls"] = None
+    if(use_strace):
+        # counted on a run of its own, strace slows it down a lot
+        reset_corpus(corpus, originals, manifest)
+        if(prepare is not None):
+            run_relm3u(relm3u, corpus, prepare)
+        log = os.path.join(workdir, "strace.txt")
+        run_relm3u(relm3u, corpus, args, log)
+        best["syscalls"], best["forks"] = parse_strace_summary(log)
+    reset_corpus(corpus, originals, manifest)
+    best["lines_per_sec"] = best["entries"] / best["wall"] if best["wall"] > 0 and best["entries"] > 0 else None
+    return best
+
+def corpus_for(workdir, args):
+    # reuse the corpus of an earlier run when it was made the same way,
+    # return its folder, the folder of the original playlists and its manifest
+    corpus = os.path.join(workdir, "corpus")
+    originals = os.path.join(workdir, "originals")
+    wanted = {"artists": args.artists, "albums": args.albums, "tracks": args.tracks, "depth": args.depth,
+              "playlists": args.playlists, "entries": args.entries,
+              "ratios": mklib.parse_ratios(args.ratios), "seed": args.seed}
+    try:
+        with open(os.path.join(corpus, "manifest.json")) as f:
+            manifest = json.load(f)
+        if(manifest["params"] == wanted and os.path.isdir(originals)):
+            return corpus, originals, manifest
+    except (OSError, ValueError, KeyError):
+        pass
+    print("MAKING CORPUS...")
+    shutil.rmtree(originals, ignore_errors=True)
+    manifest = mklib.library_from_args(corpus, args)
+    for path in manifest["playlists"]:
+        os.makedirs(os.path.dirname(os.path.join(originals, path)), exist_ok=True)
+        shutil.copyfile(os.path.join(corpus, path), os.path.join(originals, path))
+    return corpus, originals, manifest
+
+def fmt(value, spec):
+    return "-" if value is None else format(value, spec)
+
+def main():
+    parser = argparse.ArgumentParser(prog="bench.py",
+        description="Benchmark relm3u end to end on a fabricated music library.")
+    parser.add_argument("--relm3u", help="relm3u binary to measure.", type=str, required=True)
+    parser.add_argument("--workdir", help="Folder for corpus, runs and results.", type=str, default="bench.out")
+    parser.add_argument("--jobs", help="Threads for the '-j' phases.", type=int, default=os.cpu_count() or 4)
+    parser.add_argument("--repeat", help="Runs per phase, the fastest one counts.", type=int, default=3)
+    parser.add_argument("--phases", help="Comma-separated phase names to run (default all).", type=str, default="")
+    parser.add_argument("--baseline", help="Results JSON of an earlier run to compare with.", type=str, default="")
+    parser.add_argument("--tolerance", help="Percent a phase may be slower than the baseline.", type=float, default=25)
+    parser.add_argument("--out", help="Results JSON to write (default <workdir>/results.json).", type=str, default="")
+    mklib.add_library_args(parser)
+    args = parser.parse_args()
+
+    relm3u = os.path.abspath(args.relm3u)
+    if(not os.access(relm3u, os.X_OK)):
+        print(f"ERROR: cannot run {relm3u}")
+        exit(1)
+    workdir = os.path.abspath(args.workdir)
+    os.makedirs(workdir, exist_ok=True)
+    corpus, originals, manifest = corpus_for(workdir, args)
+    use_strace = shutil.which("strace") is not None
+    wanted = [p.strip() for p in args.phases.split(",") if p.strip()]
+
+    print(f'CORPUS: {manifest["files"]} files in {manifest["folders"]} folders, '
+          f'{len(manifest["playlists"])} playlists with {manifest["entries"]} entries')
+    print("        " + ", ".join(f"{k} {v}" for k, v in manifest["kinds"].items()))
+    if(not use_strace):
+        print("        (no strace: system calls not counted, spawns taken from /proc/stat)")
+    print("")
+
+    results = {"corpus": manifest["params"], "jobs": args.jobs, "phases": {}}
+    print(f'{"PHASE":<22} {"WALL s":>8} {"USER s":>8} {"SYS s":>8} {"LINES/s":>10} {"SYSCALLS":>10} {"SPAWNS":>7} {"FOUND":>13}')
+    for name, phase_args, prepare in PHASES:
+        if(wanted and name not in wanted):
+            continue
+        phase_args = [a.replace("{jobs}", str(args.jobs)) for a in phase_args]
+        res = run_phase(relm3u, corpus, originals, manifest, workdir, phase_args, prepare, args.repeat, use_strace)
+        results["phases"][name] = res
+        print(f'{name:<22} {res["wall"]:>8.3f} {res["user"]:>8.3f} {res["sys"]:>8.3f} '
+              f'{fmt(res["lines_per_sec"], ".0f"):>10} {fmt(res["syscalls"], "d"):>10} {fmt(res["forks"], "d"):>7} '
+              f'{res["found"]:>6} / {res["entries"]:<6}'
+              + ("" if res["status"] == 0 else f'  EXIT {res["status"]}'))
+
+    out = args.out or os.path.join(workdir, "results.json")
+    with open(out, "w") as f:
+        json.dump(results, f, indent=1)
+    print(f"\nRESULTS: {out}")
+
+    if(not args.baseline):
+        return
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    if(baseline.get("corpus") != results["corpus"]):
+        print("WARNING: baseline was measured on another corpus")
+    print(f'\n{"PHASE":<22} {"BASE s":>8} {"NOW s":>8} {"CHANGE":>8}')
+    regressions = 0
+    for name, res in results["phases"].items():
+        base = baseline.get("phases", {}).get(name)
+        if(base is None or base["wall"] <= 0):
+            continue
+        change = (res["wall"] / base["wall"] - 1) * 100
+        slower = (change > args.tolerance) and (res["wall"] - base["wall"] > 0.05)
+        regressions += slower
+        print(f'{name:<22} {base["wall"]:>8.3f} {res["wall"]:>8.3f} {change:>+7.1f}%' + ("  REGRESSION" if slower else ""))
+    if(regressions):
+        exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,151 @@
+import argparse
+import json
+import os
+import random
+import shutil
+
+# Fabricates a music library and playlists for benchmarking relm3u.
+#
+# Library:   <root>/Music/[Genre g/...]/Artist a/Album b/NN - Track t.mp3
+#            (empty files; 'depth' adds genre folder levels above the artists)
+# Playlists: <root>/Music/Playlists/list NNN.m3u8, every fourth one in an artist
+#            folder instead
+#
+# Each playlist entry is one of these kinds, drawn by the given ratios:
+#   intact     relative path that is valid as it is
+#   relocated  absolute path of another machine, found by path probing
+#   renamed    album folder renamed since, found by filename search only
+#   encoded    file:// URL with percent-encoding, as media players write it
+#   windows    drive letter and backslashes
+#   missing    file that does not exist anywhere
+
+KINDS = ["intact", "relocated", "renamed", "encoded", "windows", "missing"]
+
+def percent_encode(path):
+    out = []
+    for c in path.encode("utf-8"):
+        ch = chr(c)
+        if(ch.isalnum() or ch in "/-._~"):
+            out.append(ch)
+        else:
+            out.append("%%%02X" % c)
+    return "".join(out)
+
+def make_entry(kind, rel, music, playlist_dir, rng):
+    # rel: path of the file below Music/, as it is (or was) in the library
+    if(kind == "intact"):
+        return os.path.relpath(os.path.join(music, rel), playlist_dir)
+    if(kind == "relocated"):
+        return "/mnt/oldnas/Music/" + rel
+    if(kind == "renamed"):
+        parts = rel.split("/")
+        parts[-2] = parts[-2] + " (Remaster)"
+        return "/mnt/oldnas/Music/" + "/".join(parts)
+    if(kind == "encoded"):
+        return "file:///home/someone/Music/" + percent_encode(rel)
+    if(kind == "windows"):
+        return "C:\\Users\\Someone\\Music\\" + rel.replace("/", "\\")
+    return "/mnt/oldnas/Music/Gone/Artist %d/Lost Track %d.mp3" % (rng.randint(0, 999), rng.randint(0, 99999))
+
+def make_library(root, artists=200, albums=4, tracks=12, depth=1, playlists=40, entries=1000,
+                 ratios=None, seed=1):
+    # build the corpus below root (removed first), return its manifest
+    rng = random.Random(seed)
+    ratios = ratios or {"intact": 30, "relocated": 25, "renamed": 10, "encoded": 10, "windows": 15, "missing": 10}
+    total = float(sum(ratios.values()))
+    shutil.rmtree(root, ignore_errors=True)
+    music = os.path.join(root, "Music")
+
+    files = []
+    folders = 0
+    for a in range(artists):
+        prefix = "/".join(["Genre %d" % ((a >> (2 * d)) % 4) for d in range(depth)])
+        for b in range(albums):
+            rel_dir = "/".join(filter(None, [prefix, "Artist %d" % a, "Album %d (%d)" % (b, 1970 + (a + b) % 50)]))
+            os.makedirs(os.path.join(music, rel_dir))
+            folders += 1
+            for t in range(tracks):
+                rel = "%s/%02d - Track %d.mp3" % (rel_dir, t + 1, (a * 31 + b * 7 + t) % 997)
+                open(os.path.join(music, rel), "wb").close()
+                files.append(rel)
+
+    playlist_dir = os.path.join(music, "Playlists")
+    os.makedirs(playlist_dir)
+    counts = dict((k, 0) for k in KINDS)
+    lines = 0
+    paths = []
+    for p in range(playlists):
+        if(p % 4 == 3 and artists > 0):
+            # some playlists live inside an artist folder
+            target_dir = os.path.join(music, os.path.dirname(os.path.dirname(rng.choice(files))))
+        else:
+            target_dir = playlist_dir
+        path = os.path.join(target_dir, "list %03d.m3u8" % p)
+        with open(path, "w", encoding="utf-8") as f:
+            f.write("#EXTM3U\n")
+            for e in range(entries):
+                r = rng.random() * total
+                kind = KINDS[-1]
+                for k in KINDS:
+                    r -= ratios.get(k, 0)
+                    if(r < 0):
+                        kind = k
+                        break
+                counts[kind] += 1
+                f.write("#EXTINF:%d,Artist - Title %d\n" % (rng.randint(60, 600), e))
+                f.write(make_entry(kind, rng.choice(files), music, target_dir, rng) + "\n")
+                lines += 1
+        paths.append(os.path.relpath(path, root))
+
+    manifest = {
+        "params": {"artists": artists, "albums": albums, "tracks": tracks, "depth": depth,
+                   "playlists": playlists, "entries": entries, "ratios": ratios, "seed": seed},
+        "files": len(files),
+        "folders": folders,
+        "playlists": paths,
+        "entries": lines,
+        "kinds": counts,
+        }
+    with open(os.path.join(root, "manifest.json"), "w") as f:
+        json.dump(manifest, f, indent=1)
+    return manifest
+
+def add_library_args(parser):
+    parser.add_argument("--artists", help="Artist folders.", type=int, default=200)
+    parser.add_argument("--albums", help="Album folders per artist.", type=int, default=4)
+    parser.add_argument("--tracks", help="Tracks per album.", type=int, default=12)
+    parser.add_argument("--depth", help="Genre folder levels above the artists.", type=int, default=1)
+    parser.add_argument("--playlists", help="Playlists to write.", type=int, default=40)
+    parser.add_argument("--entries", help="Entries per playlist.", type=int, default=1000)
+    parser.add_argument("--ratios", help="Entry kind ratios, e.g. intact=30,missing=10 (%s)." % ",".join(KINDS),
+                        type=str, default="intact=30,relocated=25,renamed=10,encoded=10,windows=15,missing=10")
+    parser.add_argument("--seed", help="Random seed.", type=int, default=1)
+
+def parse_ratios(text):
+    ratios = {}
+    for item in text.split(","):
+        name, _, value = item.partition("=")
+        if(name not in KINDS):
+            print(f"ERROR: unknown entry kind: {name}")
+            exit(1)
+        ratios[name] = float(value)
+    return ratios
+
+def library_from_args(root, args):
+    return make_library(root, args.artists, args.albums, args.tracks, args.depth, args.playlists,
+                        args.entries, parse_ratios(args.ratios), args.seed)
+
+def main():
+    parser = argparse.ArgumentParser(prog="mklib.py",
+        description="Fabricate a music library with playlists for benchmarking relm3u.")
+    parser.add_argument("root", help="Folder to create (removed first).", type=str)
+    add_library_args(parser)
+    args = parser.parse_args()
+
+    manifest = library_from_args(args.root, args)
+    print(f'{manifest["files"]} files in {manifest["folders"]} folders, '
+          f'{len(manifest["playlists"])} playlists with {manifest["entries"]} entries')
+    print(", ".join(f"{k} {v}" for k, v in manifest["kinds"].items()))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------
+// P A T H S T O R E _ B E N C H
+// Memory benchmark of the path store of the librelm3u library index
+// (C) 2020-2024 Julien Thomas
+//
+// THIS IS OPEN SOURCE FREEWARE, NO WARRANTIES, NO RESTRICTIONS
+//
+// -----------------------------------------------------------------------------
+//
+// Fabricates the listing of a large NAS music share in memory (no files are
+// written) and builds an index image of it with the index builder of the
+// library. Compares the memory of its path store (interned directory names,
+// front-coded filenames) with the naive way of one malloc()ed string per
+// absolute path, checks every path put together from the index against its
+// naive string and measures how fast paths are put together.
+//
+// Share:  /volume1/Music/<Artist>/<Album (Year)>/[CD n/]NN - Title.flac,
+//         some tracks named 'Artist - NN - Title.flac' as rippers do
+//
+// Build and run (the library is compiled in, its index is not exported):
+//   gcc -O2 -pthread -o pathstore_bench pathstore_bench.c && ./pathstore_bench [files]
+//
+// -----------------------------------------------------------------------------
+
+#include "../librelm3u.c"
+#include <malloc.h>
+
+#define SHAREROOT  "/volume1/Music"
+#define DEFFILES   3000000              // files of the share by default
+#define MINSECONDS 0.25                 // run each measurement at least that long
+
+double now_seconds(void)
+{
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return(ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+uint64_t rng_state = 88172645463325252ull;
+
+uint32_t rng_next(uint32_t n)
+{   // deterministic pseudo random number 0 .. n-1 (xorshift64)
+rng_state ^= rng_state << 13;
+rng_state ^= rng_state >> 7;
+rng_state ^= rng_state << 17;
+return((uint32_t)((rng_state >> 11) % n));
+}
+
+const char *syllables[] =
+{   "an", "bel", "cor", "da", "el", "fen", "gra", "hol", "is", "jo", "ka", "lin", "mor", "nes",
+    "o", "pa", "qui", "ra", "sil", "tor", "u", "ven", "wy", "xa", "yor", "zel"  };
+
+const char *words[] =
+{   "Love", "Night", "Heart", "Dream", "Fire", "Rain", "Blue", "Home", "Road", "Light", "Time",
+    "Gold", "River", "Stone", "Summer", "Winter", "Shadow", "Ocean", "Morning", "Dance", "Song",
+    "Wild", "Silver", "Broken", "Lonely", "Electric", "Forever", "Midnight", "Paradise", "Storm"  };
+
+int make_word(char *s)
+{   // capitalised name of 2 to 4 syllables
+int n = 2 + rng_next(3);
+int len = 0;
+while (n-- > 0) { len += sprintf(s + len, "%s", syllables[rng_next(26)]); }
+s[0] = s[0] - 'a' + 'A';
+return(len);
+}
+
+int make_title(char *s, int maxwords)
+{   // title of 1 to maxwords words
+int n = 1 + rng_next(maxwords);
+int len = 0;
+while (n-- > 0) { len += sprintf(s + len, "%s%s", (len > 0) ? " " : "", words[rng_next(30)]); }
+return(len);
+}
+
+struct share
+{   // the share as the index builder sees it and as naive strings
+    struct idxbuild b;
+    char **paths;           // naive: one absolute path per file
+    uint32_t npaths, apaths;
+    size_t naivebytes;      // pointer array not included
+};
+
+uint32_t share_dir(struct share *sh, char *name, uint32_t parent, uint32_t nkids)
+{   // new directory with room for nkids directory entries
+uint32_t d = idx_newdir(&sh->b, name, strlength(name), parent);
+uint32_t *k = idx_grow(sh->b.kids, &sh->b.akids, sh->b.nkids + nkids, sizeof(uint32_t));
+if ((k == NULL) || sh->b.failed) { puts("ERROR: out of memory"); exit(1); }
+sh->b.kids = k;
+sh->b.dirs[d].firstkid = sh->b.nkids;
+sh->b.nkids += nkids;
+return(d);
+}
+
+void share_kid(struct share *sh, uint32_t d, uint32_t kid)
+{
+struct idxdir *dir = &sh->b.dirs[d];
+sh->b.kids[dir->firstkid + dir->nkids++] = kid;
+return;
+}
+
+void share_files(struct share *sh, uint32_t d, char *dirpath, char *artist, int ntracks)
+{   // tracks of one album (or one CD of it)
+struct idxnames *nm = malloc(sizeof(struct idxnames));
+if (nm == NULL) { puts("ERROR: out of memory"); exit(1); }
+nm->inblock = 0;
+int prefixed = (rng_next(10) < 3);  // ripped as 'Artist - NN - Title'
+int t = 0;
+for (t = 1; t <= ntracks; t++)
+    {
+        char name[PATHMAX];
+        int len = prefixed ? sprintf(name, "%s - %02d - ", artist, t) : sprintf(name, "%02d - ", t);
+        len += make_title(name + len, 5);
+        len += sprintf(name + len, ".flac");
+        share_kid(sh, d, idx_addfile(&sh->b, nm, name, len, d) | IDXKIDFILE);
+
+        if (sh->npaths == sh->apaths)
+            {
+                sh->apaths = (sh->apaths == 0) ? 1024 : sh->apaths * 2;
+                sh->paths = realloc(sh->paths, (size_t)sh->apaths * sizeof(char *));
+                if (sh->paths == NULL) { puts("ERROR: out of memory"); exit(1); }
+            }
+        char full[2 * PATHMAX];
+        sprintf(full, "%s/%s", dirpath, name);
+        char *p = strdup(full);
+        if (p == NULL) { puts("ERROR: out of memory"); exit(1); }
+        sh->paths[sh->npaths++] = p;
+        sh->naivebytes += malloc_usable_size(p) + sizeof(size_t);   // plus malloc header
+    }
+free(nm);
+return;
+}
+
+void share_make(struct share *sh, uint32_t nfiles)
+{   // about nfiles files, 10 albums of 13.2 tracks per artist on average
+memset(sh, 0, sizeof(struct share));
+uint32_t nartists = nfiles / 132 + 1;
+uint32_t root = share_dir(sh, "", IDXNOPARENT, nartists);
+uint32_t a = 0;
+for (a = 0; a < nartists; a++)
+    {
+        char artist[256];
+        int len = make_word(artist);
+        if (rng_next(4) == 0) { len += sprintf(artist + len, " "); len += make_word(artist + len); }
+        if (rng_next(8) == 0) { memmove(artist + 4, artist, len + 1); memcpy(artist, "The ", 4); }
+        int nalbums = 5 + rng_next(11);
+        uint32_t ad = share_dir(sh, artist, root, nalbums);
+        share_kid(sh, root, ad);
+        int b = 0;
+        for (b = 0; b < nalbums; b++)
+            {
+                char album[256];
+                int l = make_title(album, 3);
+                sprintf(album + l, " (%d)", 1960 + rng_next(65));
+                int ncds = (rng_next(10) == 0) ? 2 : 1;
+                uint32_t bd = share_dir(sh, album, ad, (ncds > 1) ? ncds : 12);
+                share_kid(sh, ad, bd);
+                char dirpath[PATHMAX];
+                sprintf(dirpath, "%s/%s/%s", SHAREROOT, artist, album);
+                if (ncds == 1) { share_files(sh, bd, dirpath, artist, 12); continue; }
+                int c = 0;
+                for (c = 1; c <= ncds; c++)
+                    {
+                        char cd[16], cdpath[PATHMAX + 16];
+                        sprintf(cd, "CD%d", c);
+                        sprintf(cdpath, "%s/%s", dirpath, cd);
+                        uint32_t cdd = share_dir(sh, cd, bd, 12);
+                        share_kid(sh, bd, cdd);
+                        share_files(sh, cdd, cdpath, artist, 12);
+                    }
+            }
+    }
+return;
+}
+
+int main(int argc, char **argv)
+{   // main function
+uint32_t nfiles = (argc > 1) ? (uint32_t)atol(argv[1]) : DEFFILES;
+if (nfiles == 0) { puts("usage: pathstore_bench [files]"); return(1); }
+
+printf("\nMAKING SHARE OF ABOUT %u FILES...\n", nfiles);
+double t0 = now_seconds();
+struct share *sh = malloc(sizeof(struct share));
+if (sh == NULL) { puts("ERROR: out of memory"); return(1); }
+share_make(sh, nfiles);
+double t1 = now_seconds();
+struct libindex *ix = idx_finish(&sh->b);
+double t2 = now_seconds();
+if (ix == NULL) { puts("ERROR: index image could not be made"); return(1); }
+printf("%u files in %u folders, listing %.2f s, index image %.2f s\n\n",
+       ix->hdr->nfiles, ix->hdr->ndirs, t1 - t0, t2 - t1);
+
+// memory: path store = directory name and parent, file name reference and
+// directory, the string pool; the image holds mtimes, key chains etc. besides
+uint32_t n = ix->hdr->nfiles;
+size_t naive = sh->naivebytes + (size_t)n * sizeof(char *);
+size_t store = (size_t)ix->hdr->ndirs * 2 * sizeof(uint32_t) + (size_t)n * 2 * sizeof(uint32_t) + ix->hdr->poolsize;
+size_t pathbytes = 0;
+uint32_t f = 0;
+for (f = 0; f < n; f++) { pathbytes += strlength(sh->paths[f]) + 1; }
+printf("%-34s %14s %12s %8s\n", "MEMORY", "bytes", "bytes/file", "ratio");
+printf("%-34s %14zu %12.1f %8s\n", "path text alone", pathbytes, (double)pathbytes / n, "");
+printf("%-34s %14zu %12.1f %8s\n", "naive strings (malloc, pointers)", naive, (double)naive / n, "1.0");
+printf("%-34s %14zu %12.1f %8.1f\n", "path store", store, (double)store / n, (double)naive / store);
+printf("%-34s %14zu %12.1f %8.1f\n", "whole index image", ix->imagesize, (double)ix->imagesize / n, (double)naive / ix->imagesize);
+
+// every path put together from the index must be its naive string
+char path[PATHMAX], full[2 * PATHMAX];
+uint32_t bad = 0;
+for (f = 0; f < n; f++)
+    {
+        libindex_path(ix, f, path, PATHMAX);
+        sprintf(full, "%s/%s", SHAREROOT, path);
+        if (strcmp(full, sh->paths[f]) != 0) { if (bad++ < 5) { printf("MISMATCH %s\n         %s\n", full, sh->paths[f]); } }
+    }
+printf("\n%u of %u paths put together wrong\n", bad, n);
+
+// speed of putting paths together, in random order as lookups do
+printf("\n%-34s %14s\n", "PATHS", "Mpaths/s");
+size_t sum = 0;
+long long done = 0;
+double start = now_seconds(), t = 0;
+while ((t = now_seconds() - start) < MINSECONDS)
+    {
+        int i = 0;
+        for (i = 0; i < 100000; i++) { sum += libindex_path(ix, rng_next(n), path, PATHMAX); }
+        done += 100000;
+    }
+printf("%-34s %14.2f\n", "put together from index", done / t / 1e6);
+done = 0;
+start = now_seconds();
+while ((t = now_seconds() - start) < MINSECONDS)
+    {
+        int i = 0;
+        for (i = 0; i < 100000; i++) { char *p = sh->paths[rng_next(n)]; size_t l = strlength(p); memcpy(path, p, l + 1); sum += l; }
+        done += 100000;
+    }
+printf("%-34s %14.2f\n", "copied from naive strings", done / t / 1e6);
+if (sum == 0) { puts(""); }
+
+for (f = 0; f < sh->npaths; f++) { free(sh->paths[f]); }
+free(sh->paths);
+free(sh->b.dirs);
+free(sh->b.kids);
+free(sh->b.entries);
+free(sh->b.pool);
+free(sh->b.intern);
+free(sh);
+libindex_free(ix);
+return(bad > 0);
+}
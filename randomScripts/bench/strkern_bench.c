@@ -0,0 +1,149 @@
+// -----------------------------------------------------------------------------
+// S T R K E R N _ B E N C H
+// Microbenchmark of the string kernels of librelm3u
+// (C) 2020-2024 Julien Thomas
+//
+// THIS IS OPEN SOURCE FREEWARE, NO WARRANTIES, NO RESTRICTIONS
+//
+// -----------------------------------------------------------------------------
+//
+// Measures every kernel in every version this processor runs, in GB/s, on
+// one long buffer and on playlist-sized lines, then the whole per-line
+// normalisation as done for each playlist entry, in lines per second.
+//
+// Build and run (the library is compiled in, its kernels are not exported):
+//   gcc -O2 -pthread -o strkern_bench strkern_bench.c && ./strkern_bench
+//
+// -----------------------------------------------------------------------------
+
+#include "../librelm3u.c"
+
+#define BIGSIZE    (16 * 1024 * 1024)  // long buffer, bytes
+#define LINESIZE   96                   // typical playlist line, bytes
+#define MINSECONDS 0.25                 // run each measurement at least that long
+
+double now_seconds(void)
+{
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return(ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+volatile size_t sink;                   // keeps results alive
+
+// one kernel run over len bytes, 'kernel' x 'level'
+void run_kernel(int kernel, int level, char *buf, size_t len)
+{
+size_t r = 0;
+switch (kernel * 3 + level)
+    {
+        case 0: { r = kern_findchr_scalar(buf, len, '%'); break; }
+        case 3: { kern_replacechr_scalar(buf, len, 92, 47); break; }
+        case 6: { r = kern_spanctl_scalar(buf, len); break; }
+        case 9: { r = kern_rspanctl_scalar(buf, len); break; }
+        #ifdef KERN_X86
+        case 1: { r = kern_findchr_sse2(buf, len, '%'); break; }
+        case 2: { r = kern_findchr_avx2(buf, len, '%'); break; }
+        case 4: { kern_replacechr_sse2(buf, len, 92, 47); break; }
+        case 5: { kern_replacechr_avx2(buf, len, 92, 47); break; }
+        case 7: { r = kern_spanctl_sse2(buf, len); break; }
+        case 8: { r = kern_spanctl_avx2(buf, len); break; }
+        case 10: { r = kern_rspanctl_sse2(buf, len); break; }
+        case 11: { r = kern_rspanctl_avx2(buf, len); break; }
+        #endif
+    }
+sink += r;
+return;
+}
+
+double measure(int kernel, int level, char *buf, size_t len)
+{   // return GB/s of one kernel over buf, in pieces of len bytes
+size_t done = 0;
+double t0 = now_seconds();
+double t = 0;
+do
+    {
+        size_t ofs = 0;
+        for (ofs = 0; ofs + len <= BIGSIZE; ofs += len)    { run_kernel(kernel, level, buf + ofs, len); }
+        done += ofs;
+        t = now_seconds() - t0;
+    }
+while (t < MINSECONDS);
+return(done / t / 1e9);
+}
+
+int main(void)
+{   // main function
+char *big = malloc(BIGSIZE + 1);
+char *blank = malloc(BIGSIZE + 1);
+if ((big == NULL) || (blank == NULL)) { return(1); }
+
+// path-like text: no '%', no '\', no control characters, as in clean lines
+// (the worst case for each kernel, every byte has to be looked at)
+const char *text = "Music/Some Artist/Some Album (2001)/07 - Some Title.flac/";
+size_t textlen = strlen(text);
+size_t i = 0;
+for (i = 0; i < BIGSIZE; i++) { big[i] = text[i % textlen]; }
+big[BIGSIZE] = 0;
+// nothing but whitespace for the trim kernels, for the same reason
+memset(blank, ' ', BIGSIZE);
+blank[BIGSIZE] = 0;
+
+const char *kernels[] = { "findchr '%'", "replacechr '\\'", "spanctl", "rspanctl" };
+const char *levels[] = { "scalar", "sse2", "avx2" };
+int maxlevel = kern_level();
+
+printf("\nKERNEL LEVEL OF THIS PROCESSOR: %s\n\n", levels[maxlevel]);
+printf("%-18s %-8s %12s %12s\n", "KERNEL", "VERSION", "GB/s 16 MiB", "GB/s lines");
+int k = 0;
+int l = 0;
+for (k = 0; k < 4; k++)
+    {
+        for (l = 0; l <= maxlevel; l++)
+            {
+                char *buf = (k < 2) ? big : blank;
+                double whole = measure(k, l, buf, BIGSIZE);
+                double lines = measure(k, l, buf, LINESIZE);
+                printf("%-18s %-8s %12.2f %12.2f\n", kernels[k], levels[l], whole, lines);
+            }
+    }
+
+// whole normalisation of one playlist line, as resolve_playlist_line() does
+const char *samples[] =
+    {
+        "  C:\\Users\\Me\\Music\\Some Artist\\Some Album (2001)\\07 - Some Title.flac\r\n",
+        "file:///home/me/Music/Some%20Artist/Some%20Album%20%282001%29/07%20-%20Title.mp3\n",
+        "/home/me/Music/Some Artist/Some Album (2001)/07 - Some Title.mp3\n",
+    };
+char linbuf[PATHMAX];
+printf("\n%-18s %12s\n", "NORMALISATION", "Mlines/s");
+int s = 0;
+for (s = 0; s < 3; s++)
+    {
+        long long n = 0;
+        double t0 = now_seconds();
+        double t = 0;
+        do
+            {
+                int r = 0;
+                for (r = 0; r < 10000; r++)
+                    {
+                        strcpy(linbuf, samples[s]);
+                        strlinetrim(linbuf);
+                        backslashestoslashes(linbuf);
+                        remove_protocol_and_drive_letters(linbuf);
+                        strlefttrim(linbuf, "/");
+                        urltostring(linbuf);
+                        sink += linbuf[0];
+                    }
+                n += 10000;
+                t = now_seconds() - t0;
+            }
+        while (t < MINSECONDS);
+        printf("%-18s %12.2f\n", (s == 0) ? "windows style" : (s == 1) ? "percent-encoded" : "plain", n / t / 1e6);
+    }
+puts("");
+free(big);
+free(blank);
+return(0);
+}
@@ -18,10 +18,13 @@ def main():
     
     with open(input, encoding="utf8") as input_fd:
         lines = [line.rstrip() for line in input_fd]
-    for i, line in enumerate(lines):
-        for line2 in lines[i+1:]:
-            if(line == line2):
-                print("FOUND DUPLICATE: "+line)
+    # one pass over the lines, each line looked up in the lines seen before
+    # ('relm3u --dupes' finds the same file written in different ways)
+    seen = set()
+    for line in lines:
+        if(line in seen):
+            print("FOUND DUPLICATE: "+line)
+        seen.add(line)
 
     exit()
 
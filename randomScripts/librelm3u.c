@@ -0,0 +1,7293 @@
+// -----------------------------------------------------------------------------
+// L I B R E L M 3 U
+// Convert absolute paths in M3U playlist to relative paths
+// Re-search relocated files to update playlist accordingly
+// (C) 2020-2024 Julien Thomas
+//
+// THIS IS OPEN SOURCE FREEWARE, NO WARRANTIES, NO RESTRICTIONS
+//
+// -----------------------------------------------------------------------------
+//
+// Library part of relm3u, see librelm3u.h for the interface and relm3u.c for
+// the changelog. Every piece of state hangs off a relm3u_ctx.
+//
+// -----------------------------------------------------------------------------
+//
+#define _GNU_SOURCE     // FNM_CASEFOLD, realpath() on glibc
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "librelm3u.h"
+
+#define PATHMAX  4096
+#define MAXJOBS  RELM3U_MAXJOBS
+
+// detect unix-based systems and define symbol UNIXES for briefness
+#if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+#define UNIXES
+#endif
+
+#ifdef _WIN32
+    #define SLASH "\\"
+#else
+    #define SLASH "/"
+#endif
+
+#ifdef UNIXES
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <fnmatch.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "unikey.h"     // generated by mkunikey.py
+#endif
+
+#ifdef __linux__
+#include <linux/version.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+#define PROBEURING      // statx by io_uring, see PROBE BATCHES
+#include <linux/io_uring.h>
+#endif
+#endif
+
+// -----------------------------------------------------------------------------
+// CONTEXT
+//
+// Everything accumulated while converting: the filename indexes of search
+// method 2, the folder cache of search method 1 and the running totals. Each
+// part has a lock of its own, so threads sharing a context only wait for each
+// other where they touch the same part.
+
+#define IDXMAXROOTS   16            // independent trees indexed per context
+#define IDXMAXFAILED  4             // trees remembered as not indexable
+#define FPMAXSNAPSHOTS RELM3U_MAXSNAPSHOTS   // folders searched for original files
+
+struct fprint
+{   // content fingerprint of a file (see CONTENT FINGERPRINTS), size 0 = none
+    unsigned long long size;
+    unsigned long long hash;
+};
+
+struct idxfailed
+{   // a tree that could not be indexed, not tried again while its root folder
+    // keeps its modification time
+    char rootpath[PATHMAX];
+    int maxdepth;
+    long long mtime;
+};
+
+struct relm3u_ctx
+{
+    int flags;                              // RELM3U_PERSIST_INDEX, RELM3U_FINGERPRINT, ...
+    int radius;                             // search folders above the playlist folder
+    struct relm3u_stats stats;
+    struct dupeslot *dupes;                 // files met, with RELM3U_DUPES
+    uint32_t dupesize, dupeused;
+    char **dupelists;                       // path of each playlist numbered 1..
+    uint32_t ndupelists, adupelists;
+#ifdef UNIXES
+    char library[PATHMAX];                  // canonical path of the library tree, "" for none
+    struct libindex *roots[IDXMAXROOTS];    // indexed trees
+    int nroots;
+    struct idxfailed failed[IDXMAXFAILED];  // trees that could not be indexed
+    int nfailed;
+    pthread_rwlock_t indexlock;             // guards roots, nroots and failed
+    struct probeslot *probecache;           // folders met while probing
+    uint32_t probesize, probeused;
+    pthread_rwlock_t probelock;             // guards the probe cache
+    int nouring;                            // io_uring failed, probe line by line
+    struct probering *rings;                // io_uring set up and not in use
+    pthread_mutex_t ringlock;               // guards rings
+    pthread_mutex_t statslock;              // guards stats
+    struct runstate *state;                 // incremental mode, or NULL
+    pthread_mutex_t statelock;              // guards state
+    char *snapshots[FPMAXSNAPSHOTS];        // backup and snapshot folders
+    int nsnapshots;
+    pthread_mutex_t fplock;                 // guards taking fingerprints
+    pthread_mutex_t dupelock;               // guards dupes and dupelists
+    pthread_rwlock_t taglock;               // guards the tag caches of the indexed trees
+#endif
+};
+
+// Counters of one playlist are collected apart from the context, without
+// locks, and added to its running totals when the playlist is done. Lines of a
+// playlist resolved on several threads add to the same counters atomically.
+
+long long now_ns(void)
+{   // monotonic wall clock in nanoseconds
+#ifdef UNIXES
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec);
+#else
+return((long long)clock() * (1000000000LL / CLOCKS_PER_SEC));
+#endif
+}
+
+void stats_add(long long *counter, long long n)
+{
+#ifdef __GNUC__
+__atomic_fetch_add(counter, n, __ATOMIC_RELAXED);
+#else
+*counter += n;
+#endif
+return;
+}
+
+void stats_merge(relm3u_ctx *ctx, struct relm3u_stats *ps)
+{   // add the counters of one playlist to the running totals
+long long *to = (long long *)&ctx->stats;
+long long *from = (long long *)ps;
+size_t i = 0;
+#ifdef UNIXES
+pthread_mutex_lock(&ctx->statslock);
+#endif
+for (i = 0; i < sizeof(struct relm3u_stats) / sizeof(long long); i++) { to[i] += from[i]; }
+#ifdef UNIXES
+pthread_mutex_unlock(&ctx->statslock);
+#endif
+return;
+}
+
+// -----------------------------------------------------------------------------
+// STRING KERNELS
+//
+// The byte scans every playlist line goes through, on strings of known length.
+// Each kernel comes as scalar loop and, on x86, as SSE2 and AVX2 version; the
+// best one the processor runs is chosen on each call. Lengths are taken with
+// strlen() of the C library, which is vectorised there already.
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KERN_X86
+#include <immintrin.h>
+#endif
+
+#define KERNSCALAR  0
+#define KERNSSE2    1
+#define KERNAVX2    2
+
+int kern_level(void)
+{   // best kernel set of this processor
+#ifdef KERN_X86
+if (__builtin_cpu_supports("avx2"))   { return(KERNAVX2); }
+if (__builtin_cpu_supports("sse2"))   { return(KERNSSE2); }
+#endif
+return(KERNSCALAR);
+}
+
+// find first c in s[0..len), return its index or len
+size_t kern_findchr_scalar(const char *s, size_t len, char c)
+{
+size_t i = 0;
+while ((i < len) && (s[i] != c)) { i++; }
+return(i);
+}
+
+// replace every from by to in s[0..len)
+void kern_replacechr_scalar(char *s, size_t len, char from, char to)
+{
+size_t i = 0;
+for (i = 0; i < len; i++) { if (s[i] == from) { s[i] = to; } }
+return;
+}
+
+// count the control characters and spaces (< 33) s[0..len) starts with
+size_t kern_spanctl_scalar(const char *s, size_t len)
+{
+size_t i = 0;
+while ((i < len) && ((unsigned char)s[i] < 33)) { i++; }
+return(i);
+}
+
+// count the control characters and spaces (< 33) s[0..len) ends with
+size_t kern_rspanctl_scalar(const char *s, size_t len)
+{
+size_t i = len;
+while ((i > 0) && ((unsigned char)s[i - 1] < 33)) { i--; }
+return(len - i);
+}
+
+#ifdef KERN_X86
+__attribute__((target("sse2")))
+size_t kern_findchr_sse2(const char *s, size_t len, char c)
+{
+__m128i needle = _mm_set1_epi8(c);
+size_t i = 0;
+for (i = 0; i + 16 <= len; i += 16)
+    {
+        unsigned m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(s + i)), needle));
+        if (m != 0) { return(i + __builtin_ctz(m)); }
+    }
+return(i + kern_findchr_scalar(s + i, len - i, c));
+}
+
+__attribute__((target("sse2")))
+void kern_replacechr_sse2(char *s, size_t len, char from, char to)
+{
+__m128i vfrom = _mm_set1_epi8(from);
+__m128i vto = _mm_set1_epi8(to);
+size_t i = 0;
+for (i = 0; i + 16 <= len; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i eq = _mm_cmpeq_epi8(x, vfrom);
+        if (_mm_movemask_epi8(eq) == 0) { continue; }
+        x = _mm_or_si128(_mm_andnot_si128(eq, x), _mm_and_si128(eq, vto));
+        _mm_storeu_si128((__m128i *)(s + i), x);
+    }
+kern_replacechr_scalar(s + i, len - i, from, to);
+return;
+}
+
+__attribute__((target("sse2")))
+unsigned kern_ctlmask_sse2(__m128i x)
+{   // bit set per byte < 33
+__m128i lim = _mm_set1_epi8(32);
+return(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(x, lim), x)));
+}
+
+__attribute__((target("sse2")))
+size_t kern_spanctl_sse2(const char *s, size_t len)
+{
+size_t i = 0;
+for (i = 0; i + 16 <= len; i += 16)
+    {
+        unsigned m = ~kern_ctlmask_sse2(_mm_loadu_si128((const __m128i *)(s + i))) & 0xffff;
+        if (m != 0) { return(i + __builtin_ctz(m)); }
+    }
+return(i + kern_spanctl_scalar(s + i, len - i));
+}
+
+__attribute__((target("sse2")))
+size_t kern_rspanctl_sse2(const char *s, size_t len)
+{
+size_t j = len;
+for (j = len; j >= 16; j -= 16)
+    {
+        unsigned m = ~kern_ctlmask_sse2(_mm_loadu_si128((const __m128i *)(s + j - 16))) & 0xffff;
+        if (m != 0) { return(len - (j - 16) - (32 - __builtin_clz(m))); }
+    }
+return(len - j + kern_rspanctl_scalar(s, j));
+}
+
+__attribute__((target("avx2")))
+size_t kern_findchr_avx2(const char *s, size_t len, char c)
+{
+__m256i needle = _mm256_set1_epi8(c);
+size_t i = 0;
+for (i = 0; i + 32 <= len; i += 32)
+    {
+        unsigned m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i *)(s + i)), needle));
+        if (m != 0) { return(i + __builtin_ctz(m)); }
+    }
+_mm256_zeroupper();      // no AVX-SSE transition penalty in the tail
+return(i + kern_findchr_sse2(s + i, len - i, c));
+}
+
+__attribute__((target("avx2")))
+void kern_replacechr_avx2(char *s, size_t len, char from, char to)
+{
+__m256i vfrom = _mm256_set1_epi8(from);
+__m256i vto = _mm256_set1_epi8(to);
+size_t i = 0;
+for (i = 0; i + 32 <= len; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i eq = _mm256_cmpeq_epi8(x, vfrom);
+        if (_mm256_movemask_epi8(eq) == 0) { continue; }
+        _mm256_storeu_si256((__m256i *)(s + i), _mm256_blendv_epi8(x, vto, eq));
+    }
+_mm256_zeroupper();
+kern_replacechr_sse2(s + i, len - i, from, to);
+return;
+}
+
+__attribute__((target("avx2")))
+unsigned kern_ctlmask_avx2(__m256i x)
+{   // bit set per byte < 33
+__m256i lim = _mm256_set1_epi8(32);
+return(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(x, lim), x)));
+}
+
+__attribute__((target("avx2")))
+size_t kern_spanctl_avx2(const char *s, size_t len)
+{
+size_t i = 0;
+for (i = 0; i + 32 <= len; i += 32)
+    {
+        unsigned m = ~kern_ctlmask_avx2(_mm256_loadu_si256((const __m256i *)(s + i)));
+        if (m != 0) { return(i + __builtin_ctz(m)); }
+    }
+_mm256_zeroupper();
+return(i + kern_spanctl_sse2(s + i, len - i));
+}
+
+__attribute__((target("avx2")))
+size_t kern_rspanctl_avx2(const char *s, size_t len)
+{
+size_t j = len;
+for (j = len; j >= 32; j -= 32)
+    {
+        unsigned m = ~kern_ctlmask_avx2(_mm256_loadu_si256((const __m256i *)(s + j - 32)));
+        if (m != 0) { return(len - (j - 32) - (32 - __builtin_clz(m))); }
+    }
+_mm256_zeroupper();
+return(len - j + kern_rspanctl_sse2(s, j));
+}
+#endif
+
+size_t kern_findchr(const char *s, size_t len, char c)
+{
+#ifdef KERN_X86
+switch (kern_level())
+    {
+        case KERNAVX2: { return(kern_findchr_avx2(s, len, c)); }
+        case KERNSSE2: { return(kern_findchr_sse2(s, len, c)); }
+    }
+#endif
+return(kern_findchr_scalar(s, len, c));
+}
+
+void kern_replacechr(char *s, size_t len, char from, char to)
+{
+#ifdef KERN_X86
+switch (kern_level())
+    {
+        case KERNAVX2: { kern_replacechr_avx2(s, len, from, to); return; }
+        case KERNSSE2: { kern_replacechr_sse2(s, len, from, to); return; }
+    }
+#endif
+kern_replacechr_scalar(s, len, from, to);
+return;
+}
+
+size_t kern_spanctl(const char *s, size_t len)
+{
+#ifdef KERN_X86
+switch (kern_level())
+    {
+        case KERNAVX2: { return(kern_spanctl_avx2(s, len)); }
+        case KERNSSE2: { return(kern_spanctl_sse2(s, len)); }
+    }
+#endif
+return(kern_spanctl_scalar(s, len));
+}
+
+size_t kern_rspanctl(const char *s, size_t len)
+{
+#ifdef KERN_X86
+switch (kern_level())
+    {
+        case KERNAVX2: { return(kern_rspanctl_avx2(s, len)); }
+        case KERNSSE2: { return(kern_rspanctl_sse2(s, len)); }
+    }
+#endif
+return(kern_rspanctl_scalar(s, len));
+}
+
+// these few string manipulation routines were taken from 'joystring' library
+
+int strlength(char *bstr)
+{   // find length of null-terminated char array
+    // return values from 0 to length (in byte characters)
+return ((int)strlen(bstr));
+}
+
+int strlefttrim (char *astr, char *cstr)
+{   // remove left part of astr that is identical to cstr
+// return(1) on trim success, otherwise (0)
+// abort if one of strings is null
+if (astr[0] == 0)   { return(0); }
+if (cstr[0] == 0)   { return(0); }
+int i = 0;
+// check up to where the strings are identical
+while ((astr[i] == cstr[i]) && (cstr[i] != 0))  { i++; }
+// abort when cstr was NOT fully identical with left from astr
+if (cstr[i] != 0)   { return(0); }
+// otherwise shift astr down by number of characters in cstr
+memmove(astr, astr + i, strlen(astr + i) + 1);
+return (1);
+}
+
+int strleftcutident(char *astr, char *cstr)
+{   // remove only the identical part of astr and cstr
+if (astr[0] == 0)   { return(0); }
+if (cstr[0] == 0)   { return(0); }
+int i = 0;
+int j = 0;
+while ((astr[i] == cstr[i]) && (astr[i] != 0)) { i++; }
+// fast leave when astr is identical to cstr up to the end
+if (astr[i] == 0)   { astr[0] = 0; return(1); }
+// otherwise shift astr down by number of characters in cstr
+j = i;
+i = 0;
+while (astr[j] != 0) { astr[i++] = astr[j++]; }
+astr[i] = 0;
+return (1);
+}
+
+int strleftcomp(char *astr, char *cstr)
+{   // is cstr a left sided subset of astr ? (0/1)
+if (astr == NULL) { return(0); }
+if (cstr == NULL) { return(0); }
+while ((*astr != 0) && (*cstr != 0))
+    {   if (*astr != *cstr) { break; }
+        astr++; cstr++;
+    }
+if (*cstr == 0)     { return(1); }
+return(0);
+}
+
+int strcomp(char *astr, char *bstr)
+{   // compare strings, return (1) when identical, return (0) when different
+while ((*astr != 0) && (*bstr != 0))
+    {   if (*astr != *bstr) { break; }
+        astr++; bstr++;
+    }
+if ((*astr == 0) && (*bstr == 0)) { return(1); }
+return(0);
+}
+
+int strfindchr(char *sourcestr, char searchchr)
+{   // check for a single search character to exist within the source string
+    // return (1) when found
+    // return (0) when not found or search character was NULL
+if (sourcestr[0] == 0)  { return (0); }
+if (searchchr == 0)     { return (0); }
+return (strchr(sourcestr, searchchr) != NULL);
+}
+
+int strrightcomp(char *astr, char *cstr)
+{   // is cstr a right sided subset of astr ?
+int i = 0; while (astr[i] != 0) { i++; }
+int j = 0; while (cstr[j] != 0) { j++; }
+if (j > i)  { return(0); }
+while (j > 0)  {   i-- ; j-- ;  if (astr[i] != cstr[j])  { return(0); }    }
+return (1);
+}
+
+int strfindstr(char *sourcestr, char *searchstr)
+{   // find first occurrence of search string within source string
+    // and return direct index
+    // or return (-1) if not found
+if (sourcestr[0] == 0)  { return (-1); }
+if (searchstr[0] == 0)  { return (-1); }
+int i = 0;
+int j = 0;
+while ( sourcestr[i] != 0)
+    {
+        j = 0;
+        while ( (unsigned)searchstr[j] == (unsigned)sourcestr[i+j])
+            {
+                j++;
+                if (searchstr[j] == 0)     // found whole part str!
+                    { return(i);  }
+            }
+    i++;
+    }
+return(-1);
+}
+
+void strlinetrim(char *astr)
+{   // trim linestring from leading and trailing controls and whitespaces
+size_t len = strlen(astr);
+size_t i = 0;
+
+// skip non-ascii characters (e.g. Unicode BOM or code points)
+while ((i < len) && ((unsigned char)astr[i] > 127))  { i++; }
+
+// left trim
+i += kern_spanctl(astr + i, len - i);
+len -= i;
+if (i > 0) { memmove(astr, astr + i, len); }
+
+// right trim
+len -= kern_rspanctl(astr, len);
+astr[len] = 0;
+
+return;
+}
+
+int strappendsafe(char *targetstr, int targetmax, char *appendstr)
+{   // append targetstr with appendstr up to length of targetmax
+int i = 0; while (targetstr[i] != 0) { i++; }
+int j = 0;
+while ((appendstr[j]) && (i < targetmax))  { targetstr[i++] = appendstr[j++]; }
+targetstr[i] = 0;
+if (i == targetmax) { return(0); }
+return(1);
+}
+
+// -----------------------------------------------------------------------------
+
+int urltostring(char *astr)
+{   // convert 'percent-encoded' characters to ASCII/UTF-8 in the same string
+// These 'Reserved Characters' pursuant to RFC 3986 must be decoded
+// SPC  !   #   $   %   &   '   (   )   *   +   ,   /   :   ;   =   ?   @   [   ]
+// %20 %21 %23 %24 %25 %26 %27 %28 %29 %2A %2B %2C %2F %3A %3B %3D %3F %40 %5B %5D
+//
+// fast hex-to-nibble conversion table
+static unsigned char const H2N [256] =    // upper half all 0
+//  0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15
+  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0, 	// 0..9
+    0,10,11,12,13,14,15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 	// A..F
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 	//
+    0,10,11,12,13,14,15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 	// a..f
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+size_t len = strlen(astr);
+size_t i = kern_findchr(astr, len, '%');
+if (i == len)   { return(1); }      // nothing encoded, the common case
+size_t j = i;
+unsigned char a = 0;
+while (i < len)     // astr[i] is a 'percent-encoding'
+    {
+        // get byte value from two consecutive ascii hex digits
+        i++;
+        a = 0;
+        if (i < len) { a =     H2N[ (unsigned char)astr[i] ]  << 4 ;   i++; }
+        if (i < len) { a = a + H2N[ (unsigned char)astr[i] ]  ;        i++; }
+        astr[j++] = a;
+
+        // move the clean run up to the next '%' in one piece
+        size_t run = kern_findchr(astr + i, len - i, '%');
+        memmove(astr + j, astr + i, run);
+        i += run;
+        j += run;
+    }
+astr[j] = 0;
+return(1);
+}
+
+void backslashestoslashes(char *pathstring)
+{
+kern_replacechr(pathstring, strlen(pathstring), 92, 47);
+return;
+}
+
+void slashestobackslashes(char *pathstring)
+{
+kern_replacechr(pathstring, strlen(pathstring), 47, 92);
+return;
+}
+
+int check_file_exist(char *filepath)
+{
+#ifdef _WIN32
+    slashestobackslashes(filepath);
+    FILE *fp = fopen(filepath, "rb");
+    backslashestoslashes(filepath);
+    if (fp == NULL)     { return(0) ; }
+    if (fclose(fp)!=0)  { return(0) ; }
+#else
+    FILE *fp = fopen(filepath, "rb");
+    if (fp == NULL)     { return(0) ; }
+    if (fclose(fp)!=0)  { return(0) ; }
+#endif
+return(1);
+}
+
+int get_only_filepath(char *pathname, char *fullpath)
+{   // extract path only portion of a full path including last slash
+int i = 0;
+// copy fullpath[] to pathname[]
+while (fullpath[i] != 0) { pathname[i] = fullpath[i]; i++; }
+pathname[i] = 0;
+// find last pathseparator
+while (i > 0)
+    {   i--;
+        if ( (pathname[i] == 47) || (pathname[i] == 92)) { break; };
+    }
+// catch no-path condition, replace with current directory path
+if (i == 0)  {  pathname[0] = 0;    }   else    {   pathname[++i] = 0;  }
+return(1);
+}
+
+int get_only_filename(char *filename, char *fullpath)
+{   // extract filename portion of fullpath string,
+    // regardless of slashes or backslashes
+int i = 0;
+int j = 0;
+// find to end of string
+while (fullpath[i] != 0) { i++; }
+// find last pathseparator
+while (i > 0)
+    {
+        i--;
+        if ( (fullpath[i] == 47) || (fullpath[i] == 92)) { break; };
+    }
+// catch no-path condition
+if (i > 0) { i++; }
+while (fullpath[i] != 0)    { filename[j++] = fullpath[i++]; }
+filename[j] = 0;
+return(1);
+}
+
+// -----------------------------------------------------------------------------
+// PLAYLIST DISCOVERY
+//
+// A discovery is an explicit iterator object without hidden statics, so any
+// number of them may run at a time. On Unix folders are read natively in the
+// order 'find' used to deliver (pre-order, readdir order), without a depth
+// limit; symbolic links to folders are not followed. Windows still pipes the
+// output of 'dir'.
+//
+// m3uiter_open() : submit start path; recurse = (1) searches the whole tree
+//                  for *.m3u and *.m3u8, recurse = (0) searches the folder
+//                  of the path for the file(s) matching its filename part
+// m3uiter_next() : deliver path of next playlist found and return (1),
+//                  return (0) when there are no more
+// m3uiter_close(): release the iterator, also after an early stop
+
+struct m3ulevel
+{   // one folder on the way down, read completely when entered
+    char *names;            // entry names, subfolders marked by trailing '/'
+    size_t used, size;
+    size_t pos;             // next name to deliver
+    int pathlen;            // length of the folder path in iterator path
+};
+
+struct m3uiter
+{
+    int recurse;            // (1) descend into subfolders
+    char pattern[PATHMAX];  // filename pattern in single folder mode
+    char path[PATHMAX];     // path of the folder currently looked at
+#ifdef UNIXES
+    struct m3ulevel *levels;    // folders from start folder down to current
+    int depth, alloc;
+#else
+    FILE *fp;               // piped 'dir' command
+    int ictr;
+    unsigned int aplen;
+#endif
+};
+
+#ifdef UNIXES
+
+int m3u_namematch(struct m3uiter *it, char *name)
+{   // does a filename qualify as playlist?
+if (it->recurse)
+    {   return( (fnmatch("*.m3u", name, FNM_CASEFOLD) == 0) ||
+                (fnmatch("*.m3u8", name, FNM_CASEFOLD) == 0) );    }
+return(fnmatch(it->pattern, name, FNM_CASEFOLD) == 0);
+}
+
+int m3u_pushfolder(struct m3uiter *it)
+{   // enter folder it->path (with trailing slash) and read all entries that
+    // are playlists or, in recursive mode, subfolders
+    // return (0) when the folder cannot be read
+if (it->depth == it->alloc)
+    {
+        int n = (it->alloc == 0) ? 16 : it->alloc * 2;
+        struct m3ulevel *l = realloc(it->levels, n * sizeof(struct m3ulevel));
+        if (l == NULL) { return(0); }
+        it->levels = l; it->alloc = n;
+    }
+struct m3ulevel *lv = &it->levels[it->depth];
+lv->names = NULL; lv->used = 0; lv->size = 0; lv->pos = 0;
+lv->pathlen = strlength(it->path);
+
+DIR *dp = opendir((lv->pathlen > 0) ? it->path : "."); if (dp == NULL) { return(0); }
+struct dirent *de;
+while ((de = readdir(dp)) != NULL)
+    {
+        char *name = de->d_name;
+        if ((name[0] == '.') && ((name[1] == 0) || ((name[1] == '.') && (name[2] == 0)))) { continue; }
+
+        int namelen = strlength(name);
+        if (lv->pathlen + namelen + 2 >= PATHMAX)   { continue; }
+
+        int type = de->d_type;
+        if ((type == DT_UNKNOWN) || (type == DT_LNK))
+            {   // ask explicitly; links count as playlists, never as folders
+                struct stat st;
+                strcpy(it->path + lv->pathlen, name);
+                if ((type == DT_UNKNOWN) && (lstat(it->path, &st) == 0) && S_ISDIR(st.st_mode))    { type = DT_DIR; }
+                else if ((stat(it->path, &st) == 0) && S_ISREG(st.st_mode))                         { type = DT_REG; }
+                it->path[lv->pathlen] = 0;
+            }
+
+        int isdir = ((type == DT_DIR) && it->recurse);
+        if (!isdir && ((type != DT_REG) || !m3u_namematch(it, name)))  { continue; }
+
+        if (lv->used + namelen + 2 > lv->size)
+            {
+                size_t n = (lv->size == 0) ? 4096 : lv->size * 2;
+                while (lv->used + namelen + 2 > n) { n = n * 2; }
+                char *p = realloc(lv->names, n);
+                if (p == NULL) { break; }
+                lv->names = p; lv->size = n;
+            }
+        memcpy(lv->names + lv->used, name, namelen);
+        lv->used += namelen;
+        if (isdir) { lv->names[lv->used++] = '/'; }
+        lv->names[lv->used++] = 0;
+    }
+closedir(dp);
+it->depth++;
+return(1);
+}
+
+int m3uiter_open(struct m3uiter *it, char *startpath, int recurse)
+{   // start discovery, return (0) when the start folder cannot be read
+it->recurse = recurse;
+it->levels = NULL;
+it->depth = 0;
+it->alloc = 0;
+it->pattern[0] = 0;
+if (recurse)
+    {   sprintf(it->path, "%s", startpath); }
+else
+    {
+        char filepath[PATHMAX];
+        sprintf(filepath, "%s", startpath);
+        if  (   (strrightcomp(filepath, ".m3u") == 0) &&
+                (strrightcomp(filepath, ".m3u8") == 0)      )
+            {
+                strappendsafe(filepath, PATHMAX, SLASH);
+                strappendsafe(filepath, PATHMAX, "*.m3u");
+            }
+        get_only_filepath(it->path, filepath);
+        get_only_filename(it->pattern, filepath);
+    }
+if ((it->path[0] != 0) && !strrightcomp(it->path, "/")) { strappendsafe(it->path, PATHMAX - 1, "/"); }
+return(m3u_pushfolder(it));
+}
+
+int m3uiter_next(struct m3uiter *it, char *pathfilenamestr)
+{   // deliver next playlist path into pathfilenamestr (PATHMAX characters)
+while (it->depth > 0)
+    {
+        struct m3ulevel *lv = &it->levels[it->depth - 1];
+        if (lv->pos >= lv->used)
+            {   // folder done, back up one level
+                free(lv->names);
+                it->depth--;
+                continue;
+            }
+        char *name = lv->names + lv->pos;
+        lv->pos += strlength(name) + 1;
+        it->path[lv->pathlen] = 0;
+
+        if (strrightcomp(name, "/"))
+            {   // descend right away, as 'find' does
+                strcpy(it->path + lv->pathlen, name);
+                if (!m3u_pushfolder(it)) { it->path[lv->pathlen] = 0; }
+                continue;
+            }
+        sprintf(pathfilenamestr, "%s%s", it->path, name);
+        return(1);
+    }
+pathfilenamestr[0] = 0;
+return(0);
+}
+
+void m3uiter_close(struct m3uiter *it)
+{
+while (it->depth > 0) { free(it->levels[--it->depth].names); }
+free(it->levels);
+it->levels = NULL;
+it->alloc = 0;
+return;
+}
+
+#else
+
+int m3uiter_open(struct m3uiter *it, char *startpath, int recurse)
+{   // WINDOWS: launch 'dir' in recursive subdirectory mode to get absolute paths
+char cmdstr[PATHMAX] = "";
+it->recurse = recurse;
+it->ictr = 0;
+it->aplen = 0;
+sprintf(it->path, "%s", startpath);
+slashestobackslashes(it->path);
+if (recurse)
+    {   sprintf (cmdstr, "dir /B /S /ON \"%s*.m3u?\" 2>&1", it->path);  }
+else
+    {
+        if  (   (strrightcomp(it->path, ".m3u") == 0) &&
+                (strrightcomp(it->path, ".m3u8") == 0)      )
+            {
+                strappendsafe(it->path, PATHMAX, SLASH);
+                strappendsafe(it->path, PATHMAX, "*.m3u");
+            }
+        sprintf (cmdstr, "dir /B /S /ON \"%s\" 2>&1", it->path);
+    }
+it->fp = popen(cmdstr, "r");
+return(it->fp != NULL);
+}
+
+int m3uiter_next(struct m3uiter *it, char *pathfilenamestr)
+{   // WINDOWS: deliver next line of 'dir' output with forward slashes
+if (it->fp == NULL) { pathfilenamestr[0] = 0; return(0); }
+it->ictr++;
+if (fgets(pathfilenamestr, PATHMAX, it->fp) == NULL) { pathfilenamestr[0] = 0; return(0); }
+
+strlinetrim(pathfilenamestr);
+backslashestoslashes(pathfilenamestr);
+
+// detect general error by absence of path separators
+if (!strfindchr(pathfilenamestr,'/'))   { pathfilenamestr[0] = 0; return(0); }
+if (!strfindchr(pathfilenamestr,':'))   { pathfilenamestr[0] = 0; return(0); }
+
+if (!it->recurse)
+    {
+        // when 'dir' in recursive mode will dive into any subdirectories,
+        // suppress further lines when absolute path without filename grows longer
+        unsigned int i = 0;
+        if (it->ictr == 1) // run once
+            {   it->aplen = 0; while (pathfilenamestr[it->aplen] != 0)     { it->aplen++; }
+                while (it->aplen > 0) {   it->aplen--; if (pathfilenamestr[it->aplen] == 47) { break; } ; }
+            }
+        i = 0; while (pathfilenamestr[i] != 0)     { i++; }
+        while (i > 0)       { i--; if (pathfilenamestr[i] == 47) { break; } ;  }
+        if ( i > it->aplen )    { pathfilenamestr[0] = 0; return(0); }
+    }
+
+if (pathfilenamestr[0] == 0)    { return(0); }
+return(1);
+}
+
+void m3uiter_close(struct m3uiter *it)
+{
+if (it->fp != NULL) { pclose(it->fp); it->fp = NULL; }
+return;
+}
+
+#endif
+
+
+int remove_protocol_and_drive_letters(char *sourcestr)
+{   // search rightmost ':' character in a path, which may indicate protocol
+    // prefix or drive letter, and remove all of them
+    // return (1) when string was modified
+    // return (0) when string was left untouched
+
+if (sourcestr[0] == 0)  { return (0); }
+// get position of a ':', search from the right of string
+char *colon = strrchr(sourcestr, ':');
+if ((colon == NULL) || (colon == sourcestr)) { return(0); }  // no occurrence of ':', leave
+// now shift string to the left
+memmove(sourcestr, colon + 1, strlen(colon + 1) + 1);
+return(0);
+}
+
+
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// SEARCH FOLDERS
+//
+// All search methods look outward from the playlist folder: the playlist folder
+// is level 0, its parent level 1 and so on up to the search radius of the
+// context (RELM3U_RADIUS unless set by relm3u_set_radius()). A nearer level
+// always wins, the first level holding the file ends the search.
+
+#define PROBELEVELS   (RELM3U_MAXRADIUS + 1)    // levels at most
+
+char *updir_prefix(char *ups, int updir)
+{   // '../' updir times, "" for the playlist folder itself
+    // ups holds 3 * PROBELEVELS + 1 characters
+int k = 0;
+for (k = 0; k < updir; k++) { memcpy(ups + 3 * k, "../", 3); }
+ups[3 * k] = 0;
+return(ups);
+}
+
+// -----------------------------------------------------------------------------
+// PROBING THROUGH DIRECTORY HANDLES (UNIX)
+//
+// Search method 1 tests every path suffix of an entry below each search
+// folder. Instead of opening each candidate by its full path, the search
+// folders are opened once per playlist and candidates are tested relative to
+// these handles. Folders met on the way are remembered per context as present
+// or missing, keyed by device/inode of the handle folder, so candidates below a
+// folder already known to be missing cost no syscall at all.
+
+struct probedirs
+{   // folder handles of one playlist, -1 where not available (Unix only)
+    int nlevels;            // search folders, the radius of the context + 1
+    int fd[PROBELEVELS];
+    unsigned long long dev[PROBELEVELS];
+    unsigned long long ino[PROBELEVELS];
+};
+
+void probedirs_init(struct probedirs *pd, int nlevels)
+{   // no folder handles yet
+pd->nlevels = nlevels;
+int level = 0;
+for (level = 0; level < PROBELEVELS; level++) { pd->fd[level] = -1; }
+return;
+}
+
+#ifdef UNIXES
+#define PROBEUNKNOWN  0
+#define PROBEPRESENT  1
+#define PROBEMISSING  2
+
+struct probeslot
+{
+    uint32_t hash;
+    int state;
+    char *key;              // NULL = empty slot
+};
+
+void probedirs_open(struct probedirs *pd, char *pllpath, int nlevels)
+{   // open playlist folder and nlevels - 1 of its ancestors as probing bases
+char levelpath[PATHMAX + 3 * PROBELEVELS + 1];
+char ups[3 * PROBELEVELS + 1];
+probedirs_init(pd, nlevels);
+int level = 0;
+for (level = 0; level < nlevels; level++)
+    {
+        // an empty playlist path refers to the current directory
+        sprintf(levelpath, "%s%s", (pllpath[0] == 0) ? "./" : pllpath, updir_prefix(ups, level));
+
+        struct stat st;
+        pd->fd[level] = open(levelpath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if ((pd->fd[level] >= 0) && (fstat(pd->fd[level], &st) != 0))
+            {   close(pd->fd[level]); pd->fd[level] = -1;   }
+        if (pd->fd[level] >= 0) { pd->dev[level] = st.st_dev; pd->ino[level] = st.st_ino; }
+    }
+return;
+}
+
+void probedirs_close(struct probedirs *pd)
+{
+int level = 0;
+for (level = 0; level < pd->nlevels; level++)
+    {   if (pd->fd[level] >= 0) { close(pd->fd[level]); pd->fd[level] = -1; }   }
+return;
+}
+
+uint32_t probecache_hash(char *key)
+{   // FNV-1a over the whole key
+uint32_t h = 2166136261u;
+while (*key) { h = (h ^ (unsigned char)*key++) * 16777619u; }
+return(h);
+}
+
+int probecache_get(relm3u_ctx *ctx, char *key, uint32_t h)
+{   // deliver remembered state of a folder
+int state = PROBEUNKNOWN;
+pthread_rwlock_rdlock(&ctx->probelock);
+if (ctx->probesize > 0)
+    {
+        uint32_t i = h & (ctx->probesize - 1);
+        while (ctx->probecache[i].key != NULL)
+            {
+                if ((ctx->probecache[i].hash == h) && strcomp(ctx->probecache[i].key, key)) { state = ctx->probecache[i].state; break; }
+                i = (i + 1) & (ctx->probesize - 1);
+            }
+    }
+pthread_rwlock_unlock(&ctx->probelock);
+return(state);
+}
+
+void probecache_put(relm3u_ctx *ctx, char *key, uint32_t h, int state)
+{   // remember state of a folder, silently forget it when out of memory
+pthread_rwlock_wrlock(&ctx->probelock);
+if (2 * (ctx->probeused + 1) > ctx->probesize)
+    {   // keep the table at most half full
+        uint32_t n = (ctx->probesize == 0) ? 4096 : ctx->probesize * 2;
+        struct probeslot *t = calloc(n, sizeof(struct probeslot));
+        if (t == NULL) { pthread_rwlock_unlock(&ctx->probelock); return; }
+        uint32_t i = 0;
+        for (i = 0; i < ctx->probesize; i++)
+            {
+                if (ctx->probecache[i].key == NULL) { continue; }
+                uint32_t j = ctx->probecache[i].hash & (n - 1);
+                while (t[j].key != NULL) { j = (j + 1) & (n - 1); }
+                t[j] = ctx->probecache[i];
+            }
+        free(ctx->probecache);
+        ctx->probecache = t;
+        ctx->probesize = n;
+    }
+uint32_t i = h & (ctx->probesize - 1);
+while (ctx->probecache[i].key != NULL)
+    {
+        if ((ctx->probecache[i].hash == h) && strcomp(ctx->probecache[i].key, key))
+            {   ctx->probecache[i].state = state; pthread_rwlock_unlock(&ctx->probelock); return;  }
+        i = (i + 1) & (ctx->probesize - 1);
+    }
+ctx->probecache[i].key = strdup(key);
+if (ctx->probecache[i].key != NULL)
+    {   ctx->probecache[i].hash = h; ctx->probecache[i].state = state; ctx->probeused++;  }
+pthread_rwlock_unlock(&ctx->probelock);
+return;
+}
+
+void probecache_free(relm3u_ctx *ctx)
+{
+uint32_t i = 0;
+for (i = 0; i < ctx->probesize; i++) { free(ctx->probecache[i].key); }
+free(ctx->probecache);
+ctx->probecache = NULL;
+ctx->probesize = 0;
+ctx->probeused = 0;
+return;
+}
+
+int probe_relative(relm3u_ctx *ctx, struct probedirs *pd, int level, char *relpath)
+{   // test for a readable file (or folder) relpath below the level folder,
+    // which is what fopen() in check_file_exist() used to tell
+    // return (1) when it exists, (0) otherwise
+int fd = pd->fd[level];
+if (fd < 0) { return(0); }
+// leading slashes (entries such as 'file:////x') stay below the level folder,
+// as they did with the playlist path put in front
+while (relpath[0] == '/') { relpath++; }
+if (relpath[0] == 0) { return(faccessat(fd, ".", R_OK, 0) == 0); }
+
+// key prefix identifies the level folder independent of how it was named
+char key[PATHMAX + 64];
+int keylen = sprintf(key, "%llx:%llx:", pd->dev[level], pd->ino[level]);
+int rellen = strlength(relpath);
+if (keylen + rellen >= (int)sizeof(key)) { return(faccessat(fd, relpath, R_OK, 0) == 0); }
+memcpy(key + keylen, relpath, rellen + 1);
+
+// walk down the folders of relpath, each one is looked at once per context
+int i = 0;
+for (i = 0; i < rellen; i++)
+    {
+        if ((relpath[i] != '/') || (i == 0)) { continue; }
+        key[keylen + i] = 0;
+        uint32_t h = probecache_hash(key);
+        int state = probecache_get(ctx, key, h);
+        if (state == PROBEUNKNOWN)
+            {
+                struct stat st;
+                relpath[i] = 0;
+                int r = fstatat(fd, relpath, &st, 0);
+                int err = errno;
+                relpath[i] = '/';
+                if ((r == 0) && S_ISDIR(st.st_mode))        { state = PROBEPRESENT; }
+                else if ((r == 0) || (err == ENOENT) || (err == ENOTDIR))  { state = PROBEMISSING; }
+                if (state != PROBEUNKNOWN)  { probecache_put(ctx, key, h, state); }
+            }
+        key[keylen + i] = '/';
+        if (state == PROBEMISSING)  { return(0); }
+    }
+return(faccessat(fd, relpath, R_OK, 0) == 0);
+}
+
+#endif
+
+int path_normalise(char *path)
+{   // collapse '//', '/./' and 'folder/../' of a path lexically, in place
+    // return (0) when '..' climbs above the start of a relative path
+int i = 0;
+int j = 0;
+int absolute = (path[0] == '/');
+if (absolute) { i = 1; j = 1; }
+while (path[i] != 0)
+    {
+        int k = i; while ((path[k] != 0) && (path[k] != '/')) { k++; }
+        int len = k - i;
+        if ((len == 0) || ((len == 1) && (path[i] == '.'))) {}
+        else if ((len == 2) && (path[i] == '.') && (path[i + 1] == '.'))
+            {   // drop the last component written so far
+                if (j > absolute)
+                    {   j--; while ((j > absolute) && (path[j - 1] != '/')) { j--; }   }
+                else if (!absolute) { return(0); }
+            }
+        else
+            {
+                memmove(path + j, path + i, len);
+                j += len;
+                path[j++] = '/';
+            }
+        i = (path[k] == 0) ? k : k + 1;
+    }
+if (j > absolute) { j--; }
+path[j] = 0;
+return(1);
+}
+
+void probe_prepare(char *pathfilename)
+{   // bring an entry into the shape search method 1 walks its suffixes in:
+    // leading './' removed, leading '/' added (for loop convenience)
+
+// remove one or more leading './' from pathfilename
+while (strlefttrim(pathfilename, "./")) {};
+
+// add leading '/' to relative path
+int i = strlength(pathfilename);
+if (pathfilename[0] != '/')
+    {   pathfilename[++i] = 0;
+        // shift characters backwards
+        while (i > 0) { pathfilename[i] = pathfilename[i-1]; i--; }
+        pathfilename[0] = '/';
+    }
+return;
+}
+
+void probe_found(char *pathfilename, char *pllpath, int updir, char *suffix)
+{   // the entry was found as suffix, updir levels above the playlist folder:
+    // deliver the relative path to it in pathfilename
+char probepath[2 * PATHMAX + 3 * PROBELEVELS + 1];
+char ups[3 * PROBELEVELS + 1];
+sprintf(probepath, "%s%s%s", pllpath, updir_prefix(ups, updir), suffix);
+
+// remove prepended playlist path
+strlefttrim(probepath, pllpath);
+
+// compose complete relative path, cut to PATHMAX
+int lead = strleftcomp(probepath, "../") ? 0 : 2;
+int len = strlength(probepath);
+if (lead + len >= PATHMAX) { len = PATHMAX - 1 - lead; }
+memcpy(pathfilename, "./", lead);
+memcpy(pathfilename + lead, probepath, len);
+pathfilename[lead + len] = 0;
+return;
+}
+
+// SEARCH METHOD 1 LINUX & WINDOWS
+int find_relpath_by_pathprobing(relm3u_ctx *ctx, char *pathfilename, char *pllpath, struct probedirs *pd, struct relm3u_stats *ps)
+{   // SEARCH METHOD 1: probe promising paths, deliver relative path
+    // on Unix candidates are tested relative to the folder handles in pd
+    // probes are counted in ps
+    // return (1) on success, return (0) on failure (file not found)
+
+// puts ("PATHPROBING");
+
+char *pathfilename_restore = pathfilename;  // original pointer to pathfilename
+
+probe_prepare(pathfilename);
+
+int updir = 0;
+while (updir < pd->nlevels)
+    {
+        // restore *pointer to start of pathfilename
+        pathfilename = pathfilename_restore;
+
+        while (*pathfilename != 0)
+            {
+                // skip to next directory level
+                if (*pathfilename != '/') { pathfilename++; continue; }
+                pathfilename++ ;
+
+                // test probe path
+                #ifdef UNIXES
+                int exists = probe_relative(ctx, pd, updir, pathfilename);
+                #else
+                char probepath[2 * PATHMAX + 3 * PROBELEVELS + 1];
+                char ups[3 * PROBELEVELS + 1];
+                sprintf(probepath, "%s%s%s", pllpath, updir_prefix(ups, updir), pathfilename);
+                int exists = check_file_exist(probepath);
+                #endif
+                int level = (updir < RELM3U_STATLEVELS) ? updir : RELM3U_STATLEVELS - 1;
+                stats_add(&ps->probes[level], 1);
+                if (exists)
+                    {
+                        stats_add(&ps->probe_hits[level], 1);
+                        probe_found(pathfilename_restore, pllpath, updir, pathfilename);
+                        return(1);
+                    }
+            }
+        updir++;
+    }
+// failed to find path, return original submitted path
+return(0);
+}
+
+// -----------------------------------------------------------------------------
+// PROBE BATCHES (LINUX)
+//
+// Probing one line after the other pays the latency of the storage once per
+// candidate, which on network storage is where the time goes. Lines are
+// therefore resolved PROBEBATCH at a time: all candidates of a batch, every
+// suffix on every level, are generated up front and handed to io_uring as one
+// set of statx operations. The winner of a line is then picked in the order
+// search method 1 tests its candidates: those statx found missing are passed
+// over, a file or folder statx found is taken, anything else is confirmed by
+// probe_relative() as before. Where io_uring cannot be set up (kernel before
+// 5.6, seccomp) lines are probed one by one. The ring is set up by hand,
+// liburing is not needed; rings are kept with the context, one per thread
+// probing at a time, and taken down by relm3u_close().
+
+#define PROBEBATCH  32      // lines resolved at once
+#define PROBERING   256     // submission queue entries
+
+#ifdef PROBEURING
+struct probering
+{   // io_uring with a statx buffer per submission queue entry
+    struct probering *next;     // in the list of rings not in use
+    int fd;
+    struct io_uring_params p;
+    unsigned char *sq, *cq;     // mapped rings, the same with single mmap
+    size_t sqsize, cqsize;
+    struct io_uring_sqe *sqes;
+    size_t sqesize;
+    struct statx *bufs;
+};
+
+void probering_close(struct probering *r)
+{
+if (r->sqes != NULL) { munmap(r->sqes, r->sqesize); }
+if ((r->cq != NULL) && (r->cq != r->sq)) { munmap(r->cq, r->cqsize); }
+if (r->sq != NULL) { munmap(r->sq, r->sqsize); }
+if (r->fd >= 0) { close(r->fd); }
+free(r->bufs);
+return;
+}
+
+int probering_open(struct probering *r)
+{   // return (1) when the ring is ready, (0) when io_uring is not available
+memset(r, 0, sizeof(*r));
+r->fd = (int)syscall(__NR_io_uring_setup, PROBERING, &r->p);
+if (r->fd < 0) { return(0); }
+r->sqsize = r->p.sq_off.array + r->p.sq_entries * sizeof(unsigned);
+r->cqsize = r->p.cq_off.cqes + r->p.cq_entries * sizeof(struct io_uring_cqe);
+if (r->p.features & IORING_FEAT_SINGLE_MMAP)
+    {   if (r->cqsize > r->sqsize) { r->sqsize = r->cqsize; }   }
+r->sq = mmap(NULL, r->sqsize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+if (r->sq == MAP_FAILED) { r->sq = NULL; probering_close(r); return(0); }
+if (r->p.features & IORING_FEAT_SINGLE_MMAP) { r->cq = r->sq; }
+else
+    {
+        r->cq = mmap(NULL, r->cqsize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+        if (r->cq == MAP_FAILED) { r->cq = NULL; probering_close(r); return(0); }
+    }
+r->sqesize = r->p.sq_entries * sizeof(struct io_uring_sqe);
+r->sqes = mmap(NULL, r->sqesize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+if (r->sqes == MAP_FAILED) { r->sqes = NULL; probering_close(r); return(0); }
+r->bufs = malloc(r->p.sq_entries * sizeof(struct statx));
+if (r->bufs == NULL) { probering_close(r); return(0); }
+return(1);
+}
+
+struct probering *probering_take(relm3u_ctx *ctx)
+{   // a ring not in use, set up when there is none
+    // return NULL when io_uring is not available
+struct probering *r = NULL;
+pthread_mutex_lock(&ctx->ringlock);
+r = ctx->rings;
+if (r != NULL) { ctx->rings = r->next; }
+pthread_mutex_unlock(&ctx->ringlock);
+if (r != NULL) { return(r); }
+r = malloc(sizeof(struct probering));
+if (r == NULL) { return(NULL); }
+if (!probering_open(r)) { free(r); return(NULL); }
+return(r);
+}
+
+void probering_give(relm3u_ctx *ctx, struct probering *r)
+{   // the ring is not in use any more, keep it for the next batch
+pthread_mutex_lock(&ctx->ringlock);
+r->next = ctx->rings;
+ctx->rings = r;
+pthread_mutex_unlock(&ctx->ringlock);
+return;
+}
+
+void probering_free_all(relm3u_ctx *ctx)
+{
+while (ctx->rings != NULL)
+    {
+        struct probering *r = ctx->rings;
+        ctx->rings = r->next;
+        probering_close(r);
+        free(r);
+    }
+return;
+}
+
+int probering_statx(struct probering *r, int *dirfd, char **path, int *res, unsigned *mode, int n)
+{   // statx path[i] relative to dirfd[i] for up to sq_entries paths at once,
+    // res[i] = 0 when it exists, with its stx_mode in mode[i], -errno otherwise
+    // return (0) when the ring failed, res[] not delivered is left alone
+unsigned *sqtail = (unsigned *)(r->sq + r->p.sq_off.tail);
+unsigned *sqarray = (unsigned *)(r->sq + r->p.sq_off.array);
+unsigned sqmask = *(unsigned *)(r->sq + r->p.sq_off.ring_mask);
+unsigned *cqhead = (unsigned *)(r->cq + r->p.cq_off.head);
+unsigned *cqtail = (unsigned *)(r->cq + r->p.cq_off.tail);
+unsigned cqmask = *(unsigned *)(r->cq + r->p.cq_off.ring_mask);
+struct io_uring_cqe *cqes = (struct io_uring_cqe *)(r->cq + r->p.cq_off.cqes);
+
+unsigned tail = *sqtail;
+int i = 0;
+for (i = 0; i < n; i++)
+    {
+        unsigned slot = (tail + i) & sqmask;
+        struct io_uring_sqe *sqe = &r->sqes[slot];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_STATX;
+        sqe->fd = dirfd[i];
+        sqe->addr = (unsigned long)path[i];
+        sqe->len = STATX_TYPE;
+        sqe->off = (unsigned long)&r->bufs[slot];
+        sqe->user_data = i;
+        sqarray[slot] = slot;
+    }
+__atomic_store_n(sqtail, tail + n, __ATOMIC_RELEASE);
+
+int submitted = 0;
+int completed = 0;
+while (completed < n)
+    {
+        int ret = (int)syscall(__NR_io_uring_enter, r->fd, n - submitted, n - completed, IORING_ENTER_GETEVENTS, NULL, 0);
+        if ((ret < 0) && (errno != EINTR)) { return(0); }
+        if (ret > 0) { submitted += ret; }
+        unsigned head = *cqhead;
+        while (head != __atomic_load_n(cqtail, __ATOMIC_ACQUIRE))
+            {
+                struct io_uring_cqe *cqe = &cqes[head & cqmask];
+                if (cqe->user_data < (unsigned long long)n)
+                    {
+                        int j = (int)cqe->user_data;
+                        res[j] = cqe->res;
+                        mode[j] = r->bufs[(tail + j) & sqmask].stx_mode;
+                        completed++;
+                    }
+                head++;
+            }
+        __atomic_store_n(cqhead, head, __ATOMIC_RELEASE);
+    }
+return(1);
+}
+
+struct probecand
+{   // one candidate of search method 1
+    int line;               // the line it is a candidate of
+    int level;              // search folder, see SEARCH FOLDERS
+    char *suffix;           // within the line
+    int res;                // statx result, 1 while not asked
+    unsigned mode;          // stx_mode when res is 0
+};
+
+int probe_batch(relm3u_ctx *ctx, char **lines, int n, int *found, char *pllpath, struct probedirs *pd, struct relm3u_stats *ps)
+{   // search method 1 for n lines, all candidates tested by io_uring at once
+    // found[i] = (1) when lines[i] was found, lines[i] = relative path then
+    // return (0) when io_uring is not available (lines left alone)
+if (__atomic_load_n(&ctx->nouring, __ATOMIC_RELAXED)) { return(0); }
+struct probering *r = probering_take(ctx);
+if (r == NULL)
+    {   __atomic_store_n(&ctx->nouring, 1, __ATOMIC_RELAXED); return(0);   }
+
+// candidates in the order search method 1 tests them, line by line
+int ncands = 0;
+int i = 0;
+for (i = 0; i < n; i++)
+    {
+        probe_prepare(lines[i]);
+        char *c = lines[i];
+        for (; *c != 0; c++) { if (*c == '/') { ncands += pd->nlevels; } }
+    }
+struct probecand *cands = malloc((ncands + 1) * sizeof(struct probecand));
+int *dirfd = malloc((r->p.sq_entries + 1) * sizeof(int));
+char **path = malloc((r->p.sq_entries + 1) * sizeof(char *));
+int *res = malloc((r->p.sq_entries + 1) * sizeof(int));
+unsigned *mode = malloc((r->p.sq_entries + 1) * sizeof(unsigned));
+int *which = malloc((r->p.sq_entries + 1) * sizeof(int));
+if ((cands == NULL) || (dirfd == NULL) || (path == NULL) || (res == NULL) || (mode == NULL) || (which == NULL))
+    {
+        free(cands); free(dirfd); free(path); free(res); free(mode); free(which);
+        probering_give(ctx, r);
+        return(0);
+    }
+int k = 0;
+for (i = 0; i < n; i++)
+    {
+        int level = 0;
+        for (level = 0; level < pd->nlevels; level++)
+            {
+                char *c = lines[i];
+                for (; *c != 0; c++)
+                    {
+                        if (*c != '/') { continue; }
+                        cands[k].line = i;
+                        cands[k].level = level;
+                        cands[k].suffix = c + 1;
+                        cands[k].res = (pd->fd[level] < 0) ? -ENOENT : 1;
+                        k++;
+                    }
+            }
+    }
+
+// one submission per ring full, leading slashes stay below the level folder
+int m = 0;
+int ok = 1;
+for (k = 0; k <= ncands; k++)
+    {
+        if ((m == (int)r->p.sq_entries) || ((k == ncands) && (m > 0)))
+            {
+                int j = 0;
+                for (j = 0; j < m; j++) { res[j] = 1; mode[j] = 0; }
+                stats_add(&ps->probe_batches, 1);
+                ok = probering_statx(r, dirfd, path, res, mode, m);
+                for (j = 0; j < m; j++) { cands[which[j]].res = res[j]; cands[which[j]].mode = mode[j]; }
+                m = 0;
+                if (!ok) { break; }     // the rest is probed as before
+            }
+        if ((k == ncands) || (cands[k].res != 1)) { continue; }
+        char *rel = cands[k].suffix;
+        while (rel[0] == '/') { rel++; }
+        dirfd[m] = pd->fd[cands[k].level];
+        path[m] = (rel[0] == 0) ? "." : rel;
+        which[m] = k;
+        m++;
+    }
+// a ring that failed may still hold submissions, it is not used again
+if (ok) { probering_give(ctx, r); }
+else    { probering_close(r); free(r); }
+
+// winner per line: the first candidate statx did not find missing, taken when
+// statx found a file or folder, else when probe_relative() confirms it;
+// probes counted as if tested one by one
+for (i = 0; i < n; i++) { found[i] = 0; }
+int done = -1;
+for (k = 0; k < ncands; k++)
+    {
+        struct probecand *c = &cands[k];
+        if (c->line == done) { continue; }
+        int level = (c->level < RELM3U_STATLEVELS) ? c->level : RELM3U_STATLEVELS - 1;
+        stats_add(&ps->probes[level], 1);
+        if ((c->res == -ENOENT) || (c->res == -ENOTDIR)) { continue; }
+        int hit = (c->res == 0) && (S_ISREG(c->mode) || S_ISDIR(c->mode));
+        if (!hit && !probe_relative(ctx, pd, c->level, c->suffix)) { continue; }
+        stats_add(&ps->probe_hits[level], 1);
+        probe_found(lines[c->line], pllpath, c->level, c->suffix);
+        found[c->line] = 1;
+        done = c->line;
+    }
+free(cands); free(dirfd); free(path); free(res); free(mode); free(which);
+return(1);
+}
+#endif
+
+void probe_lines(relm3u_ctx *ctx, char **lines, int n, int *found, char *pllpath, struct probedirs *pd, struct relm3u_stats *ps)
+{   // search method 1 for n lines, found[i] as find_relpath_by_pathprobing()
+    // would return it for lines[i]
+#ifdef PROBEURING
+if ((n > 1) && probe_batch(ctx, lines, n, found, pllpath, pd, ps)) { return; }
+#endif
+int i = 0;
+for (i = 0; i < n; i++) { found[i] = find_relpath_by_pathprobing(ctx, lines[i], pllpath, pd, ps); }
+return;
+}
+
+// SEARCH METHOD 2 for LINUX
+#ifdef UNIXES
+int shell_search_unix(char *dirlinestr, char *pathpatstr, char *searchfile, char *prunestr)
+{   // LINUX: outputs first file found in path (forward search)
+    // pathpatstr is the reference path
+    // searchfile is the filename to search for
+    // prunestr is a folder below pathpatstr left out (-path pattern), or NULL
+    // returns (1) on success;      dirlinestr = fullpath+filename+extension
+    // returns (0) no entry found;  dirlinestr = ""
+FILE *fp;
+char cmdstr[3 * PATHMAX] = "";
+if (prunestr != NULL)
+    {   sprintf (cmdstr, "find \"%s\" -maxdepth 7 -path \"%s\" -prune -o -iname \"%s\" -type f -print 2>&1", pathpatstr, prunestr, searchfile);   }
+else
+    {   sprintf (cmdstr, "find \"%s\" -maxdepth 7 -iname \"%s\" -type f 2>&1", pathpatstr, searchfile);   }
+if ((fp = popen(cmdstr, "r"))== NULL)     { return(0); }
+
+// invoke delivers full path of (first) matching filename
+if (fgets(dirlinestr, PATHMAX, fp) != NULL)
+    {
+        // Unix: catch errors
+        if (strleftcomp(dirlinestr, "find:"))   { pclose(fp); return(0); }
+        if ( strfindchr(dirlinestr, ':'))       { pclose(fp); return(0); }
+        if (!strfindchr(dirlinestr, '/'))       { pclose(fp); return(0); }
+        strlinetrim(dirlinestr);
+        pclose(fp);
+        return(1);
+    }
+pclose(fp);
+return(0);
+}
+
+// -----------------------------------------------------------------------------
+// CONTENT FINGERPRINTS (UNIX)
+//
+// Files renamed by an ingest pipeline keep their content, so search method 3
+// finds them by a fingerprint: the file size plus a hash of its first and
+// last FPCHUNK bytes. Reading two chunks instead of the whole file keeps it
+// cheap on slow disks. Tags sit in these chunks, so a file whose tags were
+// rewritten as well gets a fingerprint of its own and is not found this way.
+//
+// The fingerprints of an indexed tree are taken on first need, by FPJOBS
+// threads at a time, since waiting for the disk rather than hashing is what
+// takes the time. They are cached per device, inode, size and mtime in
+// '.relm3u.fp' at the root of the tree, written along with the index file, so
+// later runs only read the files that changed.
+
+#define FPCHUNK       (64 * 1024)   // bytes hashed at the start and at the end
+#define FPJOBS        8             // files read at a time
+#define FPBATCH       64            // files claimed by a reader at once
+#define FPFILENAME    ".relm3u.fp"
+#define FPMAGIC       "RELM3UFP"
+#define FPVERSION     1
+
+struct fpheader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t nrecs;
+};
+
+struct fprec
+{   // cached fingerprint of one file
+    uint64_t dev;
+    uint64_t ino;
+    int64_t mtime_sec;
+    uint32_t mtime_nsec;
+    uint32_t unused;
+    uint64_t size;
+    uint64_t hash;
+};
+
+struct fpentry
+{   // fingerprint of one indexed file
+    uint64_t size;
+    uint64_t hash;
+    uint32_t file;
+};
+
+struct fpindex
+{   // fingerprints of one indexed tree
+    struct fpentry *entries;    // sorted by size, hash, then file number
+    uint32_t nentries;
+    struct fprec *recs;         // the same as cache records, sorted by device and inode
+    uint32_t nrecs;
+};
+
+uint64_t fprint_mix(uint64_t h, const unsigned char *buf, size_t len)
+{   // fold buf into hash h, eight bytes at a time
+size_t i = 0;
+for (i = 0; i + 8 <= len; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, buf + i, 8);
+        h = (h ^ w) * 0x9E3779B97F4A7C15ull;
+        h ^= h >> 29;
+    }
+for (; i < len; i++) { h = (h ^ buf[i]) * 1099511628211ull; }
+return(h);
+}
+
+int fprint_read(int fd, unsigned char *buf, size_t len, off_t ofs)
+{   // read len bytes at ofs, return (0) when they cannot be read
+size_t done = 0;
+while (done < len)
+    {
+        ssize_t r = pread(fd, buf + done, len - done, ofs + done);
+        if (r <= 0) { return(0); }
+        done += r;
+    }
+return(1);
+}
+
+int fprint_fd(int fd, uint64_t size, struct fprint *fp)
+{   // fingerprint of an open file of size bytes, return (0) on read errors
+unsigned char *buf = malloc(2 * FPCHUNK);
+if (buf == NULL) { return(0); }
+size_t head = (size < FPCHUNK) ? size : FPCHUNK;
+uint64_t tailofs = (size > 2 * FPCHUNK) ? size - FPCHUNK : head;
+size_t tail = size - tailofs;
+int ok = fprint_read(fd, buf, head, 0) && fprint_read(fd, buf + head, tail, tailofs);
+if (ok)
+    {
+        fp->size = size;
+        fp->hash = fprint_mix(size * 0x9E3779B97F4A7C15ull, buf, head + tail);
+    }
+free(buf);
+return(ok);
+}
+
+int fprint_file(char *path, struct fprint *fp)
+{   // fingerprint of the regular file at path
+    // return (0) when there is none or it is empty
+int fd = open(path, O_RDONLY);
+if (fd < 0) { return(0); }
+struct stat st;
+int ok = (fstat(fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0) && fprint_fd(fd, st.st_size, fp);
+close(fd);
+return(ok);
+}
+
+void fpindex_free(struct fpindex *fx)
+{
+if (fx == NULL) { return; }
+free(fx->entries);
+free(fx->recs);
+free(fx);
+return;
+}
+
+// -----------------------------------------------------------------------------
+// TAG CACHE (UNIX)
+//
+// Generating playlists reads the tags of every music file, though few of them
+// change between runs. The tag fields read are cached per device, inode, size
+// and mtime in '.relm3u.tags' at the top of the library tree, so only new and
+// modified files are opened again. Files are looked up in batches, taking the
+// lock once per batch. The readers are found with MUSIC FILE TAGS.
+
+#define TAGFILENAME   ".relm3u.tags"
+#define TAGMAGIC      "RELM3UTG"
+#define TAGVERSION    3
+
+struct tagheader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t nrecs;
+    uint32_t poolsize;
+    uint32_t unused;
+};
+
+struct tagrec
+{   // cached tag fields of one file, ino 0 = free slot
+    uint64_t dev;
+    uint64_t ino;
+    int64_t mtime_sec;
+    uint32_t mtime_nsec;
+    uint32_t duration;      // milliseconds, 0 = unknown
+    uint64_t size;
+    int32_t track;
+    int32_t year;
+    uint8_t found;          // TAG... bits
+    uint8_t yearprio;
+    uint16_t met;           // looked up in this run, not kept on disk
+    uint32_t album;         // strings in the pool
+    uint32_t title;
+    uint32_t artist;
+};
+
+struct tagcache
+{   // cached tags of one indexed tree, open addressing table at most half full
+    struct tagrec *slots;
+    uint32_t size, used;
+    char *pool;             // album and title strings
+    uint32_t poolused, poolsize;
+    int dirty;              // changed since loaded or saved
+};
+
+void tagcache_free(struct tagcache *tc)
+{
+if (tc == NULL) { return; }
+free(tc->slots);
+free(tc->pool);
+free(tc);
+return;
+}
+
+// -----------------------------------------------------------------------------
+// LIBRARY FILENAME INDEX FOR SEARCH METHOD 2 (UNIX)
+//
+// Instead of forking one 'find' per missing track and search folder, the
+// library tree (the directory submitted, see relm3u_set_library()) is indexed
+// once per context and shared by all entries and playlists below it. Search
+// folders above the library tree, all of them when there is none, are indexed
+// apart from the topmost of them, leaving the library tree out and walking no
+// deeper than the 'find' depth limit below the nearest of them reaches; these
+// indexes are kept in memory only. Every regular file is kept with its
+// path relative to the indexed root, in 'find' traversal order (pre-order in
+// readdir order). Files are looked up by their lowercase name
+// as 'find <path> -maxdepth 7 -iname <file> -type f' did, but of several
+// matches the one sharing most of the playlist entry's path is taken (see
+// below). Every file is hashed by its normalised key as well, so names that
+// only differ in case, Unicode form or separators are found the same way.
+//
+// The index of a tree is one flat image that is queried in place. The index
+// of the library tree is kept as '.relm3u.idx' at its top, nothing is written
+// above it, and mmap'd again on the next run.
+// Every directory record carries the mtime the directory was listed at, so
+// only directories whose mtime changed are read again; listings of unchanged
+// directories are taken over from the previous image. When no directory has
+// changed at all, the mapped file is used as it is. The index file is only
+// written in serious mode, testing mode keeps its promise of no write access.
+//
+// Paths are not stored as strings, large libraries would not fit into the
+// memory of a small NAS box otherwise. A directory is its parent and its name,
+// names are interned, so 'CD1' is stored once however many albums have one.
+// A file is its directory and its name, and the names of the files of one
+// directory are front-coded in blocks of IDXBLOCK: the first name of a block
+// is stored in full, every further one as the numbers of leading and trailing
+// bytes it shares with the name before plus what lies between ('02 - ', '.flac'
+// and the like are not repeated). Paths are put together on demand into
+// buffers of the caller.
+
+#define IDXMAXDEPTH   64            // safety stop for the library walk
+#define FINDMAXDEPTH  7             // depth limit of the former 'find' invoke
+#define IDXFILENAME   ".relm3u.idx"
+#define OWNFILES      ".relm3u."    // index and state files, never indexed
+#define IDXMAGIC      "RELM3UIX"
+#define IDXVERSION    4
+#define IDXKIDFILE    0x80000000u   // directory entry refers to a file
+#define IDXNOPARENT   0xFFFFFFFFu   // parent of the root directory
+#define IDXMAXCOMPS   64            // path components compared from the end
+#define IDXBLOCK      16            // filenames front-coded per block
+#define IDXBLOCKSHIFT 28            // filename reference: index in block << 28 | block offset
+#define IDXBLOCKMASK  0x0FFFFFFFu   // block offsets count from the start of the
+                                    // whole name pool: 256 MB of names in all
+
+struct idxheader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t imagesize;
+    uint32_t ndirs, nkids, nfiles, nbuckets, poolsize;
+    uint32_t dirsofs, kidsofs, filesofs, keybucketsofs, orderofs, poolofs;
+};
+
+struct idxdir
+{
+    int64_t mtime_sec;      // directory mtime when listed, -1 = list again
+    uint32_t mtime_nsec;
+    uint32_t nameofs;       // interned name in string pool, "" for the root
+    uint32_t firstkid;      // directory entries in readdir order
+    uint32_t nkids;
+    uint32_t parent;        // directory number, IDXNOPARENT for the root
+};
+
+struct idxentry
+{
+    uint32_t nameofs;       // front-coded filename, see IDXBLOCKSHIFT
+    uint32_t keyhash;       // hash of normalised filename key
+    uint32_t keynext;       // next entry of same key bucket plus one, 0 = end
+    uint32_t dir;           // directory number of the folder holding the file
+};
+
+struct libindex
+{
+    char rootpath[PATHMAX]; // canonical absolute path of indexed root
+    int rootlen;
+    unsigned char *image;   // flat index image, mmap'd or allocated
+    size_t imagesize;
+    int mapped;
+    struct idxheader *hdr;
+    struct idxdir *dirs;
+    uint32_t *kids;         // directory entries, file number or dir number
+    struct idxentry *entries;   // all files, entry number = traversal order
+    uint32_t *keybuckets;   // first entry of key bucket plus one, 0 = empty
+    uint32_t *order;        // file numbers sorted by reversed path (see below)
+    char *pool;
+    struct fpindex *fp;     // content fingerprints, taken on first need
+    struct fpindex *fpold;  // those of the index this one replaced, or NULL
+    struct tagcache *tags;  // tag fields of music files, loaded on first need
+    int maxdepth;           // folders walked, the root counted; IDXMAXDEPTH for a full index
+    char skip[PATHMAX];     // canonical path of a tree left out, "" for none
+    int persist;            // index, fingerprints and tags are written at the root
+};
+
+struct idxbuild
+{   // growing tables while an index image is (re)built
+    char rootpath[PATHMAX];
+    struct idxdir *dirs;        uint32_t ndirs, adirs;
+    uint32_t *kids;             uint32_t nkids, akids;
+    struct idxentry *entries;   uint32_t nfiles, afiles;
+    char *pool;                 uint32_t poolused, poolsize;
+    uint32_t *intern;           uint32_t internused, internsize;    // directory names, offset plus one
+    struct libindex *old;       // previous image of the same root or NULL
+    int maxdepth;               // folders walked, the root counted
+    char *skip;                 // path of a subtree left out below the root, "" for none
+    time_t scanstart;
+    int failed;
+};
+
+unsigned int idx_namehash(char *name)
+{   // FNV-1a hash over filename with ASCII case folding (as 'find -iname')
+unsigned int h = 2166136261u;
+unsigned char c;
+while ((c = (unsigned char)*name++) != 0)
+    {   if ((c >= 'A') && (c <= 'Z')) { c = c + 32; }
+        h = (h ^ c) * 16777619u;
+    }
+return(h);
+}
+
+// Normalised filename keys: names that differ only in case (Unicode case
+// folding, not just ASCII), Unicode form (NFD from macOS against NFC) or in
+// whitespace and separators ("01 - Title.mp3", "01_Title.MP3") share one key.
+// The key is case-folded, canonically decomposed, separator runs become one
+// space and apostrophes are dropped; tables and rules are in mkunikey.py.
+// Bytes that are not valid UTF-8 (ISO-8859 names) are kept as they are.
+
+#define UNIKEYRAW  0x110000     // plus byte value: byte that is not UTF-8
+
+int unikey_map(uint32_t cp, const uint32_t **seq)
+{   // mapping of a non-ASCII code point, return its length or (-1) when the
+    // code point maps to itself
+int lo = 0;
+int hi = (int)(sizeof(unikey_cps) / sizeof(unikey_cps[0])) - 1;
+while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (unikey_cps[mid] < cp)       { lo = mid + 1; }
+        else if (unikey_cps[mid] > cp)  { hi = mid - 1; }
+        else
+            {
+                *seq = unikey_seq + unikey_ofs[mid];
+                return(unikey_ofs[mid + 1] - unikey_ofs[mid]);
+            }
+    }
+return(-1);
+}
+
+int unikey_class(uint32_t cp)
+{   // canonical combining class of a code point
+int lo = 0;
+int hi = (int)(sizeof(unikey_ccc) / sizeof(unikey_ccc[0]) / 3) - 1;
+while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (unikey_ccc[3 * mid + 1] < cp)   { lo = mid + 1; }
+        else if (unikey_ccc[3 * mid] > cp)  { hi = mid - 1; }
+        else                                { return(unikey_ccc[3 * mid + 2]); }
+    }
+return(0);
+}
+
+uint32_t unikey_decode(const unsigned char **str)
+{   // next code point of a string, advances *str
+const unsigned char *s = *str;
+uint32_t cp = s[0];
+int n = 0;
+if (cp < 0x80)                  { *str = s + 1; return(cp); }
+else if ((cp & 0xE0) == 0xC0)   { cp &= 0x1F; n = 1; }
+else if ((cp & 0xF0) == 0xE0)   { cp &= 0x0F; n = 2; }
+else if ((cp & 0xF8) == 0xF0)   { cp &= 0x07; n = 3; }
+else                            { *str = s + 1; return(UNIKEYRAW + s[0]); }
+int i = 0;
+for (i = 1; i <= n; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)  { *str = s + 1; return(UNIKEYRAW + s[0]); }
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+// overlong forms, surrogates and beyond Unicode are no valid UTF-8 either
+if ( ((n == 1) && (cp < 0x80)) || ((n == 2) && (cp < 0x800)) || ((n == 3) && (cp < 0x10000)) ||
+     ((cp >= 0xD800) && (cp <= 0xDFFF)) || (cp >= 0x110000) )
+    {   *str = s + 1; return(UNIKEYRAW + s[0]);    }
+*str = s + n + 1;
+return(cp);
+}
+
+int unikey_make(char *name, char *key, int keysize)
+{   // deliver the normalised key of a filename
+    // return its length, or (-1) when it does not fit into keysize
+uint32_t cps[PATHMAX];
+int n = 0;
+int sep = 0;        // separator pending, written before the next character
+const unsigned char *s = (const unsigned char *)name;
+while (*s != 0)
+    {
+        uint32_t cp = unikey_decode(&s);
+        uint32_t one[3];
+        const uint32_t *seq = one;
+        int len = 1;
+        if (cp < 0x80)
+            {   one[0] = unikey_ascii[cp]; len = (one[0] != 0);  }
+        else if ((cp >= 0xAC00) && (cp <= 0xD7A3))
+            {   // Hangul syllable, decomposed arithmetically
+                uint32_t si = cp - 0xAC00;
+                one[0] = 0x1100 + si / 588;
+                one[1] = 0x1161 + (si % 588) / 28;
+                one[2] = 0x11A7 + si % 28;
+                len = (si % 28) ? 3 : 2;
+            }
+        else if ((cp >= UNIKEYRAW) || ((len = unikey_map(cp, &seq)) < 0))
+            {   one[0] = cp; seq = one; len = 1;   }
+
+        int i = 0;
+        for (i = 0; i < len; i++)
+            {
+                if (seq[i] == ' ')  { sep = 1; continue; }
+                if (n + 2 >= PATHMAX) { return(-1); }
+                if (sep && (n > 0)) { cps[n++] = ' '; }
+                sep = 0;
+                cps[n++] = seq[i];
+            }
+    }
+
+// canonical order: combining marks in a row sorted by class, stable
+int i = 0;
+for (i = 1; i < n; i++)
+    {
+        int cls = (cps[i] < UNIKEYRAW) ? unikey_class(cps[i]) : 0;
+        if (cls == 0) { continue; }
+        uint32_t cp = cps[i];
+        int j = i;
+        while ((j > 0) && (cps[j - 1] < UNIKEYRAW) && (unikey_class(cps[j - 1]) > cls))
+            {   cps[j] = cps[j - 1]; j--;  }
+        cps[j] = cp;
+    }
+
+int len = 0;
+for (i = 0; i < n; i++)
+    {
+        uint32_t cp = cps[i];
+        if (len + 5 > keysize) { return(-1); }
+        if (cp >= UNIKEYRAW)    { key[len++] = (char)(cp - UNIKEYRAW); }
+        else if (cp < 0x80)     { key[len++] = (char)cp; }
+        else if (cp < 0x800)
+            {   key[len++] = (char)(0xC0 | (cp >> 6));
+                key[len++] = (char)(0x80 | (cp & 0x3F));
+            }
+        else if (cp < 0x10000)
+            {   key[len++] = (char)(0xE0 | (cp >> 12));
+                key[len++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                key[len++] = (char)(0x80 | (cp & 0x3F));
+            }
+        else
+            {   key[len++] = (char)(0xF0 | (cp >> 18));
+                key[len++] = (char)(0x80 | ((cp >> 12) & 0x3F));
+                key[len++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+                key[len++] = (char)(0x80 | (cp & 0x3F));
+            }
+    }
+key[len] = 0;
+return(len);
+}
+
+int idx_namecomp(char *astr, char *bstr)
+{   // compare filenames with ASCII case folding, return (1) when identical
+unsigned char a, b;
+do  {   a = (unsigned char)*astr++; if ((a >= 'A') && (a <= 'Z')) { a = a + 32; }
+        b = (unsigned char)*bstr++; if ((b >= 'A') && (b <= 'Z')) { b = b + 32; }
+        if (a != b) { return(0); }
+    }
+while (a != 0);
+return(1);
+}
+
+void *idx_grow(void *table, uint32_t *alloc, uint32_t need, size_t size)
+{   // make room for need elements in a growing table
+    // return the (moved) table, or NULL on failure with table left untouched
+if (need <= *alloc) { return(table); }
+uint32_t n = (*alloc == 0) ? 1024 : *alloc;
+while (n < need) { n = n * 2; }
+void *p = realloc(table, (size_t)n * size);
+if (p == NULL) { return(NULL); }
+*alloc = n;
+return(p);
+}
+
+uint32_t idx_pooladd(struct idxbuild *b, char *str, int len)
+{   // copy string into pool, deliver its offset
+char *p = idx_grow(b->pool, &b->poolsize, b->poolused + len + 1, 1);
+if (p == NULL) { b->failed = 1; return(0); }
+b->pool = p;
+uint32_t ofs = b->poolused;
+memcpy(b->pool + ofs, str, len);
+b->pool[ofs + len] = 0;
+b->poolused += len + 1;
+return(ofs);
+}
+
+uint32_t idx_intern(struct idxbuild *b, char *name, int len)
+{   // pool offset of a directory name, stored once however often it occurs
+if (2 * (b->internused + 1) > b->internsize)
+    {   // rehash into a table twice the size
+        uint32_t n = (b->internsize == 0) ? 1024 : b->internsize * 2;
+        uint32_t *t = calloc(n, sizeof(uint32_t));
+        if (t == NULL) { b->failed = 1; return(0); }
+        uint32_t i = 0;
+        for (i = 0; i < b->internsize; i++)
+            {
+                if (b->intern[i] == 0) { continue; }
+                uint32_t j = probecache_hash(b->pool + b->intern[i] - 1) & (n - 1);
+                while (t[j] != 0) { j = (j + 1) & (n - 1); }
+                t[j] = b->intern[i];
+            }
+        free(b->intern);
+        b->intern = t;
+        b->internsize = n;
+    }
+uint32_t i = probecache_hash(name) & (b->internsize - 1);
+while (b->intern[i] != 0)
+    {
+        if (strcomp(b->pool + b->intern[i] - 1, name)) { return(b->intern[i] - 1); }
+        i = (i + 1) & (b->internsize - 1);
+    }
+uint32_t ofs = idx_pooladd(b, name, len);
+if (b->failed) { return(0); }
+b->intern[i] = ofs + 1;
+b->internused++;
+return(ofs);
+}
+
+uint32_t idx_newdir(struct idxbuild *b, char *name, int namelen, uint32_t parent)
+{   // append one directory record, not listed yet, deliver its number
+struct idxdir *t = idx_grow(b->dirs, &b->adirs, b->ndirs + 1, sizeof(struct idxdir));
+if (t == NULL) { b->failed = 1; return(0); }
+b->dirs = t;
+uint32_t d = b->ndirs++;
+b->dirs[d].nameofs = idx_intern(b, name, namelen);
+b->dirs[d].mtime_sec = -1;
+b->dirs[d].mtime_nsec = 0;
+b->dirs[d].firstkid = b->nkids;
+b->dirs[d].nkids = 0;
+b->dirs[d].parent = parent;
+return(d);
+}
+
+struct idxnames
+{   // front coding of the filenames of one directory
+    char prev[PATHMAX];     // the name before in the current block
+    int prevlen;
+    uint32_t blockofs;      // pool offset of the current block
+    int inblock;            // names in it, 0 = start a new block
+};
+
+uint32_t idx_addfile(struct idxbuild *b, struct idxnames *nm, char *name, int namelen, uint32_t dir)
+{   // append one file of directory dir in traversal order, deliver its file number
+    // the blocks of nm must not be interrupted by other pool strings, so
+    // reset nm->inblock before anything else goes into the pool
+struct idxentry *t = idx_grow(b->entries, &b->afiles, b->nfiles + 1, sizeof(struct idxentry));
+if (t == NULL) { b->failed = 1; return(0); }
+b->entries = t;
+struct idxentry *e = &b->entries[b->nfiles];
+
+int pre = 0;
+int suf = 0;
+if ((nm->inblock == 0) || (nm->inblock == IDXBLOCK))
+    {   nm->blockofs = b->poolused; nm->inblock = 0;   }
+else
+    {
+        while ((pre < 255) && (pre < namelen) && (pre < nm->prevlen) && (name[pre] == nm->prev[pre])) { pre++; }
+        while ( (suf < 255) && (pre + suf < namelen) && (pre + suf < nm->prevlen) &&
+                (name[namelen - 1 - suf] == nm->prev[nm->prevlen - 1 - suf]) )  { suf++; }
+    }
+// the block offset is one into the pool of the whole tree, so past 256 MB of
+// names the tree cannot be indexed (search falls back to 'find')
+if (nm->blockofs > IDXBLOCKMASK) { b->failed = 1; return(0); }
+int mid = namelen - pre - suf;
+char *p = idx_grow(b->pool, &b->poolsize, b->poolused + mid + 3, 1);
+if (p == NULL) { b->failed = 1; return(0); }
+b->pool = p;
+p[b->poolused++] = (char)pre;
+p[b->poolused++] = (char)suf;
+memcpy(p + b->poolused, name + pre, mid);
+p[b->poolused + mid] = 0;
+b->poolused += mid + 1;
+e->nameofs = ((uint32_t)nm->inblock << IDXBLOCKSHIFT) | nm->blockofs;
+nm->inblock++;
+memcpy(nm->prev, name, namelen + 1);
+nm->prevlen = namelen;
+
+e->keynext = 0;
+e->dir = dir;
+char key[PATHMAX];
+e->keyhash = idx_namehash((unikey_make(name, key, PATHMAX) >= 0) ? key : name);
+return(b->nfiles++);
+}
+
+char *libindex_filename(struct libindex *ix, uint32_t f, char *name)
+{   // decode the name of file f into name (PATHMAX), deliver name
+uint32_t pos = ix->entries[f].nameofs & IDXBLOCKMASK;
+int skip = ix->entries[f].nameofs >> IDXBLOCKSHIFT;
+int len = 0;
+name[0] = 0;
+while (pos + 1 < ix->hdr->poolsize)
+    {   // leading bytes of the name before, the rest, its trailing bytes
+        int pre = (unsigned char)ix->pool[pos++];
+        int suf = (unsigned char)ix->pool[pos++];
+        if (pre > len) { pre = len; }
+        if (suf > len - pre) { suf = len - pre; }
+        int n = strlength(ix->pool + pos);
+        if (pre + n + suf >= PATHMAX) { n = 0; suf = 0; }
+        memmove(name + pre + n, name + len - suf, suf);
+        memcpy(name + pre, ix->pool + pos, n);
+        len = pre + n + suf;
+        name[len] = 0;
+        pos += strlength(ix->pool + pos) + 1;
+        if (skip-- == 0) { break; }
+    }
+return(name);
+}
+
+int libindex_dirpath(struct libindex *ix, uint32_t d, char *path, int size)
+{   // put together the path of directory d relative to the indexed root,
+    // "" for the root; return its length, (-1) when it does not fit
+uint32_t chain[IDXMAXDEPTH + 2];
+int n = 0;
+while ((d != 0) && (n < IDXMAXDEPTH + 2)) { chain[n++] = d; d = ix->dirs[d].parent; }
+int len = 0;
+path[0] = 0;
+while (n > 0)
+    {
+        char *name = ix->pool + ix->dirs[chain[--n]].nameofs;
+        int l = strlength(name);
+        if (len + l + 2 > size) { return(-1); }
+        if (len > 0) { path[len++] = '/'; }
+        memcpy(path + len, name, l + 1);
+        len += l;
+    }
+return(len);
+}
+
+int libindex_path(struct libindex *ix, uint32_t f, char *path, int size)
+{   // put together the path of file f relative to the indexed root
+    // return its length, (-1) when it does not fit
+char name[PATHMAX];
+int len = libindex_dirpath(ix, ix->entries[f].dir, path, size);
+if (len < 0) { return(-1); }
+libindex_filename(ix, f, name);
+int l = strlength(name);
+if (len + l + 2 > size) { return(-1); }
+if (len > 0) { path[len++] = '/'; }
+memcpy(path + len, name, l + 1);
+return(len + l);
+}
+
+struct idxlisting
+{   // one directory as read from disk
+    char *names;    uint32_t used, size;
+    uint32_t *ofs;  uint32_t n, alloc;
+};
+
+int idx_readdir(char *dirpath, struct idxlisting *ls)
+{   // read names of subdirectories and regular files in readdir order,
+    // subdirectory names get a trailing '/' to tell them apart
+    // symbolic links are neither followed nor indexed (as 'find -type f')
+int dirlen = strlength(dirpath);
+DIR *dp = opendir(dirpath); if (dp == NULL) { return(0); }
+struct dirent *de;
+while ((de = readdir(dp)) != NULL)
+    {
+        char *name = de->d_name;
+        if ((name[0] == '.') && ((name[1] == 0) || ((name[1] == '.') && (name[2] == 0)))) { continue; }
+        if (strleftcomp(name, OWNFILES))        { continue; }
+
+        int namelen = strlength(name);
+        if (dirlen + namelen + 2 >= PATHMAX)    { continue; }
+
+        int type = de->d_type;
+        if (type == DT_UNKNOWN)
+            {   // some filesystems do not report types, ask explicitly
+                struct stat st;
+                strcpy(dirpath + dirlen, name);
+                if (lstat(dirpath, &st) == 0)
+                    {   if (S_ISDIR(st.st_mode)) { type = DT_DIR; }
+                        if (S_ISREG(st.st_mode)) { type = DT_REG; }
+                    }
+                dirpath[dirlen] = 0;
+            }
+        if ((type != DT_DIR) && (type != DT_REG))   { continue; }
+
+        char *p = idx_grow(ls->names, &ls->size, ls->used + namelen + 2, 1);
+        if (p == NULL) { closedir(dp); return(0); }
+        ls->names = p;
+        uint32_t *o = idx_grow(ls->ofs, &ls->alloc, ls->n + 1, sizeof(uint32_t));
+        if (o == NULL) { closedir(dp); return(0); }
+        ls->ofs = o;
+
+        ls->ofs[ls->n++] = ls->used;
+        memcpy(ls->names + ls->used, name, namelen);
+        ls->used += namelen;
+        if (type == DT_DIR) { ls->names[ls->used++] = '/'; }
+        ls->names[ls->used++] = 0;
+    }
+closedir(dp);
+return(1);
+}
+
+int64_t idx_oldsubdir(struct libindex *old, int64_t olddir, char *name, uint32_t *hint)
+{   // find subdirectory by name in the previous listing of a directory,
+    // searching on from the last match since readdir order rarely changes
+if ((old == NULL) || (olddir < 0)) { return(-1); }
+struct idxdir *od = &old->dirs[olddir];
+uint32_t i = 0;
+for (i = 0; i < od->nkids; i++)
+    {
+        uint32_t k = (*hint + i) % od->nkids;
+        uint32_t kid = old->kids[od->firstkid + k];
+        if (kid & IDXKIDFILE) { continue; }
+        if (strcomp(old->pool + old->dirs[kid].nameofs, name))  { *hint = k + 1; return(kid); }
+    }
+return(-1);
+}
+
+uint32_t idx_builddir(struct idxbuild *b, char *relpath, int rellen, int nameidx, uint32_t parent, int64_t olddir, int depth)
+{   // add directory root/relpath and everything below it to the new image,
+    // reusing the previous listing when the directory mtime did not change
+    // relpath is a PATHMAX buffer which is extended and restored in place
+char dirpath[2 * PATHMAX + 2];
+if (rellen == 0)    { sprintf(dirpath, "%s/", b->rootpath); }
+else                { sprintf(dirpath, "%s/%s/", b->rootpath, relpath); }
+
+uint32_t d = idx_newdir(b, relpath + nameidx, rellen - nameidx, parent);
+if (b->failed) { return(0); }
+
+struct stat st;
+if (lstat(dirpath, &st) != 0) { return(d); }
+
+// a directory changed right now may change again unnoticed within the same
+// timestamp, so leave it marked for listing again on the next run
+if (st.st_mtime < b->scanstart - 1)
+    {   b->dirs[d].mtime_sec = (int64_t)st.st_mtime;
+        b->dirs[d].mtime_nsec = (uint32_t)st.st_mtim.tv_nsec;
+    }
+
+struct libindex *old = b->old;
+int reuse = 0;
+if ((old != NULL) && (olddir >= 0))
+    {
+        struct idxdir *od = &old->dirs[olddir];
+        if ( (od->mtime_sec == (int64_t)st.st_mtime) &&
+             (od->mtime_nsec == (uint32_t)st.st_mtim.tv_nsec) ) { reuse = 1; }
+    }
+
+struct idxlisting ls = { NULL, 0, 0, NULL, 0, 0 };
+uint32_t n = 0;
+if (reuse)  { n = old->dirs[olddir].nkids; }
+else
+    {
+        if (!idx_readdir(dirpath, &ls)) { free(ls.names); free(ls.ofs); return(d); }
+        n = ls.n;
+    }
+
+// reserve the entries of this directory before descending
+uint32_t first = b->nkids;
+uint32_t *k = idx_grow(b->kids, &b->akids, b->nkids + n, sizeof(uint32_t));
+struct idxnames *nm = malloc(sizeof(struct idxnames));
+if ((k == NULL) || (nm == NULL)) { b->failed = 1; free(nm); free(ls.names); free(ls.ofs); return(d); }
+b->kids = k;
+b->nkids += n;
+nm->inblock = 0;
+char *oldname = malloc(PATHMAX);
+if (reuse && (oldname == NULL)) { b->failed = 1; }
+
+uint32_t kept = 0;
+uint32_t hint = 0;
+uint32_t i = 0;
+for (i = 0; (i < n) && (!b->failed); i++)
+    {
+        char *name;
+        int isdir;
+        int64_t oldsub = -1;
+        if (reuse)
+            {
+                uint32_t kid = old->kids[old->dirs[olddir].firstkid + i];
+                isdir = ((kid & IDXKIDFILE) == 0);
+                if (isdir)  { name = old->pool + old->dirs[kid].nameofs; oldsub = kid; }
+                else        { name = libindex_filename(old, kid & ~IDXKIDFILE, oldname); }
+            }
+        else
+            {
+                name = ls.names + ls.ofs[i];
+                isdir = strrightcomp(name, "/");
+            }
+
+        int namelen = strlength(name);
+        if (isdir && !reuse) { name[--namelen] = 0; }
+        if (isdir && (depth >= b->maxdepth))    { continue; }
+        if (rellen + namelen + 2 >= PATHMAX)    { continue; }
+
+        // extend relative path by this entry
+        int childidx = rellen;
+        if (rellen > 0) { relpath[rellen] = '/'; childidx++; }
+        memcpy(relpath + childidx, name, namelen + 1);
+        if (isdir && strcomp(relpath, b->skip)) { relpath[rellen] = 0; continue; }
+
+        uint32_t kid;
+        if (isdir)
+            {
+                if (!reuse) { oldsub = idx_oldsubdir(old, olddir, name, &hint); }
+                nm->inblock = 0;    // the subdirectory writes to the pool too
+                kid = idx_builddir(b, relpath, childidx + namelen, childidx, d, oldsub, depth + 1);
+            }
+        else
+            {   kid = idx_addfile(b, nm, name, namelen, d) | IDXKIDFILE; }
+        b->kids[first + kept++] = kid;
+
+        relpath[rellen] = 0;
+    }
+b->dirs[d].nkids = kept;
+// the slots of entries left out stay unused, but must hold a valid number
+if (!b->failed) { for (i = kept; i < n; i++) { b->kids[first + i] = 0; } }
+free(oldname);
+free(nm);
+free(ls.names);
+free(ls.ofs);
+return(d);
+}
+
+int idx_setimage(struct libindex *ix, unsigned char *image, size_t imagesize)
+{   // point index tables into a flat image after checking its consistency
+    // return (0) when the image is not a valid index
+struct idxheader *h = (struct idxheader *)image;
+if (imagesize < sizeof(struct idxheader))           { return(0); }
+if (memcmp(h->magic, IDXMAGIC, 8) != 0)             { return(0); }
+if (h->version != IDXVERSION)                       { return(0); }
+if (h->imagesize != imagesize)                      { return(0); }
+if (h->ndirs == 0)                                  { return(0); }
+if (h->nbuckets == 0)                               { return(0); }
+if ((h->nbuckets & (h->nbuckets - 1)) != 0)         { return(0); }
+if ((uint64_t)h->dirsofs + (uint64_t)h->ndirs * sizeof(struct idxdir) > imagesize)         { return(0); }
+if ((uint64_t)h->kidsofs + (uint64_t)h->nkids * sizeof(uint32_t) > imagesize)              { return(0); }
+if ((uint64_t)h->filesofs + (uint64_t)h->nfiles * sizeof(struct idxentry) > imagesize)     { return(0); }
+if ((uint64_t)h->keybucketsofs + (uint64_t)h->nbuckets * sizeof(uint32_t) > imagesize)     { return(0); }
+if ((uint64_t)h->orderofs + (uint64_t)h->nfiles * sizeof(uint32_t) > imagesize)            { return(0); }
+if ((uint64_t)h->poolofs + (uint64_t)h->poolsize > imagesize)                              { return(0); }
+if ((h->poolsize == 0) || (image[h->poolofs + h->poolsize - 1] != 0))                      { return(0); }
+
+ix->image = image;
+ix->imagesize = imagesize;
+ix->hdr = h;
+ix->dirs = (struct idxdir *)(image + h->dirsofs);
+ix->kids = (uint32_t *)(image + h->kidsofs);
+ix->entries = (struct idxentry *)(image + h->filesofs);
+ix->keybuckets = (uint32_t *)(image + h->keybucketsofs);
+ix->order = (uint32_t *)(image + h->orderofs);
+ix->pool = (char *)(image + h->poolofs);
+
+// no reference may point outside of the image
+uint32_t i = 0;
+for (i = 0; i < h->ndirs; i++)
+    {   struct idxdir *d = &ix->dirs[i];
+        if (d->nameofs >= h->poolsize)                                  { return(0); }
+        if ((uint64_t)d->firstkid + d->nkids > h->nkids)                { return(0); }
+        // parents come first in traversal order, so no walk up can loop
+        if ((i == 0) ? (d->parent != IDXNOPARENT) : (d->parent >= i))   { return(0); }
+    }
+for (i = 0; i < h->nkids; i++)
+    {   uint32_t kid = ix->kids[i];
+        if ((kid & IDXKIDFILE) ? ((kid & ~IDXKIDFILE) >= h->nfiles) : (kid >= h->ndirs)) { return(0); }
+    }
+for (i = 0; i < h->nfiles; i++)
+    {   struct idxentry *e = &ix->entries[i];
+        if ((e->nameofs & IDXBLOCKMASK) >= h->poolsize)                 { return(0); }
+        if (e->keynext > h->nfiles)                                     { return(0); }
+        if ((e->dir >= h->ndirs) || (ix->order[i] >= h->nfiles))        { return(0); }
+    }
+for (i = 0; i < h->nbuckets; i++)
+    {   if (ix->keybuckets[i] > h->nfiles) { return(0); }   }
+return(1);
+}
+
+// Files are also kept sorted by their reversed path, filename first, then
+// the folder holding it, its parent and so on, compared with ASCII case
+// folding. This is a reversed-component trie laid out flat: all files that
+// share the last k path components form one contiguous range, and the range
+// for k + 1 components is found inside it by binary search. The file sharing
+// the longest path suffix with a playlist entry is thus found in a number of
+// steps proportional to the depth of the entry, whatever the library size.
+
+int idx_foldcmp(char *astr, char *bstr)
+{   // order strings with ASCII case folding, return <0, 0 or >0
+unsigned char a, b;
+do  {   a = (unsigned char)*astr++; if ((a >= 'A') && (a <= 'Z')) { a = a + 32; }
+        b = (unsigned char)*bstr++; if ((b >= 'A') && (b <= 'Z')) { b = b + 32; }
+        if (a != b) { return((int)a - (int)b); }
+    }
+while (a != 0);
+return(0);
+}
+
+char *idx_component(struct libindex *ix, uint32_t f, int k, char *name)
+{   // path component k of file f counted from the end, 0 = filename (decoded
+    // into name, PATHMAX); return NULL beyond the indexed root
+if (k == 0) { return(libindex_filename(ix, f, name)); }
+uint32_t d = ix->entries[f].dir;
+while ((k > 1) && (d != 0)) { d = ix->dirs[d].parent; k--; }
+if (d == 0) { return(NULL); }
+return(ix->pool + ix->dirs[d].nameofs);
+}
+
+int idx_compcmp(char *a, char *b)
+{   // order path components, a missing component (NULL) comes first
+if (a == NULL) { return((b == NULL) ? 0 : -1); }
+if (b == NULL) { return(1); }
+return(idx_foldcmp(a, b));
+}
+
+int idx_filecmp(struct libindex *ix, char **names, uint32_t fa, uint32_t fb)
+{   // order files by reversed path, then by traversal order
+    // names holds the decoded filenames
+int c = idx_foldcmp(names[fa], names[fb]);
+uint32_t da = ix->entries[fa].dir;
+uint32_t db = ix->entries[fb].dir;
+while ((c == 0) && (da != db))
+    {
+        c = idx_compcmp((da != 0) ? ix->pool + ix->dirs[da].nameofs : NULL,
+                        (db != 0) ? ix->pool + ix->dirs[db].nameofs : NULL);
+        if (da != 0) { da = ix->dirs[da].parent; }
+        if (db != 0) { db = ix->dirs[db].parent; }
+    }
+if (c != 0) { return(c); }
+return((fa < fb) ? -1 : (fa > fb));
+}
+
+int idx_sortorder(struct libindex *ix)
+{   // sort the file order of an image by reversed path (bottom-up merge sort)
+    // return (0) when memory is short
+uint32_t n = ix->hdr->nfiles;
+uint32_t *tmp = malloc((size_t)n * sizeof(uint32_t) + 1);
+char **names = malloc((size_t)n * sizeof(char *) + 1);
+if ((tmp == NULL) || (names == NULL)) { free(tmp); free(names); return(0); }
+
+// decode the filenames once, the comparisons need them many times over
+char name[PATHMAX];
+size_t textsize = 1;
+uint32_t f = 0;
+for (f = 0; f < n; f++) { textsize += strlength(libindex_filename(ix, f, name)) + 1; }
+char *text = malloc(textsize);
+if (text == NULL) { free(tmp); free(names); return(0); }
+size_t used = 0;
+for (f = 0; f < n; f++)
+    {
+        size_t l = strlength(libindex_filename(ix, f, name)) + 1;
+        names[f] = memcpy(text + used, name, l);
+        used += l;
+    }
+uint32_t *from = ix->order;
+uint32_t *to = tmp;
+uint32_t width = 1;
+for (width = 1; width < n; width = width * 2)
+    {
+        uint32_t lo = 0;
+        for (lo = 0; lo < n; lo += 2 * width)
+            {
+                uint32_t mid = (lo + width < n) ? lo + width : n;
+                uint32_t hi = (mid + width < n) ? mid + width : n;
+                uint32_t i = lo, j = mid, k = lo;
+                while ((i < mid) && (j < hi))
+                    {   to[k++] = (idx_filecmp(ix, names, from[j], from[i]) < 0) ? from[j++] : from[i++];  }
+                while (i < mid) { to[k++] = from[i++]; }
+                while (j < hi)  { to[k++] = from[j++]; }
+            }
+        uint32_t *t = from; from = to; to = t;
+    }
+if (from != ix->order) { memcpy(ix->order, from, (size_t)n * sizeof(uint32_t)); }
+free(tmp);
+free(names);
+free(text);
+return(1);
+}
+
+struct libindex *idx_finish(struct idxbuild *b)
+{   // lay out the collected tables as one flat image, with key buckets
+    // chained in ascending traversal order
+uint32_t nbuckets = 1024;
+while (nbuckets < b->nfiles) { nbuckets = nbuckets * 2; }
+
+struct idxheader h;
+memset(&h, 0, sizeof(h));
+memcpy(h.magic, IDXMAGIC, 8);
+h.version = IDXVERSION;
+h.ndirs = b->ndirs;
+h.nkids = b->nkids;
+h.nfiles = b->nfiles;
+h.nbuckets = nbuckets;
+h.poolsize = b->poolused;
+h.dirsofs = (sizeof(struct idxheader) + 7) & ~7u;
+h.kidsofs = h.dirsofs + h.ndirs * sizeof(struct idxdir);
+h.filesofs = (h.kidsofs + h.nkids * sizeof(uint32_t) + 7) & ~7u;
+h.keybucketsofs = h.filesofs + h.nfiles * sizeof(struct idxentry);
+h.orderofs = h.keybucketsofs + h.nbuckets * sizeof(uint32_t);
+h.poolofs = h.orderofs + h.nfiles * sizeof(uint32_t);
+uint64_t size = (uint64_t)h.poolofs + h.poolsize;
+if (size > 0xFFFFFFF0u) { return(NULL); }
+h.imagesize = (uint32_t)size;
+
+unsigned char *image = calloc(1, size);
+if (image == NULL) { return(NULL); }
+memcpy(image, &h, sizeof(h));
+memcpy(image + h.dirsofs, b->dirs, h.ndirs * sizeof(struct idxdir));
+// a tree above the library may hold no files at all, the tables are NULL then
+if (h.nkids > 0)    { memcpy(image + h.kidsofs, b->kids, h.nkids * sizeof(uint32_t)); }
+if (h.nfiles > 0)   { memcpy(image + h.filesofs, b->entries, h.nfiles * sizeof(struct idxentry)); }
+memcpy(image + h.poolofs, b->pool, h.poolsize);
+
+struct idxentry *entries = (struct idxentry *)(image + h.filesofs);
+uint32_t *keybuckets = (uint32_t *)(image + h.keybucketsofs);
+uint32_t e = h.nfiles;
+while (e > 0)
+    {
+        e--;
+        uint32_t bk = entries[e].keyhash & (nbuckets - 1);
+        entries[e].keynext = keybuckets[bk];
+        keybuckets[bk] = e + 1;
+    }
+uint32_t *order = (uint32_t *)(image + h.orderofs);
+for (e = 0; e < h.nfiles; e++) { order[e] = e; }
+
+struct libindex *ix = calloc(1, sizeof(struct libindex));
+if ((ix == NULL) || !idx_setimage(ix, image, size)) { free(ix); free(image); return(NULL); }
+if (!idx_sortorder(ix)) { free(ix); free(image); return(NULL); }
+return(ix);
+}
+
+void libindex_free(struct libindex *ix)
+{
+if (ix == NULL) { return; }
+if (ix->mapped) { munmap(ix->image, ix->imagesize); }
+else            { free(ix->image); }
+fpindex_free(ix->fp);
+fpindex_free(ix->fpold);
+tagcache_free(ix->tags);
+free(ix);
+return;
+}
+
+void libindex_free_all(relm3u_ctx *ctx)
+{
+while (ctx->nroots > 0) { libindex_free(ctx->roots[--ctx->nroots]); }
+return;
+}
+
+struct libindex *libindex_load(char *rootpath)
+{   // map index file of a root directory, return NULL when there is none
+char idxpath[PATHMAX + 16];
+sprintf(idxpath, "%s/%s", rootpath, IDXFILENAME);
+int fd = open(idxpath, O_RDONLY); if (fd < 0) { return(NULL); }
+struct stat st;
+if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(struct idxheader))) { close(fd); return(NULL); }
+void *image = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+close(fd);
+if (image == MAP_FAILED) { return(NULL); }
+
+struct libindex *ix = calloc(1, sizeof(struct libindex));
+if ((ix == NULL) || !idx_setimage(ix, image, st.st_size))
+    {   free(ix); munmap(image, st.st_size); return(NULL);  }
+ix->mapped = 1;
+return(ix);
+}
+
+int libindex_unchanged(struct libindex *ix, char *rootpath, uint32_t d, int depth)
+{   // check mtimes of all indexed directories, return (1) when none changed
+struct idxdir *dir = &ix->dirs[d];
+if (dir->mtime_sec < 0) { return(0); }
+char dirpath[2 * PATHMAX + 2];
+char relpath[PATHMAX];
+if (libindex_dirpath(ix, d, relpath, PATHMAX) < 0)              { return(0); }
+sprintf(dirpath, "%s/%s", rootpath, relpath);
+struct stat st;
+if (lstat(dirpath, &st) != 0)                                   { return(0); }
+if (dir->mtime_sec != (int64_t)st.st_mtime)                     { return(0); }
+if (dir->mtime_nsec != (uint32_t)st.st_mtim.tv_nsec)            { return(0); }
+if (depth > IDXMAXDEPTH)                                        { return(0); }
+uint32_t i = 0;
+for (i = 0; i < dir->nkids; i++)
+    {
+        uint32_t kid = ix->kids[dir->firstkid + i];
+        if (kid & IDXKIDFILE) { continue; }
+        if (!libindex_unchanged(ix, rootpath, kid, depth + 1))  { return(0); }
+    }
+return(1);
+}
+
+int libindex_save(struct libindex *ix, char *rootpath)
+{   // write index image next to the indexed tree, replacing the previous one
+char idxpath[PATHMAX + 16];
+char tmppath[PATHMAX + 16];
+sprintf(idxpath, "%s/%s", rootpath, IDXFILENAME);
+sprintf(tmppath, "%s/%s.tmp", rootpath, IDXFILENAME);
+
+// replacing the file touches the root directory; when that is the only
+// change, the fresh root mtime is recorded afterwards
+struct stat st;
+int rootclean = ( (lstat(rootpath, &st) == 0) &&
+                  (ix->dirs[0].mtime_sec == (int64_t)st.st_mtime) &&
+                  (ix->dirs[0].mtime_nsec == (uint32_t)st.st_mtim.tv_nsec) );
+
+int fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0644); if (fd < 0) { return(0); }
+size_t done = 0;
+while (done < ix->imagesize)
+    {
+        ssize_t w = write(fd, ix->image + done, ix->imagesize - done);
+        if (w <= 0) { close(fd); unlink(tmppath); return(0); }
+        done += w;
+    }
+if (close(fd) != 0)                 { unlink(tmppath); return(0); }
+if (rename(tmppath, idxpath) != 0)  { unlink(tmppath); return(0); }
+
+if (rootclean && (lstat(rootpath, &st) == 0))
+    {
+        struct idxdir root = ix->dirs[0];
+        root.mtime_sec = (int64_t)st.st_mtime;
+        root.mtime_nsec = (uint32_t)st.st_mtim.tv_nsec;
+        fd = open(idxpath, O_WRONLY);
+        if (fd >= 0)
+            {
+                if (pwrite(fd, &root, sizeof(root), ix->hdr->dirsofs) == sizeof(root)) { ix->dirs[0] = root; }
+                close(fd);
+            }
+    }
+return(1);
+}
+
+int libindex_rootclean(struct libindex *ix)
+{   // whether the indexed root is as it was listed, checked before a file of
+    // our own is written into it
+struct stat st;
+return( (lstat(ix->rootpath, &st) == 0) &&
+        (ix->dirs[0].mtime_sec == (int64_t)st.st_mtime) &&
+        (ix->dirs[0].mtime_nsec == (uint32_t)st.st_mtim.tv_nsec) );
+}
+
+int libindex_rootwritten(struct libindex *ix, int rootclean)
+{   // a file of our own was written into the indexed root: as with the index
+    // file, that must not make the root look changed, so when it was clean
+    // before, the index file on disk gets the new root mtime
+    // return (0) on failure
+struct stat st;
+if (!rootclean || (lstat(ix->rootpath, &st) != 0)) { return(1); }
+char idxpath[PATHMAX + 16];
+sprintf(idxpath, "%s/%s", ix->rootpath, IDXFILENAME);
+struct idxdir root = ix->dirs[0];
+root.mtime_sec = (int64_t)st.st_mtime;
+root.mtime_nsec = (uint32_t)st.st_mtim.tv_nsec;
+int fd = open(idxpath, O_WRONLY);
+if (fd < 0) { return(0); }
+ssize_t w = pwrite(fd, &root, sizeof(root), ix->hdr->dirsofs);
+close(fd);
+return(w == sizeof(root));
+}
+
+struct libindex *libindex_build(char *rootpath, struct libindex *old, int maxdepth, char *skip)
+{   // (re)build index image of a tree, taking over unchanged listings of old,
+    // maxdepth folders deep and leaving out the tree at canonical path skip
+struct idxbuild b;
+memset(&b, 0, sizeof(b));
+sprintf(b.rootpath, "%s", rootpath);
+b.old = old;
+b.maxdepth = maxdepth;
+int rootlen = strlength(rootpath);
+if ((skip[0] != 0) && strleftcomp(skip, rootpath) && (skip[rootlen] == '/'))   { b.skip = skip + rootlen + 1; }
+else                                                                            { b.skip = ""; }
+b.scanstart = time(NULL);
+
+char relpath[PATHMAX] = "";
+idx_builddir(&b, relpath, 0, 0, IDXNOPARENT, (old != NULL) ? 0 : -1, 1);
+
+struct libindex *ix = NULL;
+if (!b.failed)  { ix = idx_finish(&b); }
+free(b.dirs);
+free(b.kids);
+free(b.entries);
+free(b.pool);
+free(b.intern);
+return(ix);
+}
+
+int path_intree(char *canonpath, char *tree)
+{   // whether canonical path canonpath is tree or lies below it, "" is no tree
+int len = strlength(tree);
+if ((len == 0) || !strleftcomp(canonpath, tree)) { return(0); }
+return((canonpath[len] == 0) || (canonpath[len] == '/') || (len == 1));
+}
+
+int libindex_islibrary(relm3u_ctx *ctx, struct libindex *ix)
+{   // whether ix is the full index of the library tree, root '/' is kept as ""
+if (ix->maxdepth < IDXMAXDEPTH) { return(0); }
+return(strcomp(ix->rootpath, ctx->library) || ((ix->rootlen == 0) && strcomp(ctx->library, "/")));
+}
+
+char *libindex_treeof(relm3u_ctx *ctx, char *canonpath)
+{   // the tree to index for canonpath: the library tree when it holds canonpath
+return(path_intree(canonpath, ctx->library) ? ctx->library : canonpath);
+}
+
+struct libindex *libindex_find(relm3u_ctx *ctx, char *canonpath)
+{   // deliver full index of an already indexed tree that contains canonpath
+int canonlen = strlength(canonpath);
+int i = 0;
+for (i = 0; i < ctx->nroots; i++)
+    {
+        struct libindex *ix = ctx->roots[i];
+        if (ix->maxdepth < IDXMAXDEPTH)             { continue; }
+        if (!strleftcomp(canonpath, ix->rootpath))  { continue; }
+        if ((canonlen == ix->rootlen) || (canonpath[ix->rootlen] == '/') || (ix->rootlen == 0))
+            { return(ix); }
+    }
+return(NULL);
+}
+
+struct libindex *libindex_findpart(relm3u_ctx *ctx, char *canonpath, int maxdepth, char *skip)
+{   // deliver index of an already indexed tree that covers canonpath and
+    // maxdepth folders below it (itself counted), leaving out the tree skip;
+    // a full index covers it as well, with the tree skip in it
+struct libindex *ix = libindex_find(ctx, canonpath);
+if (ix != NULL) { return(ix); }
+int i = 0;
+for (i = 0; i < ctx->nroots; i++)
+    {
+        ix = ctx->roots[i];
+        if ((ix->maxdepth >= IDXMAXDEPTH) || !strcomp(ix->skip, skip))  { continue; }
+        if (!strleftcomp(canonpath, ix->rootpath))                      { continue; }
+        char *sub = canonpath + ix->rootlen;
+        if ((*sub != 0) && (*sub != '/') && (ix->rootlen > 0))          { continue; }
+        // folders from the root down to canonpath
+        int below = 0;
+        for (; *sub != 0; sub++) { if ((sub[0] == '/') && (sub[1] != 0)) { below++; } }
+        if (below + maxdepth <= ix->maxdepth) { return(ix); }
+    }
+return(NULL);
+}
+
+long long libindex_rootmtime(char *rootpath)
+{   // modification time of a root folder, root '/' given as ""
+struct stat st;
+if (stat((rootpath[0] != 0) ? rootpath : "/", &st) != 0) { return(-1); }
+return((long long)st.st_mtime);
+}
+
+int libindex_hasfailed(relm3u_ctx *ctx, char *rootpath, int maxdepth)
+{   // whether indexing rootpath maxdepth deep failed before and its root
+    // folder is unchanged since; caller holds the index lock
+int i = 0;
+for (i = 0; i < ctx->nfailed; i++)
+    {
+        struct idxfailed *f = &ctx->failed[i];
+        if (strcomp(f->rootpath, rootpath) && (f->maxdepth == maxdepth))
+            {   return(f->mtime == libindex_rootmtime(rootpath));   }
+    }
+return(0);
+}
+
+void libindex_setfailed(relm3u_ctx *ctx, char *rootpath, int maxdepth, long long mtime)
+{   // remember that indexing rootpath failed, the earliest one goes when full
+    // caller holds the index lock for writing
+int i = 0;
+while ((i < ctx->nfailed) && !(strcomp(ctx->failed[i].rootpath, rootpath) && (ctx->failed[i].maxdepth == maxdepth)))
+    {   i++;   }
+if (i == IDXMAXFAILED)
+    {
+        memmove(&ctx->failed[0], &ctx->failed[1], (IDXMAXFAILED - 1) * sizeof(struct idxfailed));
+        i = IDXMAXFAILED - 1;
+    }
+if (i == ctx->nfailed) { ctx->nfailed++; }
+sprintf(ctx->failed[i].rootpath, "%s", rootpath);
+ctx->failed[i].maxdepth = maxdepth;
+ctx->failed[i].mtime = mtime;
+return;
+}
+
+struct libindex *libindex_attach(relm3u_ctx *ctx, char *canonpath)
+{   // deliver index of an already indexed tree that contains canonpath,
+    // otherwise index canonpath as a new root (replacing contained roots)
+    // caller holds the index lock for writing
+    // return NULL when the tree cannot be indexed, or could not before and
+    // its root folder is unchanged since
+struct libindex *ix = libindex_find(ctx, canonpath);
+if (ix != NULL) { return(ix); }
+
+// root '/' is kept as empty string, so paths are composed without doubling
+char rootpath[PATHMAX];
+int canonlen = strlength(canonpath);
+sprintf(rootpath, "%s", canonpath);
+if ((canonlen > 0) && (rootpath[canonlen - 1] == '/')) { rootpath[--canonlen] = 0; }
+if (libindex_hasfailed(ctx, rootpath, IDXMAXDEPTH)) { return(NULL); }
+
+// index files are only written at the top of the library tree
+int persist = (ctx->flags & RELM3U_PERSIST_INDEX) && strcomp(canonpath, ctx->library);
+ix = libindex_load(rootpath);
+if ((ix == NULL) || !libindex_unchanged(ix, rootpath, 0, 1))
+    {
+        long long mtime = libindex_rootmtime(rootpath);
+        struct libindex *fresh = libindex_build(rootpath, ix, IDXMAXDEPTH, "");
+        libindex_free(ix);
+        ix = fresh;
+        if (ix == NULL) { libindex_setfailed(ctx, rootpath, IDXMAXDEPTH, mtime); return(NULL); }
+        if (persist) { libindex_save(ix, rootpath); }
+    }
+sprintf(ix->rootpath, "%s", rootpath);
+ix->rootlen = canonlen;
+ix->maxdepth = IDXMAXDEPTH;
+ix->persist = persist;
+
+// drop roots which the new root covers anyway, only now that it is there
+int i = 0;
+while (i < ctx->nroots)
+    {
+        struct libindex *old = ctx->roots[i];
+        if ( strleftcomp(old->rootpath, rootpath) &&
+             ((canonlen == 0) || (old->rootpath[canonlen] == '/') || (old->rootpath[canonlen] == 0)) )
+            {
+                libindex_free(old);
+                ctx->roots[i] = ctx->roots[--ctx->nroots];
+                continue;
+            }
+        i++;
+    }
+// an early root goes, the one attached just before may be needed along with
+// this one (see libindex_scope())
+if (ctx->nroots == IDXMAXROOTS) { libindex_free(ctx->roots[0]); ctx->roots[0] = ctx->roots[--ctx->nroots]; }
+
+ctx->roots[ctx->nroots++] = ix;
+return(ix);
+}
+
+struct libindex *libindex_attachpart(relm3u_ctx *ctx, char *canonpath, int maxdepth, char *skip)
+{   // deliver index of an already indexed tree that covers canonpath maxdepth
+    // folders deep without the tree skip, otherwise index it so as a new root
+    // kept in memory only, since it lies above the library tree
+    // caller holds the index lock for writing
+    // return NULL when the tree cannot be indexed
+struct libindex *ix = libindex_findpart(ctx, canonpath, maxdepth, skip);
+if (ix != NULL) { return(ix); }
+
+char rootpath[PATHMAX];
+int canonlen = strlength(canonpath);
+sprintf(rootpath, "%s", canonpath);
+if ((canonlen > 0) && (rootpath[canonlen - 1] == '/')) { rootpath[--canonlen] = 0; }
+if (libindex_hasfailed(ctx, rootpath, maxdepth)) { return(NULL); }
+
+long long mtime = libindex_rootmtime(rootpath);
+ix = libindex_build(rootpath, NULL, maxdepth, skip);
+if (ix == NULL) { libindex_setfailed(ctx, rootpath, maxdepth, mtime); return(NULL); }
+sprintf(ix->rootpath, "%s", rootpath);
+ix->rootlen = canonlen;
+ix->maxdepth = maxdepth;
+sprintf(ix->skip, "%s", skip);
+
+if (ctx->nroots == IDXMAXROOTS) { libindex_free(ctx->roots[0]); ctx->roots[0] = ctx->roots[--ctx->nroots]; }
+ctx->roots[ctx->nroots++] = ix;
+return(ix);
+}
+
+struct libindex *libindex_acquire(relm3u_ctx *ctx, char *canonpath)
+{   // deliver index of the tree containing canonpath with the index lock held
+    // for reading, indexing the tree first when necessary
+    // release with libindex_release(); return NULL (no lock held) on failure
+pthread_rwlock_rdlock(&ctx->indexlock);
+struct libindex *ix = libindex_find(ctx, canonpath);
+if (ix != NULL) { return(ix); }
+pthread_rwlock_unlock(&ctx->indexlock);
+
+pthread_rwlock_wrlock(&ctx->indexlock);
+libindex_attach(ctx, canonpath);
+pthread_rwlock_unlock(&ctx->indexlock);
+
+// another thread may have replaced the root meanwhile, so look up again
+pthread_rwlock_rdlock(&ctx->indexlock);
+ix = libindex_find(ctx, canonpath);
+if (ix == NULL) { pthread_rwlock_unlock(&ctx->indexlock); }
+return(ix);
+}
+
+void libindex_release(relm3u_ctx *ctx)
+{
+pthread_rwlock_unlock(&ctx->indexlock);
+return;
+}
+
+void libindex_refresh(relm3u_ctx *ctx)
+{   // bring all indexed trees up to date, re-reading only changed folders,
+    // and forget the folders met while probing; the trees are read again
+    // while lookups go on, the fresh indexes only take the write lock to be
+    // put in place of the old ones
+struct libindex *old[IDXMAXROOTS];
+struct libindex *fresh[IDXMAXROOTS];
+pthread_rwlock_rdlock(&ctx->indexlock);
+int n = ctx->nroots;
+int i = 0;
+for (i = 0; i < n; i++)
+    {
+        old[i] = ctx->roots[i];
+        fresh[i] = libindex_build(old[i]->rootpath, old[i], old[i]->maxdepth, old[i]->skip);
+        if (fresh[i] == NULL) { continue; }
+        sprintf(fresh[i]->rootpath, "%s", old[i]->rootpath);
+        fresh[i]->rootlen = old[i]->rootlen;
+        fresh[i]->maxdepth = old[i]->maxdepth;
+        sprintf(fresh[i]->skip, "%s", old[i]->skip);
+        fresh[i]->persist = old[i]->persist;
+        if (fresh[i]->persist) { libindex_save(fresh[i], fresh[i]->rootpath); }
+    }
+pthread_rwlock_unlock(&ctx->indexlock);
+
+pthread_rwlock_wrlock(&ctx->indexlock);
+for (i = 0; i < n; i++)
+    {
+        if (fresh[i] == NULL) { continue; }
+        // a root replaced meanwhile keeps its replacement
+        int j = 0;
+        while ((j < ctx->nroots) && (ctx->roots[j] != old[i])) { j++; }
+        if (j == ctx->nroots) { libindex_free(fresh[i]); continue; }
+        struct libindex *ix = old[i];
+        // fingerprints of unchanged files are taken over when needed again
+        fresh[i]->fpold = (ix->fp != NULL) ? ix->fp : ix->fpold;
+        if (ix->fp != NULL) { ix->fp = NULL; } else { ix->fpold = NULL; }
+        // cached tags are keyed by inode, they stay valid as they are
+        fresh[i]->tags = ix->tags;
+        ix->tags = NULL;
+        libindex_free(ix);
+        ctx->roots[j] = fresh[i];
+    }
+// trees that could not be indexed are tried again
+ctx->nfailed = 0;
+pthread_rwlock_unlock(&ctx->indexlock);
+
+pthread_rwlock_wrlock(&ctx->probelock);
+probecache_free(ctx);
+pthread_rwlock_unlock(&ctx->probelock);
+return;
+}
+
+int64_t libindex_finddir(struct libindex *ix, char *sub)
+{   // directory number of sub-path sub below the indexed root, "" for the root
+    // return (-1) when it is not indexed
+uint32_t d = 0;
+while (*sub)
+    {
+        char *end = sub;
+        while ((*end != 0) && (*end != '/')) { end++; }
+        int len = end - sub;
+        struct idxdir *dir = &ix->dirs[d];
+        uint32_t i = 0;
+        for (i = 0; i < dir->nkids; i++)
+            {
+                uint32_t kid = ix->kids[dir->firstkid + i];
+                if (kid & IDXKIDFILE) { continue; }
+                char *name = ix->pool + ix->dirs[kid].nameofs;
+                if ((strncmp(name, sub, len) == 0) && (name[len] == 0)) { break; }
+            }
+        if (i == dir->nkids) { return(-1); }
+        d = ix->kids[dir->firstkid + i];
+        sub = (*end == '/') ? end + 1 : end;
+    }
+return(d);
+}
+
+struct rankscope
+{   // the search folders of search methods 2 and 3 as seen from their indexes
+    int nlevels;
+    char searchpath[PROBELEVELS][PATHMAX + 3 * PROBELEVELS + 1];    // playlist folder, parent, ...
+    struct libindex *ix[PROBELEVELS];   // the index holding each of them
+    int64_t subdir[PROBELEVELS];    // their directory numbers there, (-1) = not covered
+    struct libindex *trees[2];      // the library tree, the tree above it
+    int ntrees;
+    char canon[PROBELEVELS][PATHMAX];
+    char remainder[PATHMAX];        // path below the search folder, see libindex_level()
+};
+
+int libindex_level(struct libindex *ix, uint32_t f, struct rankscope *sc)
+{   // nearest search folder holding file f within the 'find' depth limit,
+    // its path below that folder goes to sc->remainder; the folders above
+    // the file are walked once, whatever the number of search folders
+    // return (-1) when it is outside of all of them
+uint32_t up[FINDMAXDEPTH];      // folder of the file, its parent, ...
+int n = 0;
+uint32_t d = ix->entries[f].dir;
+while (1)
+    {
+        up[n++] = d;
+        if ((d == 0) || (n == FINDMAXDEPTH)) { break; }
+        d = ix->dirs[d].parent;
+    }
+int level = 0;
+for (level = 0; level < sc->nlevels; level++)
+    {
+        if ((sc->subdir[level] < 0) || (sc->ix[level] != ix)) { continue; }
+        int k = 0;
+        while ((k < n) && (up[k] != (uint32_t)sc->subdir[level])) { k++; }
+        if (k == n) { continue; }
+
+        // path below the search folder
+        char name[PATHMAX];
+        int len = 0;
+        int fits = 1;
+        while (fits && (k > 0))
+            {
+                char *comp = ix->pool + ix->dirs[up[--k]].nameofs;
+                int l = strlength(comp);
+                if (len + l + 2 > PATHMAX) { fits = 0; break; }
+                memcpy(sc->remainder + len, comp, l);
+                len += l;
+                sc->remainder[len++] = '/';
+            }
+        libindex_filename(ix, f, name);
+        int l = strlength(name);
+        if (!fits || (len + l + 1 > PATHMAX)) { continue; }
+        memcpy(sc->remainder + len, name, l + 1);
+
+        if (strlength(sc->searchpath[level]) + strlength(sc->remainder) >= PATHMAX)         { continue; }
+        // 'find' output containing a colon was always taken as an error message
+        if (strfindchr(sc->searchpath[level], ':') || strfindchr(sc->remainder, ':'))       { continue; }
+        return(level);
+    }
+return(-1);
+}
+
+uint32_t libindex_bound(struct libindex *ix, uint32_t lo, uint32_t hi, int k, char *comp, int upper)
+{   // first position in the order range lo..hi whose component k is not
+    // below comp (upper = 0), or above comp (upper = 1)
+char name[PATHMAX];
+while (lo < hi)
+    {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int c = idx_compcmp(idx_component(ix, ix->order[mid], k, name), comp);
+        if ((c < 0) || (upper && (c == 0)))    { lo = mid + 1; }
+        else                                    { hi = mid; }
+    }
+return(lo);
+}
+
+int libindex_scopefind(relm3u_ctx *ctx, struct rankscope *sc, int inlib, int top, int depth)
+{   // look up the indexes of a scope (see below) with the index lock held,
+    // return (0) when one is missing
+sc->trees[0] = (inlib >= 0) ? libindex_find(ctx, ctx->library) : NULL;
+sc->trees[1] = (top > inlib) ? libindex_findpart(ctx, sc->canon[top], depth, (inlib >= 0) ? ctx->library : "") : NULL;
+return( ((inlib < 0) || (sc->trees[0] != NULL)) && ((top <= inlib) || (sc->trees[1] != NULL)) );
+}
+
+int libindex_scope(relm3u_ctx *ctx, struct rankscope *sc, char *pllpath)
+{   // set up the search folders of the playlist folder pllpath and acquire
+    // the indexes covering them (release with libindex_release()): those in
+    // the library tree are looked up in its index, those above it in an
+    // index of the topmost one without the library tree, which only goes as
+    // deep as the 'find' depth limit below the nearest of them reaches
+    // return (1) on success, (0) when no search folder exists,
+    // return (-1) when no index is available
+int level = 0;
+int top = -1;
+int inlib = -1;
+char ups[3 * PROBELEVELS + 1];
+sc->nlevels = ctx->radius + 1;
+for (level = 0; level < sc->nlevels; level++)
+    {
+        sprintf(sc->searchpath[level], "%s%s", pllpath, (level == 0) ? "./" : updir_prefix(ups, level));
+        sc->ix[level] = NULL;
+        sc->subdir[level] = -1;
+        if (realpath(sc->searchpath[level], sc->canon[level]) != NULL) { top = level; }
+        else { sc->canon[level][0] = 0; }
+        if (path_intree(sc->canon[level], ctx->library)) { inlib = level; }
+    }
+if (top < 0) { return(0); }
+
+// the nearest search folder above the library tree lies top - inlib - 1
+// folders below the topmost one, files FINDMAXDEPTH - 1 folders below it
+int depth = top - inlib - 1 + FINDMAXDEPTH;
+pthread_rwlock_rdlock(&ctx->indexlock);
+if (!libindex_scopefind(ctx, sc, inlib, top, depth))
+    {
+        pthread_rwlock_unlock(&ctx->indexlock);
+        pthread_rwlock_wrlock(&ctx->indexlock);
+        if (inlib >= 0)     { libindex_attach(ctx, ctx->library); }
+        if (top > inlib)    { libindex_attachpart(ctx, sc->canon[top], depth, (inlib >= 0) ? ctx->library : ""); }
+        pthread_rwlock_unlock(&ctx->indexlock);
+
+        // another thread may have replaced a root meanwhile, so look up again
+        pthread_rwlock_rdlock(&ctx->indexlock);
+        if (!libindex_scopefind(ctx, sc, inlib, top, depth)) { pthread_rwlock_unlock(&ctx->indexlock); return(-1); }
+    }
+// a full index above the library tree holds it as well and serves alone
+if (sc->trees[1] == sc->trees[0]) { sc->trees[1] = NULL; }
+sc->ntrees = 0;
+if (sc->trees[0] != NULL) { sc->trees[sc->ntrees++] = sc->trees[0]; }
+if (sc->trees[1] != NULL) { sc->trees[sc->ntrees++] = sc->trees[1]; }
+
+for (level = 0; level <= top; level++)
+    {
+        struct libindex *ix = ((level <= inlib) || (sc->ntrees == 1)) ? sc->trees[0] : sc->trees[1];
+        char *canon = sc->canon[level];
+        if ((canon[0] == 0) || !strleftcomp(canon, ix->rootpath))  { continue; }
+        char *sub = canon + ix->rootlen;
+        if ((*sub != 0) && (*sub != '/') && (ix->rootlen > 0))      { continue; }
+        if (*sub == '/') { sub++; }
+        sc->ix[level] = ix;
+        sc->subdir[level] = libindex_finddir(ix, sub);
+    }
+return(1);
+}
+
+struct rankbest
+{   // best file met so far, over the indexes of a scope
+    struct libindex *ix;
+    int file;               // (-1) for none
+    int level;
+    int len;                // path components shared with the entry
+    int ties;               // other files sharing as many
+};
+
+void rank_take(struct rankbest *rb, struct libindex *ix, uint32_t f, int lv, int len)
+{   // weigh file f of index ix in search folder lv, sharing len components
+if (len < rb->len) { return; }
+if (len > rb->len) { rb->ties = 0; rb->file = -1; rb->len = len; }
+if (rb->file >= 0) { rb->ties++; }
+if ( (rb->file < 0) || (lv < rb->level) ||
+     ((lv == rb->level) && (ix == rb->ix) && (f < (uint32_t)rb->file)) )
+    {   rb->ix = ix; rb->file = f; rb->level = lv;  }
+return;
+}
+
+void libindex_rankin(struct libindex *ix, struct rankscope *sc, char **comps, int ncomps, char *searchkey, struct rankbest *rb)
+{   // rank the files of index ix for libindex_rank()
+if ((searchkey == NULL) && (ncomps > 0))
+    {   // narrow the range of files sharing the last k components for k = 1, 2, ...
+        uint32_t lo[IDXMAXCOMPS + 1];
+        uint32_t hi[IDXMAXCOMPS + 1];
+        int depth = 0;
+        lo[0] = 0;
+        hi[0] = ix->hdr->nfiles;
+        while (depth < ncomps)
+            {
+                uint32_t l = libindex_bound(ix, lo[depth], hi[depth], depth, comps[depth], 0);
+                uint32_t h = libindex_bound(ix, l, hi[depth], depth, comps[depth], 1);
+                if (l == h) { break; }
+                depth++;
+                lo[depth] = l;
+                hi[depth] = h;
+            }
+        // the deepest range holding files within the search folders wins
+        int found = 0;
+        while ((depth > 0) && (depth >= rb->len) && !found)
+            {
+                uint32_t i = 0;
+                for (i = lo[depth]; i < hi[depth]; i++)
+                    {
+                        uint32_t f = ix->order[i];
+                        int lv = libindex_level(ix, f, sc);
+                        if (lv < 0) { continue; }
+                        found = 1;
+                        rank_take(rb, ix, f, lv, depth);
+                    }
+                depth--;
+            }
+    }
+else if (ncomps > 0)
+    {   // files with the same key are few, they are ranked one by one
+        uint32_t h = idx_namehash(searchkey);
+        char key[PATHMAX];
+        char name[PATHMAX];
+        uint32_t e = ix->keybuckets[h & (ix->hdr->nbuckets - 1)];
+        while (e > 0)
+            {
+                uint32_t f = e - 1;
+                struct idxentry *ie = &ix->entries[f];
+                e = ie->keynext;
+                if (ie->keyhash != h) { continue; }
+                if (unikey_make(libindex_filename(ix, f, name), key, PATHMAX) < 0)    { continue; }
+                if (!strcomp(key, searchkey))                                           { continue; }
+                int lv = libindex_level(ix, f, sc);
+                if (lv < 0) { continue; }
+                int len = 1;
+                char *comp;
+                while ( (len < ncomps) && ((comp = idx_component(ix, f, len, name)) != NULL) &&
+                        (idx_foldcmp(comp, comps[len]) == 0) )  { len++; }
+                rank_take(rb, ix, f, lv, len);
+            }
+    }
+return;
+}
+
+int libindex_rank(relm3u_ctx *ctx, char *relpath, char *pathfilestr, char *pllpath, char *searchkey, int *ties)
+{   // UNIX: search the file of a playlist entry below the search folders
+    // (see SEARCH FOLDERS) in their indexes; of the files with the same
+    // name (or with normalised key searchkey, when given) the one sharing
+    // most path components with the entry from the end is taken, then the
+    // one in the nearest folder, then the first one in traversal order
+    // returns (1) on success;      relpath = path relative to the playlist,
+    //                              *ties = other files sharing as many components
+    // returns (0) no entry found;  relpath = ""
+    // returns (-1) when no index is available
+relpath[0] = 0;
+*ties = 0;
+struct rankscope *sc = malloc(sizeof(struct rankscope));
+if (sc == NULL) { return(-1); }
+int scope = libindex_scope(ctx, sc, pllpath);
+if (scope <= 0) { free(sc); return(scope); }
+
+// path components of the entry from the end, the filename first
+char entry[PATHMAX];
+sprintf(entry, "%s", pathfilestr);
+char *comps[IDXMAXCOMPS];
+int ncomps = 0;
+char *c = entry + strlength(entry);
+while ((c > entry) && (ncomps < IDXMAXCOMPS))
+    {
+        char *end = c;
+        while ((c > entry) && (c[-1] != '/')) { c--; }
+        int len = end - c;
+        if ((len > 0) && !((len == 1) && (c[0] == '.')) && !((len == 2) && (c[0] == '.') && (c[1] == '.')))
+            {   comps[ncomps++] = c;   }
+        if (c > entry) { c--; *c = 0; }
+    }
+
+struct rankbest rb = { NULL, -1, PROBELEVELS, 0, 0 };
+int t = 0;
+for (t = 0; t < sc->ntrees; t++) { libindex_rankin(sc->trees[t], sc, comps, ncomps, searchkey, &rb); }
+if (rb.file >= 0)
+    {
+        libindex_level(rb.ix, rb.file, sc);
+        sprintf(relpath, "%s%s", sc->searchpath[rb.level], sc->remainder);
+        // remove prepended playlist path
+        strlefttrim(relpath, pllpath);
+    }
+*ties = rb.ties;
+libindex_release(ctx);
+free(sc);
+return(rb.file >= 0);
+}
+
+// SEARCH METHOD 2 for LINUX
+int find_relpath_by_search(relm3u_ctx *ctx, char *pathfilestr, char *pllpath, struct relm3u_stats *ps)
+{   // LINUX: find relative path for a file from absolute pathfilestr, if possible
+    // uses the mighty 'find' utility function on Unix/Linux
+    // names differing in case, Unicode form or separators are matched as well,
+    // of several candidates the one sharing most of the entry's path is taken
+    // processes started are counted in ps
+    // return (1) on success, return (0) on failure (file not found)
+    // return (2) on success, when other files matched equally well
+
+// int i;
+
+int updir = 0;
+
+char testpath [PATHMAX];
+char searchpath[PATHMAX + 3 * PROBELEVELS + 1];
+
+// isolate filename from path
+char searchfile[1024] = ""; get_only_filename(searchfile, pathfilestr);
+
+// its normalised key finds variants in case, Unicode form and separators
+char searchkey[PATHMAX] = "";
+int keyed = (unikey_make(searchfile, searchkey, PATHMAX) > 0);
+
+// look up the filename in the index, by its key when it is not there as it is
+int ties = 0;
+int found = libindex_rank(ctx, testpath, pathfilestr, pllpath, NULL, &ties);
+char ups[3 * PROBELEVELS + 1];
+if ((found == 0) && keyed)
+    {
+        found = libindex_rank(ctx, testpath, pathfilestr, pllpath, searchkey, &ties);
+        if (found > 0) { stats_add(&ps->key_hits, 1); }
+    }
+if (found > 0)
+    {
+        sprintf(pathfilestr, "%s", testpath);
+        return((ties > 0) ? 2 : 1);
+    }
+if (found == 0) { return(0); }
+
+// fall back to shell 'find' when the tree could not be indexed
+// joker-out misleading square brackets, which are yet allowed in filenames
+int i = 0;
+while (searchfile[i] != 0)
+    {
+        if (searchfile[i] == '[') { searchfile[i] = '?'; }
+        if (searchfile[i] == ']') { searchfile[i] = '?'; }
+        i++;
+    }
+
+// each level leaves out the folder searched one level below, 'find' has been
+// through all of it within the depth limit already
+char prunepath[2 * PATHMAX] = "";
+char canon[PATHMAX];
+while (updir <= ctx->radius)
+    {
+        sprintf(searchpath, "%s%s", pllpath, (updir == 0) ? "./" : updir_prefix(ups, updir));
+
+        // note: uses shell 'find' with filename 'searchfile' on path 'searchpath'
+        stats_add(&ps->spawns, 1);
+        if (shell_search_unix(testpath, searchpath, searchfile, (prunepath[0] != 0) ? prunepath : NULL))
+            {       // remove prepended playlist path and return relative path
+                    strlefttrim(testpath, pllpath);
+                    sprintf(pathfilestr, "%s", testpath);
+                    return(1);
+            }
+
+        // the name of this folder as 'find' will see it from its parent,
+        // not left out when it cannot be given as pattern
+        prunepath[0] = 0;
+        char *name = ((updir < ctx->radius) && (realpath(searchpath, canon) != NULL)) ? strrchr(canon, '/') : NULL;
+        if ((name != NULL) && (name[1] != 0) && (strcspn(name, "\\\"$`") == strlen(name)))
+            {
+                int len = sprintf(prunepath, "%s%s", pllpath, updir_prefix(ups, updir + 1));
+                for (name++; *name != 0; name++)
+                    {   // wildcards of the -path pattern taken literally
+                        if (strchr("*?[", *name) != NULL) { prunepath[len++] = '\\'; }
+                        prunepath[len++] = *name;
+                    }
+                prunepath[len] = 0;
+            }
+        updir++;
+    }
+return(0);
+}
+
+// SEARCH METHOD 3 for LINUX
+int fprec_cmp(const void *a, const void *b)
+{   // order cache records by device and inode
+const struct fprec *x = a, *y = b;
+if (x->dev != y->dev) { return((x->dev < y->dev) ? -1 : 1); }
+if (x->ino != y->ino) { return((x->ino < y->ino) ? -1 : 1); }
+return(0);
+}
+
+int fpentry_cmp(const void *a, const void *b)
+{   // order fingerprints by size, hash, then traversal order
+const struct fpentry *x = a, *y = b;
+if (x->size != y->size) { return((x->size < y->size) ? -1 : 1); }
+if (x->hash != y->hash) { return((x->hash < y->hash) ? -1 : 1); }
+return((x->file < y->file) ? -1 : (x->file > y->file));
+}
+
+struct fprec *fpcache_load(char *rootpath, uint32_t *nrecs)
+{   // read the fingerprint cache of a tree, sorted by device and inode
+    // return NULL when there is none
+char path[PATHMAX + 16];
+sprintf(path, "%s/%s", rootpath, FPFILENAME);
+*nrecs = 0;
+FILE *fp = fopen(path, "rb");
+if (fp == NULL) { return(NULL); }
+struct fpheader h;
+struct fprec *recs = NULL;
+if ( (fread(&h, sizeof(h), 1, fp) == 1) && (memcmp(h.magic, FPMAGIC, 8) == 0) &&
+     (h.version == FPVERSION) && (h.nrecs > 0) && (h.nrecs < 0x10000000u) )
+    {
+        recs = malloc((size_t)h.nrecs * sizeof(struct fprec));
+        if ((recs != NULL) && (fread(recs, sizeof(struct fprec), h.nrecs, fp) == h.nrecs))
+            {
+                qsort(recs, h.nrecs, sizeof(struct fprec), fprec_cmp);
+                *nrecs = h.nrecs;
+            }
+        else { free(recs); recs = NULL; }
+    }
+fclose(fp);
+return(recs);
+}
+
+int fpcache_save(struct fpindex *fx, struct libindex *ix)
+{   // write the fingerprint cache next to the index file, return (0) on failure
+char path[PATHMAX + 16];
+char tmppath[PATHMAX + 32];
+sprintf(path, "%s/%s", ix->rootpath, FPFILENAME);
+sprintf(tmppath, "%s.tmp", path);
+int rootclean = libindex_rootclean(ix);
+
+FILE *fp = fopen(tmppath, "wb");
+if (fp == NULL) { return(0); }
+struct fpheader h;
+memset(&h, 0, sizeof(h));
+memcpy(h.magic, FPMAGIC, 8);
+h.version = FPVERSION;
+h.nrecs = fx->nrecs;
+int ok = (fwrite(&h, sizeof(h), 1, fp) == 1) && (fwrite(fx->recs, sizeof(struct fprec), fx->nrecs, fp) == fx->nrecs);
+if ((fclose(fp) != 0) || !ok)       { unlink(tmppath); return(0); }
+if (rename(tmppath, path) != 0)     { unlink(tmppath); return(0); }
+return(libindex_rootwritten(ix, rootclean));
+}
+
+struct fpwork
+{   // fingerprints of one tree being taken
+    struct libindex *ix;
+    struct fprec *old;          // cache, sorted by device and inode
+    uint32_t nold;
+    struct fprec *recs;         // per file number, size 0 = none
+    uint32_t next;              // first file not claimed by a reader yet
+    pthread_mutex_t lock;
+    struct relm3u_stats *ps;
+};
+
+void *fp_worker(void *arg)
+{   // take the fingerprints of batches of files until none are left
+struct fpwork *w = arg;
+struct libindex *ix = w->ix;
+char relpath[PATHMAX];
+char path[2 * PATHMAX + 2];
+while (1)
+    {
+        pthread_mutex_lock(&w->lock);
+        uint32_t f = w->next;
+        uint32_t end = (ix->hdr->nfiles - f > FPBATCH) ? f + FPBATCH : ix->hdr->nfiles;
+        w->next = end;
+        pthread_mutex_unlock(&w->lock);
+        if (f >= end) { break; }
+
+        for (; f < end; f++)
+            {
+                struct fprec *r = &w->recs[f];
+                memset(r, 0, sizeof(struct fprec));
+                if (libindex_path(ix, f, relpath, PATHMAX) < 0) { continue; }
+                sprintf(path, "%s/%s", ix->rootpath, relpath);
+                struct stat st;
+                if ((stat(path, &st) != 0) || !S_ISREG(st.st_mode) || (st.st_size == 0)) { continue; }
+                r->dev = st.st_dev;
+                r->ino = st.st_ino;
+                r->mtime_sec = st.st_mtime;
+                r->mtime_nsec = st.st_mtim.tv_nsec;
+
+                // unchanged since cached: same inode, size and mtime
+                struct fprec *c = NULL;
+                if (w->old != NULL) { c = bsearch(r, w->old, w->nold, sizeof(struct fprec), fprec_cmp); }
+                if ( (c != NULL) && (c->size == (uint64_t)st.st_size) &&
+                     (c->mtime_sec == r->mtime_sec) && (c->mtime_nsec == r->mtime_nsec) )
+                    {   r->size = c->size; r->hash = c->hash; continue;    }
+
+                int fd = open(path, O_RDONLY);
+                if (fd < 0) { continue; }
+                struct fprint fp;
+                if (fprint_fd(fd, st.st_size, &fp)) { r->size = fp.size; r->hash = fp.hash; }
+                close(fd);
+                stats_add(&w->ps->fingerprints, 1);
+            }
+    }
+return(NULL);
+}
+
+struct fpindex *fpindex_build(struct libindex *ix, struct relm3u_stats *ps)
+{   // take the fingerprints of all files of an indexed tree, on FPJOBS threads
+    // return NULL when memory is short
+uint32_t n = ix->hdr->nfiles;
+struct fpindex *fx = calloc(1, sizeof(struct fpindex));
+if (fx == NULL) { return(NULL); }
+struct fpwork w;
+memset(&w, 0, sizeof(w));
+w.ix = ix;
+w.ps = ps;
+w.recs = malloc((size_t)n * sizeof(struct fprec) + 1);
+fx->entries = malloc((size_t)n * sizeof(struct fpentry) + 1);
+if ((w.recs == NULL) || (fx->entries == NULL)) { fpindex_free(fx); free(w.recs); return(NULL); }
+
+// the fingerprints of the index replaced last serve as cache, else the file
+struct fprec *loaded = NULL;
+if (ix->fpold != NULL)  { w.old = ix->fpold->recs; w.nold = ix->fpold->nrecs; }
+else                    { loaded = fpcache_load(ix->rootpath, &w.nold); w.old = loaded; }
+
+pthread_mutex_init(&w.lock, NULL);
+pthread_t tids[FPJOBS];
+int started = 0;
+while ((started < FPJOBS - 1) && ((uint32_t)started * FPBATCH < n))
+    {
+        if (pthread_create(&tids[started], NULL, fp_worker, &w) != 0) { break; }
+        started++;
+    }
+fp_worker(&w);
+while (started > 0) { pthread_join(tids[--started], NULL); }
+pthread_mutex_destroy(&w.lock);
+free(loaded);
+fpindex_free(ix->fpold);
+ix->fpold = NULL;
+
+// the same records, once sorted by content and once by inode
+uint32_t f = 0;
+for (f = 0; f < n; f++)
+    {
+        if (w.recs[f].size == 0) { continue; }
+        struct fpentry *e = &fx->entries[fx->nentries++];
+        e->size = w.recs[f].size;
+        e->hash = w.recs[f].hash;
+        e->file = f;
+        w.recs[fx->nrecs++] = w.recs[f];
+    }
+qsort(fx->entries, fx->nentries, sizeof(struct fpentry), fpentry_cmp);
+qsort(w.recs, fx->nrecs, sizeof(struct fprec), fprec_cmp);
+fx->recs = w.recs;
+if (ix->persist) { fpcache_save(fx, ix); }
+return(fx);
+}
+
+struct fpindex *fpindex_get(relm3u_ctx *ctx, struct libindex *ix, struct relm3u_stats *ps)
+{   // deliver the fingerprints of an acquired index, taking them first when necessary
+pthread_mutex_lock(&ctx->fplock);
+if (ix->fp == NULL) { ix->fp = fpindex_build(ix, ps); }
+struct fpindex *fx = ix->fp;
+pthread_mutex_unlock(&ctx->fplock);
+return(fx);
+}
+
+int fprint_original(relm3u_ctx *ctx, char *entry, char *pllpath, struct fprint *fp, struct relm3u_stats *ps)
+{   // fingerprint of the original file of a normalised playlist entry where it
+    // still exists: at the path of the entry (absolute or relative to the
+    // playlist), or below a snapshot folder by as many trailing components of
+    // that path as possible
+    // return (0) when it does not exist anywhere
+char origin[2][2 * PATHMAX + 2];
+sprintf(origin[0], "/%s", entry);
+if (realpath((pllpath[0] == 0) ? "." : pllpath, origin[1]) == NULL) { origin[1][0] = 0; }
+else { sprintf(origin[1] + strlength(origin[1]), "/%s", entry); path_normalise(origin[1]); }
+
+char path[3 * PATHMAX];
+int found = 0;
+int o = 0;
+for (o = 0; (o < 2) && !found; o++)
+    {
+        if (origin[o][0] == 0) { continue; }
+        found = fprint_file(origin[o], fp);
+        int i = 0;
+        for (i = 0; (i < ctx->nsnapshots) && !found; i++)
+            {
+                char *tail = origin[o] + 1;
+                while ((tail != NULL) && (*tail != 0) && !found)
+                    {
+                        sprintf(path, "%s/%s", ctx->snapshots[i], tail);
+                        found = fprint_file(path, fp);
+                        tail = strchr(tail, '/');
+                        if (tail != NULL) { tail++; }
+                    }
+            }
+    }
+if (found) { stats_add(&ps->fingerprints, 1); }
+return(found);
+}
+
+int find_relpath_by_content(relm3u_ctx *ctx, char *pathfilestr, char *pllpath, struct fprint *known, struct relm3u_stats *ps)
+{   // LINUX: find a renamed file by the content of its original, known from
+    // the last run (known, or NULL) or read where the original still exists;
+    // of several files with that content the one in the nearest folder is
+    // taken, then the first one in traversal order
+    // return (1) on success, pathfilestr = relative path
+    // return (2) on success, when other files have the same content
+    // return (0) on failure (file not found)
+struct fprint fp;
+if ((known != NULL) && (known->size > 0))                   { fp = *known; }
+else if (!fprint_original(ctx, pathfilestr, pllpath, &fp, ps))       { return(0); }
+
+struct rankscope *sc = malloc(sizeof(struct rankscope));
+if (sc == NULL) { return(0); }
+if (libindex_scope(ctx, sc, pllpath) <= 0) { free(sc); return(0); }
+
+struct rankbest rb = { NULL, -1, PROBELEVELS, 0, 0 };
+int t = 0;
+for (t = 0; t < sc->ntrees; t++)
+    {
+        struct libindex *ix = sc->trees[t];
+        struct fpindex *fx = fpindex_get(ctx, ix, ps);
+        uint32_t lo = 0;
+        uint32_t hi = (fx != NULL) ? fx->nentries : 0;
+        while (lo < hi)
+            {   // first fingerprint not below fp
+                uint32_t mid = lo + (hi - lo) / 2;
+                struct fpentry *e = &fx->entries[mid];
+                if ((e->size < fp.size) || ((e->size == fp.size) && (e->hash < fp.hash)))  { lo = mid + 1; }
+                else                                                                        { hi = mid; }
+            }
+        while ((fx != NULL) && (lo < fx->nentries) && (fx->entries[lo].size == fp.size) && (fx->entries[lo].hash == fp.hash))
+            {
+                uint32_t f = fx->entries[lo++].file;
+                int lv = libindex_level(ix, f, sc);
+                if (lv >= 0) { rank_take(&rb, ix, f, lv, 1); }
+            }
+    }
+if (rb.file >= 0)
+    {
+        libindex_level(rb.ix, rb.file, sc);
+        sprintf(pathfilestr, "%s%s", sc->searchpath[rb.level], sc->remainder);
+        // remove prepended playlist path
+        strlefttrim(pathfilestr, pllpath);
+    }
+libindex_release(ctx);
+free(sc);
+if (rb.file < 0) { return(0); }
+return((rb.ties > 0) ? 2 : 1);
+}
+
+// -----------------------------------------------------------------------------
+// MUSIC FILE TAGS (UNIX)
+//
+// The tag fields playlists are generated from and #EXTINF lines are made of.
+// Of a file only the tag is read: the wanted frames of its ID3v2 tag (the ID3v1
+// tag at the end when there is no ID3v2 tag) or the atoms down
+// moov/udta/meta/ilst of an MP4 file; pictures are skipped, of the audio data
+// only the first MPEG frame is looked at when the tag holds no duration. Files
+// are looked up in batches through the tag cache (see TAG CACHE), only those
+// not cached as they are now are read.
+
+#define TAGBATCH      16            // files looked up at once
+#define TAGTEXT       RELM3U_TAGTEXT    // bytes kept of a text field
+#define TAGFRAMEMAX   1024          // bytes read of a wanted frame or atom
+#define TAGSYNCMAX    (1024 * 1024) // bytes read of an ID3v2 tag unsynchronised as a whole
+
+#define TAGANY        1             // tag fields found, tagdata.found
+#define TAGALBUM      2
+#define TAGTRACK      4
+#define TAGYEAR       8
+#define TAGTITLE      16
+#define TAGLENGTH     32            // duration, from the tag or the audio stream
+#define TAGARTIST     64
+
+#define MPEGSCAN      4096          // bytes after the ID3v2 tag searched for the first frame
+
+struct tagdata
+{   // the tag fields playlists are sorted by, and those of #EXTINF lines
+    char album[TAGTEXT];
+    char title[TAGTEXT];
+    char artist[TAGTEXT];
+    int track;
+    int year;
+    int yearprio;           // date the year came from: release 3, original 2, recording 1
+    int duration;           // milliseconds, 0 = unknown
+    int found;              // TAG... bits
+};
+
+void tag_pututf8(char *out, size_t size, size_t *len, uint32_t cp)
+{   // append code point cp as UTF-8 when it fits
+char b[4];
+int n = 0;
+if (cp < 0x80)          { b[n++] = cp; }
+else if (cp < 0x800)    { b[n++] = 0xC0 | (cp >> 6); b[n++] = 0x80 | (cp & 0x3F); }
+else if (cp < 0x10000)  { b[n++] = 0xE0 | (cp >> 12); b[n++] = 0x80 | ((cp >> 6) & 0x3F); b[n++] = 0x80 | (cp & 0x3F); }
+else                    { b[n++] = 0xF0 | (cp >> 18); b[n++] = 0x80 | ((cp >> 12) & 0x3F); b[n++] = 0x80 | ((cp >> 6) & 0x3F); b[n++] = 0x80 | (cp & 0x3F); }
+if (*len + n >= size) { return; }
+memcpy(out + *len, b, n);
+*len += n;
+out[*len] = 0;
+return;
+}
+
+void tag_text(const unsigned char *p, size_t n, int enc, char *out, size_t size)
+{   // first string of an ID3v2 text field in encoding enc (0 ISO-8859-1,
+    // 1 UTF-16 with byte order mark, 2 UTF-16BE, 3 UTF-8) as UTF-8 into out
+size_t len = 0;
+size_t i = 0;
+out[0] = 0;
+if ((enc == 1) || (enc == 2))
+    {
+        int be = (enc == 2);
+        if ((n >= 2) && (p[0] == 0xFF) && (p[1] == 0xFE))      { be = 0; i = 2; }
+        else if ((n >= 2) && (p[0] == 0xFE) && (p[1] == 0xFF)) { be = 1; i = 2; }
+        while (i + 1 < n)
+            {
+                uint32_t u = be ? (p[i] << 8 | p[i + 1]) : (p[i + 1] << 8 | p[i]);
+                i += 2;
+                if (u == 0) { break; }
+                if ((u >= 0xD800) && (u < 0xDC00) && (i + 1 < n))
+                    {   // surrogate pair
+                        uint32_t l = be ? (p[i] << 8 | p[i + 1]) : (p[i + 1] << 8 | p[i]);
+                        if ((l >= 0xDC00) && (l < 0xE000)) { u = 0x10000 + ((u - 0xD800) << 10) + (l - 0xDC00); i += 2; }
+                    }
+                tag_pututf8(out, size, &len, u);
+            }
+        return;
+    }
+for (i = 0; (i < n) && (p[i] != 0); i++)
+    {
+        if ((enc == 3) || (p[i] < 0x80))
+            {   if (len + 1 < size) { out[len++] = p[i]; out[len] = 0; }   }
+        else
+            {   tag_pututf8(out, size, &len, p[i]);  }
+    }
+return;
+}
+
+int tag_number(char *s, int *n)
+{   // leading decimal number of a text field ("3/12" delivers 3)
+    // return (0) when it does not start with a digit
+while (*s == ' ') { s++; }
+if ((*s < '0') || (*s > '9')) { return(0); }
+*n = atoi(s);
+return(1);
+}
+
+void tag_date(struct tagdata *td, char *s, int prio)
+{   // year of a date field, the best date wins as eyed3 getBestDate() picks it;
+    // a date not starting with four digits counts as present, year 0
+if ((s[0] == 0) || (prio <= td->yearprio)) { return; }
+int i = 0;
+while ((i < 4) && (s[i] >= '0') && (s[i] <= '9')) { i++; }
+td->year = (i == 4) ? atoi(s) : 0;
+td->yearprio = prio;
+td->found |= TAGYEAR;
+return;
+}
+
+void id3_frame(struct tagdata *td, char *id, const unsigned char *data, size_t n)
+{   // take over an ID3v2 text frame when it is a wanted one
+char text[TAGTEXT];
+if ((n < 2) || (id[0] != 'T')) { return; }
+tag_text(data + 1, n - 1, data[0], text, TAGTEXT);
+if (!strcmp(id, "TALB") || !strcmp(id, "TAL"))
+    {   if (text[0] != 0) { sprintf(td->album, "%s", text); td->found |= TAGALBUM; }  }
+else if (!strcmp(id, "TIT2") || !strcmp(id, "TT2"))
+    {   if (text[0] != 0) { sprintf(td->title, "%s", text); td->found |= TAGTITLE; }  }
+else if (!strcmp(id, "TPE1") || !strcmp(id, "TP1"))
+    {   if (text[0] != 0) { sprintf(td->artist, "%s", text); td->found |= TAGARTIST; }  }
+else if (!strcmp(id, "TRCK") || !strcmp(id, "TRK"))
+    {   if (tag_number(text, &td->track)) { td->found |= TAGTRACK; }   }
+else if (!strcmp(id, "TLEN") || !strcmp(id, "TLE"))
+    {   if (tag_number(text, &td->duration) && (td->duration > 0)) { td->found |= TAGLENGTH; }  }
+else if (!strcmp(id, "TDRL"))                                               { tag_date(td, text, 3); }
+else if (!strcmp(id, "TDOR") || !strcmp(id, "TORY") || !strcmp(id, "TOR"))  { tag_date(td, text, 2); }
+else if (!strcmp(id, "TDRC") || !strcmp(id, "TYER") || !strcmp(id, "TYE"))  { tag_date(td, text, 1); }
+return;
+}
+
+size_t id3_unsync(unsigned char *p, size_t n)
+{   // undo unsynchronisation in place (0xFF 0x00 -> 0xFF), return new length
+size_t i = 0;
+size_t j = 0;
+for (i = 0; i < n; i++)
+    {
+        p[j++] = p[i];
+        if ((p[i] == 0xFF) && (i + 1 < n) && (p[i + 1] == 0)) { i++; }
+    }
+return(j);
+}
+
+uint32_t id3_syncsafe(const unsigned char *p)
+{
+return((uint32_t)p[0] << 21 | (uint32_t)p[1] << 14 | (uint32_t)p[2] << 7 | p[3]);
+}
+
+struct id3src
+{   // the frames of an ID3v2 tag, read from the file as needed, or from memory
+    // when the tag was unsynchronised as a whole
+    int fd;
+    unsigned char *mem;
+    size_t size;            // bytes after the tag header
+};
+
+int id3_get(struct id3src *src, size_t ofs, unsigned char *buf, size_t n)
+{
+if ((ofs > src->size) || (n > src->size - ofs)) { return(0); }
+if (src->mem != NULL) { memcpy(buf, src->mem + ofs, n); return(1); }
+return(fprint_read(src->fd, buf, n, 10 + ofs));
+}
+
+size_t id3v2_read(int fd, struct tagdata *td)
+{   // the wanted frames of an ID3v2.2/2.3/2.4 tag at the start of the file
+    // return its length in bytes, (0) when there is none
+unsigned char h[10];
+if (!fprint_read(fd, h, 10, 0) || (memcmp(h, "ID3", 3) != 0) || (h[3] < 2) || (h[3] > 4)) { return(0); }
+if ((h[6] | h[7] | h[8] | h[9]) & 0x80) { return(0); }
+int ver = h[3];
+struct id3src src;
+src.fd = fd;
+src.mem = NULL;
+src.size = id3_syncsafe(h + 6);
+size_t taglen = 10 + src.size + (((ver == 4) && (h[5] & 0x10)) ? 10 : 0);    // footer
+td->found |= TAGANY;
+if ((h[5] & 0x80) && (ver < 4))
+    {   // unsynchronised as a whole, frame sizes count the bytes as restored
+        size_t n = (src.size < TAGSYNCMAX) ? src.size : TAGSYNCMAX;
+        src.mem = malloc(n + 1);
+        if ((src.mem == NULL) || !fprint_read(fd, src.mem, n, 10)) { free(src.mem); return(taglen); }
+        src.size = id3_unsync(src.mem, n);
+    }
+
+size_t pos = 0;
+unsigned char fh[10];
+if ((h[5] & 0x40) && (ver >= 3) && id3_get(&src, 0, fh, 4))
+    {   // extended header: its size excludes the size field in 2.3, not in 2.4
+        pos = (ver == 3) ? 4 + ((uint32_t)fh[0] << 24 | fh[1] << 16 | fh[2] << 8 | fh[3]) : id3_syncsafe(fh);
+    }
+int idlen = (ver == 2) ? 3 : 4;
+int hlen = (ver == 2) ? 6 : 10;
+unsigned char data[TAGFRAMEMAX];
+while (id3_get(&src, pos, fh, hlen) && (fh[0] != 0))
+    {
+        char id[5];
+        memcpy(id, fh, idlen);
+        id[idlen] = 0;
+        size_t size = 0;
+        int flags = 0;
+        if (ver == 2)       { size = (uint32_t)fh[3] << 16 | fh[4] << 8 | fh[5]; }
+        else if (ver == 3)  { size = (uint32_t)fh[4] << 24 | fh[5] << 16 | fh[6] << 8 | fh[7]; flags = fh[9]; }
+        else                { size = id3_syncsafe(fh + 4); flags = fh[9]; }
+        pos += hlen;
+        if (size > src.size - pos) { break; }
+
+        // compressed and encrypted frames are passed over
+        int skip = (ver == 3) ? (flags & 0xC0) : (ver == 4) ? (flags & 0x0C) : 0;
+        if ((id[0] == 'T') && !skip)
+            {
+                size_t n = (size < TAGFRAMEMAX) ? size : TAGFRAMEMAX;
+                if (id3_get(&src, pos, data, n))
+                    {
+                        unsigned char *d = data;
+                        if (((ver == 3) && (flags & 0x20)) || ((ver == 4) && (flags & 0x40))) { d++; n--; }    // group
+                        if ((ver == 4) && (flags & 0x01) && (n >= 4)) { d += 4; n -= 4; }  // data length
+                        if ((ver == 4) && ((flags & 0x02) || (h[5] & 0x80))) { n = id3_unsync(d, n); }
+                        id3_frame(td, id, d, n);
+                    }
+            }
+        pos += size;
+    }
+free(src.mem);
+return(taglen);
+}
+
+void tag_latin1(const unsigned char *p, size_t n, char *out, size_t size)
+{   // fixed-size ISO-8859-1 field of an ID3v1 tag, without trailing blanks
+while ((n > 0) && ((p[n - 1] == ' ') || (p[n - 1] == 0))) { n--; }
+unsigned char field[32];
+memcpy(field, p, n);
+field[n] = 0;
+tag_text(field, n + 1, 0, out, size);
+return;
+}
+
+int id3v1_read(int fd, off_t filesize, struct tagdata *td)
+{   // the ID3v1 tag in the last 128 bytes, return (0) when there is none
+unsigned char t[128];
+if ((filesize < 128) || !fprint_read(fd, t, 128, filesize - 128) || (memcmp(t, "TAG", 3) != 0)) { return(0); }
+td->found |= TAGANY;
+tag_latin1(t + 3, 30, td->title, TAGTEXT);
+if (td->title[0] != 0) { td->found |= TAGTITLE; }
+tag_latin1(t + 33, 30, td->artist, TAGTEXT);
+if (td->artist[0] != 0) { td->found |= TAGARTIST; }
+tag_latin1(t + 63, 30, td->album, TAGTEXT);
+if (td->album[0] != 0) { td->found |= TAGALBUM; }
+char year[8];
+tag_latin1(t + 93, 4, year, sizeof(year));
+tag_date(td, year, 1);
+if ((t[125] == 0) && (t[126] != 0)) { td->track = t[126]; td->found |= TAGTRACK; }     // ID3v1.1
+return(1);
+}
+
+int mpeg_header(const unsigned char *b, int *kbps, int *rate, int *spf, int *framelen)
+{   // decode an MPEG audio frame header, return (0) when b is none
+static const short kbpstab[5][15] =
+{   {   0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448   },   // MPEG-1 layer I
+    {   0, 32, 48, 56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320, 384   },   // MPEG-1 layer II
+    {   0, 32, 40, 48,  56,  64,  80,  96, 112, 128, 160, 192, 224, 256, 320   },   // MPEG-1 layer III
+    {   0, 32, 48, 56,  64,  80,  96, 112, 128, 144, 160, 176, 192, 224, 256   },   // MPEG-2/2.5 layer I
+    {   0,  8, 16, 24,  32,  40,  48,  56,  64,  80,  96, 112, 128, 144, 160   }    // MPEG-2/2.5 layer II, III
+};
+static const int ratetab[3] = { 44100, 48000, 32000 };
+if ((b[0] != 0xFF) || ((b[1] & 0xE0) != 0xE0)) { return(0); }
+int ver = (b[1] >> 3) & 3;          // 3 MPEG-1, 2 MPEG-2, 0 MPEG-2.5
+int layer = 4 - ((b[1] >> 1) & 3); // 1, 2, 3
+int bri = b[2] >> 4;
+int sri = (b[2] >> 2) & 3;
+if ((ver == 1) || (layer == 4) || (bri == 0) || (bri == 15) || (sri == 3)) { return(0); }
+int pad = (b[2] >> 1) & 1;
+*kbps = kbpstab[(ver == 3) ? layer - 1 : (layer == 1) ? 3 : 4][bri];
+*rate = ratetab[sri] >> ((ver == 3) ? 0 : (ver == 2) ? 1 : 2);
+*spf = (layer == 1) ? 384 : ((layer == 3) && (ver != 3)) ? 576 : 1152;
+*framelen = (layer == 1) ? (12000 * *kbps / *rate + pad) * 4 : 125 * *spf * *kbps / *rate + pad;
+return(1);
+}
+
+void mpeg_length(int fd, size_t start, off_t filesize, struct tagdata *td)
+{   // duration of an MPEG audio stream from its first frame: the frame count
+    // of a Xing, Info or VBRI header, else the bitrate of constant bitrate files
+unsigned char b[MPEGSCAN];
+off_t end = filesize;
+if ((end >= 128) && fprint_read(fd, b, 3, end - 128) && (memcmp(b, "TAG", 3) == 0)) { end -= 128; }
+if ((off_t)start >= end) { return; }
+size_t n = (end - start < MPEGSCAN) ? end - start : MPEGSCAN;
+if (!fprint_read(fd, b, n, start)) { return; }
+size_t i = 0;
+int kbps = 0, rate = 0, spf = 0, framelen = 0;
+for (i = 0; i + 4 <= n; i++)
+    {   // a frame header followed by another one
+        int k2, r2, s2, f2;
+        if (!mpeg_header(b + i, &kbps, &rate, &spf, &framelen)) { continue; }
+        if ((i + framelen + 4 <= n) && mpeg_header(b + i + framelen, &k2, &r2, &s2, &f2)) { break; }
+    }
+if (i + 4 > n) { return; }
+
+// side information precedes a Xing or Info header, a VBRI header follows 32 bytes
+int mono = ((b[i + 3] >> 6) == 3);
+size_t x = i + 4 + ((((b[i + 1] >> 3) & 3) == 3) ? (mono ? 17 : 32) : (mono ? 9 : 17));
+uint64_t frames = 0;
+if ( (x + 12 <= n) && ((memcmp(b + x, "Xing", 4) == 0) || (memcmp(b + x, "Info", 4) == 0)) &&
+     (b[x + 7] & 1) )
+    {   frames = (uint32_t)b[x + 8] << 24 | b[x + 9] << 16 | b[x + 10] << 8 | b[x + 11];   }
+else if ((i + 36 + 18 <= n) && (memcmp(b + i + 36, "VBRI", 4) == 0))
+    {   x = i + 36 + 14; frames = (uint32_t)b[x] << 24 | b[x + 1] << 16 | b[x + 2] << 8 | b[x + 3];    }
+uint64_t ms = (frames > 0) ? frames * spf * 1000 / rate : (uint64_t)(end - start - i) * 8 / kbps;
+if ((ms > 0) && (ms < 0x7FFFFFFF)) { td->duration = ms; td->found |= TAGLENGTH; }
+return;
+}
+
+int mp4_child(int fd, uint64_t *start, uint64_t *end, const char *type)
+{   // narrow the range [start, end) of a box payload to that of its first
+    // child box of type; return (0) when there is none
+uint64_t pos = *start;
+while (pos + 8 <= *end)
+    {
+        unsigned char b[16];
+        if (!fprint_read(fd, b, 8, pos)) { return(0); }
+        uint64_t size = (uint64_t)b[0] << 24 | b[1] << 16 | b[2] << 8 | b[3];
+        int hlen = 8;
+        if (size == 1)
+            {   // 64 bit size
+                if ((pos + 16 > *end) || !fprint_read(fd, b + 8, 8, pos + 8)) { return(0); }
+                size = 0;
+                int i = 0;
+                for (i = 8; i < 16; i++) { size = size << 8 | b[i]; }
+                hlen = 16;
+            }
+        else if (size == 0) { size = *end - pos; }  // up to the end
+        if ((size < (uint64_t)hlen) || (size > *end - pos)) { return(0); }
+        if (memcmp(b + 4, type, 4) == 0)
+            {
+                *start = pos + hlen;
+                *end = pos + size;
+                return(1);
+            }
+        pos += size;
+    }
+return(0);
+}
+
+int mp4_read(int fd, off_t filesize, struct tagdata *td)
+{   // the wanted items below moov/udta/meta/ilst (or moov/meta/ilst)
+    // return (0) when there is no item list
+uint64_t ms = 0, me = filesize;
+if (!mp4_child(fd, &ms, &me, "moov")) { return(0); }
+uint64_t s = ms, e = me;
+unsigned char data[TAGFRAMEMAX];
+if (mp4_child(fd, &s, &e, "mvhd") && (e - s >= 32) && fprint_read(fd, data, 32, s))
+    {   // movie header: timescale and duration, 32 bit in version 0, else 64 bit
+        uint64_t scale = 0, dur = 0;
+        int i = 0;
+        if (data[0] == 0)   { for (i = 12; i < 16; i++) { scale = scale << 8 | data[i]; dur = dur << 8 | data[i + 4]; } }
+        else                { for (i = 20; i < 24; i++) { scale = scale << 8 | data[i]; } for (i = 24; i < 32; i++) { dur = dur << 8 | data[i]; } }
+        uint64_t msec = (scale > 0) ? dur * 1000 / scale : 0;
+        if ((msec > 0) && (msec < 0x7FFFFFFF)) { td->duration = msec; td->found |= TAGLENGTH; }
+    }
+s = ms;
+e = me;
+if (!mp4_child(fd, &s, &e, "udta") || !mp4_child(fd, &s, &e, "meta"))
+    {   s = ms; e = me; if (!mp4_child(fd, &s, &e, "meta")) { return(0); }   }
+s += 4;     // version and flags of the full box 'meta'
+if ((s > e) || !mp4_child(fd, &s, &e, "ilst")) { return(0); }
+td->found |= TAGANY;
+
+static const char *items[5] = { "\251alb", "trkn", "\251day", "\251nam", "\251ART" };
+int i = 0;
+for (i = 0; i < 5; i++)
+    {   // an item holds a box 'data': type, locale and the value
+        uint64_t is = s, ie = e;
+        if (!mp4_child(fd, &is, &ie, items[i]) || !mp4_child(fd, &is, &ie, "data") || (ie - is < 8)) { continue; }
+        size_t n = (ie - is - 8 < TAGFRAMEMAX) ? ie - is - 8 : TAGFRAMEMAX;
+        if (!fprint_read(fd, data, n, is + 8)) { continue; }
+        char text[TAGTEXT];
+        if (i == 1)
+            {   // track number and total, 16 bit each after two bytes
+                if (n >= 4) { td->track = data[2] << 8 | data[3]; td->found |= TAGTRACK; }
+                continue;
+            }
+        tag_text(data, n, 3, text, TAGTEXT);
+        if (i == 0)
+            {   if (text[0] != 0) { sprintf(td->album, "%s", text); td->found |= TAGALBUM; }  }
+        else if (i == 3)
+            {   if (text[0] != 0) { sprintf(td->title, "%s", text); td->found |= TAGTITLE; }  }
+        else if (i == 4)
+            {   if (text[0] != 0) { sprintf(td->artist, "%s", text); td->found |= TAGARTIST; }  }
+        else
+            {   tag_date(td, text, 1);   }
+    }
+return(1);
+}
+
+int tag_isaudio(char *name)
+{   // files playlists are made of
+return( (fnmatch("*.mp3", name, FNM_CASEFOLD) == 0) ||
+        (fnmatch("*.m4a", name, FNM_CASEFOLD) == 0) );
+}
+
+void tag_read(char *path, struct tagdata *td)
+{   // the tag fields of a music file, "" and 0 where missing
+memset(td, 0, sizeof(struct tagdata));
+int fd = open(path, O_RDONLY);
+if (fd < 0) { return; }
+struct stat st;
+if (fstat(fd, &st) == 0)
+    {
+        if (fnmatch("*.m4a", path, FNM_CASEFOLD) == 0)  { mp4_read(fd, st.st_size, td); }
+        else
+            {
+                size_t taglen = id3v2_read(fd, td);
+                if (taglen == 0) { id3v1_read(fd, st.st_size, td); }
+                if (!(td->found & TAGLENGTH)) { mpeg_length(fd, taglen, st.st_size, td); }
+            }
+    }
+close(fd);
+return;
+}
+
+// TAG CACHE
+uint32_t tagcache_hash(uint64_t dev, uint64_t ino)
+{
+uint64_t h = (ino ^ (dev << 40) ^ (dev >> 24)) * 0x9E3779B97F4A7C15ull;
+return((uint32_t)(h >> 32));
+}
+
+uint32_t tagcache_find(struct tagcache *tc, uint64_t dev, uint64_t ino)
+{   // slot of a file, or the free slot where it goes
+uint32_t i = tagcache_hash(dev, ino) & (tc->size - 1);
+while ( (tc->slots[i].ino != 0) && ((tc->slots[i].ino != ino) || (tc->slots[i].dev != dev)) )
+    {   i = (i + 1) & (tc->size - 1);   }
+return(i);
+}
+
+int tagcache_grow(struct tagcache *tc)
+{   // double the table, return (0) when memory is short
+uint32_t newsize = (tc->size == 0) ? 1024 : tc->size * 2;
+struct tagrec *newslots = calloc(newsize, sizeof(struct tagrec));
+if (newslots == NULL) { return(0); }
+struct tagrec *old = tc->slots;
+uint32_t oldsize = tc->size;
+tc->slots = newslots;
+tc->size = newsize;
+uint32_t i = 0;
+for (i = 0; i < oldsize; i++)
+    {
+        if (old[i].ino != 0) { tc->slots[tagcache_find(tc, old[i].dev, old[i].ino)] = old[i]; }
+    }
+free(old);
+return(1);
+}
+
+uint32_t tagcache_string(struct tagcache *tc, char *str)
+{   // put a string into the pool, offset 0 is the empty string
+int len = strlength(str);
+if (len == 0) { return(0); }
+uint32_t ofs = (tc->poolused > 0) ? tc->poolused : 1;
+if (ofs + len + 1 > tc->poolsize)
+    {
+        uint32_t newsize = (tc->poolsize == 0) ? 65536 : tc->poolsize;
+        while (ofs + len + 1 > newsize) { newsize *= 2; }
+        char *p = realloc(tc->pool, newsize);
+        if (p == NULL) { return(0); }
+        tc->pool = p;
+        tc->pool[0] = 0;
+        tc->poolsize = newsize;
+    }
+memcpy(tc->pool + ofs, str, len + 1);
+tc->poolused = ofs + len + 1;
+return(ofs);
+}
+
+void tagcache_put(struct tagcache *tc, struct tagrec *key, struct tagdata *td)
+{   // keep the tag fields of a file, replacing those of its former state
+if ((2 * (tc->used + 1) > tc->size) && !tagcache_grow(tc)) { return; }
+struct tagrec *r = &tc->slots[tagcache_find(tc, key->dev, key->ino)];
+if (r->ino == 0) { tc->used++; }
+*r = *key;
+r->duration = td->duration;
+r->track = td->track;
+r->year = td->year;
+r->found = td->found;
+r->yearprio = td->yearprio;
+r->met = 1;
+r->album = (td->found & TAGALBUM) ? tagcache_string(tc, td->album) : 0;
+r->title = (td->found & TAGTITLE) ? tagcache_string(tc, td->title) : 0;
+r->artist = (td->found & TAGARTIST) ? tagcache_string(tc, td->artist) : 0;
+tc->dirty = 1;
+return;
+}
+
+void tagcache_take(struct tagcache *tc, struct tagrec *r, struct tagdata *td)
+{   // the tag fields of a cached file
+memset(td, 0, sizeof(struct tagdata));
+if (r->album != 0)  { sprintf(td->album, "%s", tc->pool + r->album); }
+if (r->title != 0)  { sprintf(td->title, "%s", tc->pool + r->title); }
+if (r->artist != 0) { sprintf(td->artist, "%s", tc->pool + r->artist); }
+td->track = r->track;
+td->year = r->year;
+td->yearprio = r->yearprio;
+td->duration = r->duration;
+td->found = r->found;
+return;
+}
+
+struct tagcache *tagcache_load(char *rootpath)
+{   // read the tag cache of a tree, an empty one when there is none
+    // return NULL when memory is short
+struct tagcache *tc = calloc(1, sizeof(struct tagcache));
+if ((tc == NULL) || !tagcache_grow(tc)) { tagcache_free(tc); return(NULL); }
+char path[PATHMAX + 16];
+sprintf(path, "%s/%s", rootpath, TAGFILENAME);
+FILE *fp = fopen(path, "rb");
+if (fp == NULL) { return(tc); }
+struct tagheader h;
+struct tagrec *recs = NULL;
+char *pool = NULL;
+if ( (fread(&h, sizeof(h), 1, fp) == 1) && (memcmp(h.magic, TAGMAGIC, 8) == 0) &&
+     (h.version == TAGVERSION) && (h.nrecs < 0x10000000u) && (h.poolsize > 0) && (h.poolsize < 0x80000000u) )
+    {
+        recs = malloc((size_t)h.nrecs * sizeof(struct tagrec) + 1);
+        pool = malloc(h.poolsize);
+        if ( (recs != NULL) && (pool != NULL) &&
+             (fread(recs, sizeof(struct tagrec), h.nrecs, fp) == h.nrecs) &&
+             (fread(pool, 1, h.poolsize, fp) == h.poolsize) && (pool[h.poolsize - 1] == 0) )
+            {   // the pool is taken over as it is, the records go into the table
+                free(tc->pool);
+                tc->pool = pool;
+                tc->poolused = tc->poolsize = h.poolsize;
+                pool = NULL;
+                uint32_t i = 0;
+                for (i = 0; i < h.nrecs; i++)
+                    {
+                        struct tagrec *r = &recs[i];
+                        if ((r->ino == 0) || (r->album >= h.poolsize) || (r->title >= h.poolsize) || (r->artist >= h.poolsize)) { continue; }
+                        if ((2 * (tc->used + 1) > tc->size) && !tagcache_grow(tc)) { break; }
+                        struct tagrec *slot = &tc->slots[tagcache_find(tc, r->dev, r->ino)];
+                        if (slot->ino == 0) { tc->used++; }
+                        *slot = *r;
+                        slot->met = 0;
+                    }
+            }
+    }
+free(recs);
+free(pool);
+fclose(fp);
+return(tc);
+}
+
+int tagcache_save(struct tagcache *tc, struct libindex *ix)
+{   // write the tag cache next to the index file, return (0) on failure
+    // records of files not looked up in this run are left out when there are
+    // more records than indexed files, those of deleted files among them
+char path[PATHMAX + 16];
+char tmppath[PATHMAX + 32];
+sprintf(path, "%s/%s", ix->rootpath, TAGFILENAME);
+sprintf(tmppath, "%s.tmp", path);
+int prune = (tc->used > ix->hdr->nfiles);
+
+// records and a compacted pool
+struct tagcache out;
+memset(&out, 0, sizeof(out));
+struct tagrec *recs = malloc((size_t)tc->used * sizeof(struct tagrec) + 1);
+if (recs == NULL) { return(0); }
+uint32_t n = 0;
+uint32_t i = 0;
+for (i = 0; i < tc->size; i++)
+    {
+        struct tagrec *r = &tc->slots[i];
+        if ((r->ino == 0) || (prune && !r->met)) { continue; }
+        recs[n] = *r;
+        recs[n].met = 0;
+        recs[n].album = (r->album != 0) ? tagcache_string(&out, tc->pool + r->album) : 0;
+        recs[n].title = (r->title != 0) ? tagcache_string(&out, tc->pool + r->title) : 0;
+        recs[n].artist = (r->artist != 0) ? tagcache_string(&out, tc->pool + r->artist) : 0;
+        n++;
+    }
+char nopool = 0;
+if (out.poolused == 0) { out.poolused = 1; }
+
+int rootclean = libindex_rootclean(ix);
+FILE *fp = fopen(tmppath, "wb");
+if (fp == NULL) { free(recs); free(out.pool); return(0); }
+struct tagheader h;
+memset(&h, 0, sizeof(h));
+memcpy(h.magic, TAGMAGIC, 8);
+h.version = TAGVERSION;
+h.nrecs = n;
+h.poolsize = out.poolused;
+int ok = (fwrite(&h, sizeof(h), 1, fp) == 1) && (fwrite(recs, sizeof(struct tagrec), n, fp) == n) &&
+         (fwrite((out.pool != NULL) ? out.pool : &nopool, 1, out.poolused, fp) == out.poolused);
+free(recs);
+free(out.pool);
+if ((fclose(fp) != 0) || !ok)       { unlink(tmppath); return(0); }
+if (rename(tmppath, path) != 0)     { unlink(tmppath); return(0); }
+tc->dirty = 0;
+return(libindex_rootwritten(ix, rootclean));
+}
+
+struct tagcache *tagcache_get(relm3u_ctx *ctx, struct libindex *ix)
+{   // deliver the tag cache of an acquired index, loading it first when necessary
+    // return NULL when memory is short
+pthread_rwlock_rdlock(&ctx->taglock);
+struct tagcache *tc = ix->tags;
+pthread_rwlock_unlock(&ctx->taglock);
+if (tc != NULL) { return(tc); }
+pthread_rwlock_wrlock(&ctx->taglock);
+if (ix->tags == NULL) { ix->tags = tagcache_load(ix->rootpath); }
+tc = ix->tags;
+pthread_rwlock_unlock(&ctx->taglock);
+return(tc);
+}
+
+void tagcache_flush(relm3u_ctx *ctx, struct libindex *ix)
+{   // write the tag cache of an acquired index when it changed, with
+    // RELM3U_PERSIST_INDEX and at the top of the library tree
+if (!ix->persist) { return; }
+pthread_rwlock_wrlock(&ctx->taglock);
+if ((ix->tags != NULL) && ix->tags->dirty) { tagcache_save(ix->tags, ix); }
+pthread_rwlock_unlock(&ctx->taglock);
+return;
+}
+
+struct tagquery
+{   // one file of a batch looked up
+    char *path;             // absolute path, given
+    struct tagdata *td;     // its tag fields, delivered
+    struct tagrec key;      // device, inode, size and mtime; ino 0 = cannot stat
+    int cached;
+};
+
+int tags_get(relm3u_ctx *ctx, struct libindex *ix, struct tagquery *q, int n, struct relm3u_stats *ps)
+{   // tag fields of a batch of files below an acquired index (ix NULL: none),
+    // from the tag cache where a file is unchanged, read from the file otherwise
+    // return the number of files read
+struct tagcache *tc = (ix != NULL) ? tagcache_get(ctx, ix) : NULL;
+int i = 0;
+for (i = 0; i < n; i++)
+    {
+        struct stat st;
+        memset(&q[i].key, 0, sizeof(struct tagrec));
+        q[i].cached = 0;
+        if ((stat(q[i].path, &st) != 0) || !S_ISREG(st.st_mode)) { continue; }
+        q[i].key.dev = st.st_dev;
+        q[i].key.ino = st.st_ino;
+        q[i].key.size = st.st_size;
+        q[i].key.mtime_sec = st.st_mtime;
+        q[i].key.mtime_nsec = st.st_mtim.tv_nsec;
+    }
+
+// unchanged since cached: same inode, size and mtime
+if (tc != NULL)
+    {
+        pthread_rwlock_rdlock(&ctx->taglock);
+        for (i = 0; i < n; i++)
+            {
+                struct tagrec *k = &q[i].key;
+                if (k->ino == 0) { continue; }
+                struct tagrec *r = &tc->slots[tagcache_find(tc, k->dev, k->ino)];
+                if ( (r->ino == 0) || (r->size != k->size) ||
+                     (r->mtime_sec != k->mtime_sec) || (r->mtime_nsec != k->mtime_nsec) ) { continue; }
+                tagcache_take(tc, r, q[i].td);
+                __atomic_store_n(&r->met, 1, __ATOMIC_RELAXED);
+                q[i].cached = 1;
+            }
+        pthread_rwlock_unlock(&ctx->taglock);
+    }
+
+int nread = 0;
+int ncached = 0;
+for (i = 0; i < n; i++)
+    {
+        if (q[i].cached) { ncached++; continue; }
+        tag_read(q[i].path, q[i].td);
+        if (q[i].key.ino != 0) { nread++; }
+    }
+stats_add(&ps->tags_read, nread);
+stats_add(&ps->tags_cached, ncached);
+if ((tc == NULL) || (nread == 0)) { return(nread); }
+pthread_rwlock_wrlock(&ctx->taglock);
+for (i = 0; i < n; i++)
+    {
+        if (!q[i].cached && (q[i].key.ino != 0)) { tagcache_put(tc, &q[i].key, q[i].td); }
+    }
+pthread_rwlock_unlock(&ctx->taglock);
+return(nread);
+}
+
+int tags_intree(struct libindex *ix, char *canonpath)
+{
+return(strleftcomp(canonpath, ix->rootpath) && (canonpath[ix->rootlen] == '/'));
+}
+
+int tags_canon(const char *path, char *canonpath)
+{   // canonical path of a music file, return (0) when it is none
+return( (strlen(path) < PATHMAX) && tag_isaudio((char *)path) && (realpath(path, canonpath) != NULL) );
+}
+
+int tags_of_files(relm3u_ctx *ctx, const char **paths, int n, struct relm3u_tags *tags, struct relm3u_stats *ps)
+{   // tag fields of music files, looked up in batches of files of the same
+    // indexed tree; the tag cache of a tree is written when its files are done
+    // return the number of files read
+struct tagquery q[TAGBATCH];
+struct tagdata *td = malloc(TAGBATCH * sizeof(struct tagdata));
+char (*canon)[PATHMAX] = malloc(TAGBATCH * sizeof(*canon));
+if ((td == NULL) || (canon == NULL)) { free(td); free(canon); return(0); }
+int nread = 0;
+int i = 0;
+while (i < n)
+    {
+        if (!tags_canon(paths[i], canon[0])) { i++; continue; }
+        char folder[PATHMAX];
+        sprintf(folder, "%s", canon[0]);
+        *strrchr(folder, '/') = 0;
+        struct libindex *ix = libindex_acquire(ctx, libindex_treeof(ctx, (folder[0] != 0) ? folder : "/"));
+        int k = 1;
+        while (1)
+            {   // following files of the same tree join the batch, without a tree one goes alone
+                while ( (ix != NULL) && (k < TAGBATCH) && (i + k < n) &&
+                        tags_canon(paths[i + k], canon[k]) && tags_intree(ix, canon[k]) ) { k++; }
+                int j = 0;
+                for (j = 0; j < k; j++) { q[j].path = canon[j]; q[j].td = &td[j]; }
+                nread += tags_get(ctx, ix, q, k, ps);
+                for (j = 0; j < k; j++)
+                    {
+                        struct relm3u_tags *t = &tags[i + j];
+                        sprintf(t->album, "%s", td[j].album);
+                        sprintf(t->title, "%s", td[j].title);
+                        sprintf(t->artist, "%s", td[j].artist);
+                        t->track = td[j].track;
+                        t->year = td[j].year;
+                        t->duration_ms = td[j].duration;
+                        t->tagged = ((td[j].found & TAGANY) != 0);
+                    }
+                i += k;
+                if ((ix == NULL) || (k < TAGBATCH) || (i == n)) { break; }
+                if (!tags_canon(paths[i], canon[0]) || !tags_intree(ix, canon[0])) { break; }
+                k = 1;
+            }
+        if (ix != NULL) { tagcache_flush(ctx, ix); libindex_release(ctx); }
+    }
+free(td);
+free(canon);
+return(nread);
+}
+
+#endif
+
+
+// SEARCH METHOD 2 for WINDOWS
+#ifdef __WIN32__
+int shell_search_windows(char *dirlinestr, char *pathpatstr, char *searchfile)
+{   // WINDOWS: outputs first found file's full path (forward)
+    // using 'dir' utility from standard command shell
+    // pathpatstr is the reference path
+    // searchfile is the glob to search
+    // returns (1) on success;      dirlinestr = fullpath+filename+extension
+    // returns (0) no entry found;  dirlinestr = ""
+
+slashestobackslashes(pathpatstr);   // necessary for command shell commands
+//slashestobackslashes(searchfile);   // normally not necessary
+
+// puts(dirlinestr);
+// puts(pathpatstr);
+// puts(searchfile);
+
+FILE *fp;
+char cmdstr[PATHMAX] = "";
+// this 'dir' syntax delivers line-separated strings of *full path*
+sprintf (cmdstr, "dir \"%s\\%s\" /B /S 2>&1", pathpatstr, searchfile);
+//~ puts(cmdstr);
+
+if ((fp = popen(cmdstr, "r")) == NULL)     { return(0); }
+int i = 0;
+if (fgets(dirlinestr, PATHMAX, fp) != NULL)
+    {
+        // trim control characters (trailing cr/lf) and drop empty line
+        strlinetrim(dirlinestr);
+        if (dirlinestr[i]==0)               { pclose(fp); return(0); }
+
+        // convert path to forward slashes
+        backslashestoslashes(dirlinestr);
+
+        // detect no-path return
+        if (!strfindchr(dirlinestr, '/'))   { pclose(fp); return(0); }
+        if (!strfindchr(dirlinestr, ':'))   { pclose(fp); return(0); }
+
+        pclose(fp);
+        return(1);
+    }
+puts("UPS");
+pclose(fp);
+return(0);
+}
+
+// SEARCH METHOD 2 for WINDOWS
+int find_relpath_by_search(relm3u_ctx *ctx, char *pathfilestr, char *pllpath, struct relm3u_stats *ps)
+{   // WINDOWS: find relative path for a file from absolute pathfilestr, if possible
+    // processes started are counted in ps
+    // return (1) on success, return (0) on failure (file not found)
+
+// puts("PATHSEARCH");
+// 'dir' keeps no state between calls, only the search radius is taken from ctx
+
+int updir = 0;
+char ups[3 * PROBELEVELS + 1];
+
+char probepath [PATHMAX];
+char searchpath[PATHMAX + 3 * PROBELEVELS + 1];
+
+backslashestoslashes(pllpath);
+backslashestoslashes(pathfilestr);
+
+// puts(pllpath);
+
+// isolate filename from path
+char searchfile[PATHMAX] = "";
+get_only_filename(searchfile, pathfilestr);
+
+while (updir <= ctx->radius)
+    {
+        sprintf(searchpath, "%s%s", pllpath, (updir == 0) ? "./" : updir_prefix(ups, updir));
+
+        // note: uses shell 'dir' with filename 'searchfile' on path 'searchpath'
+        stats_add(&ps->spawns, 1);
+        if (shell_search_windows(probepath, searchpath, searchfile))
+            {
+                //printf("PLL PATH  : <%s>\n", pllpath);
+                // remove identical part of playlist path
+                strleftcutident(probepath, pllpath);
+
+                //printf("FOUNDPATH : <%s>\n", probepath);
+                // restore directory-upsteps to preceede relative path
+
+                snprintf(pathfilestr, PATHMAX, "%s%s", (updir == 0) ? "./" : updir_prefix(ups, updir), probepath);
+
+                backslashestoslashes(pathfilestr);
+                return(1);
+            }
+
+        updir++;
+    }
+
+return(0);
+}
+#endif
+
+
+// -----------------------------------------------------------------------------
+// PLAYLIST FILE I/O
+//
+// A playlist is mapped into memory (read in one piece where mmap() is not
+// available) and split into lines in place, it is never copied line by line.
+// The new playlist is assembled in one growable buffer and written at once.
+
+struct playlistdata
+{   // content of one playlist, not NUL-terminated
+    char *data;
+    size_t len;
+    int mapped;             // (1) data is a mmap() view, (0) it is malloc()ed
+};
+
+struct outbuf
+{   // growable output buffer
+    char *data;
+    size_t used, size;
+    int failed;             // (1) memory ran short, content is incomplete
+};
+
+int playlist_load(char *m3ufilepath, struct playlistdata *pl)
+{   // map or read the whole playlist, return (0) on failure
+char filename[PATHMAX] = "";
+sprintf(filename, "%s", m3ufilepath);
+pl->data = NULL;
+pl->len = 0;
+pl->mapped = 0;
+
+#ifdef UNIXES
+int fd = open(filename, O_RDONLY);
+if (fd < 0) { return(0); }
+struct stat st;
+if ((fstat(fd, &st) == 0) && S_ISREG(st.st_mode) && (st.st_size > 0))
+    {
+        void *p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+            {
+                madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+                pl->data = p;
+                pl->len = (size_t)st.st_size;
+                pl->mapped = 1;
+                close(fd);
+                return(1);
+            }
+    }
+close(fd);
+#endif
+
+#ifdef _WIN32
+slashestobackslashes(filename);
+#endif
+
+// read it in one piece: empty files, no mmap() or no regular file
+FILE *fp = fopen(filename, "rb");
+if (fp == NULL) { return(0); }
+size_t size = 65536;
+pl->data = malloc(size);
+while (pl->data != NULL)
+    {
+        pl->len += fread(pl->data + pl->len, 1, size - pl->len, fp);
+        if (pl->len < size) { break; }
+        char *p = realloc(pl->data, size * 2);
+        if (p == NULL) { free(pl->data); pl->data = NULL; break; }
+        pl->data = p;
+        size = size * 2;
+    }
+int failed = ferror(fp);
+fclose(fp);
+if ((pl->data == NULL) || failed) { free(pl->data); pl->data = NULL; return(0); }
+return(1);
+}
+
+void playlist_unload(struct playlistdata *pl)
+{   // release what playlist_load() delivered
+#ifdef UNIXES
+if (pl->mapped) { munmap(pl->data, pl->len); }
+else            { free(pl->data); }
+#else
+free(pl->data);
+#endif
+pl->data = NULL;
+pl->len = 0;
+pl->mapped = 0;
+return;
+}
+
+int playlist_nextline(struct playlistdata *pl, size_t *pos, char **line, size_t *len)
+{   // deliver the line at *pos in place, without its '\n', and step past it
+    // return (0) when there are no more lines
+if (*pos >= pl->len) { return(0); }
+char *start = pl->data + *pos;
+char *eol = memchr(start, '\n', pl->len - *pos);
+*line = start;
+*len = (eol != NULL) ? (size_t)(eol - start) : pl->len - *pos;
+*pos += *len + ((eol != NULL) ? 1 : 0);
+return(1);
+}
+
+void outbuf_add(struct outbuf *ob, const char *s, size_t len)
+{   // append len bytes of s
+if (ob->failed) { return; }
+if (ob->used + len > ob->size)
+    {
+        size_t n = (ob->size == 0) ? 65536 : ob->size * 2;
+        while (ob->used + len > n) { n = n * 2; }
+        char *p = realloc(ob->data, n);
+        if (p == NULL) { ob->failed = 1; return; }
+        ob->data = p;
+        ob->size = n;
+    }
+memcpy(ob->data + ob->used, s, len);
+ob->used += len;
+return;
+}
+
+void outbuf_addline(struct outbuf *ob, const char *s)
+{   // append one playlist line with the line end of the system
+outbuf_add(ob, s, strlen(s));
+#ifdef _WIN32
+outbuf_add(ob, "\r\n", 2);
+#else
+outbuf_add(ob, "\n", 1);
+#endif
+return;
+}
+
+int writewholefile(char *path, const char *data, size_t len)
+{   // replace the content of a file in one go, return (0) on failure
+char filename[PATHMAX] = "";
+sprintf(filename, "%s", path);
+
+#ifdef UNIXES
+int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+if (fd < 0) { return(0); }
+size_t done = 0;
+while (done < len)
+    {
+        ssize_t n = write(fd, data + done, len - done);
+        if (n < 0)
+            {
+                if (errno == EINTR) { continue; }
+                close(fd);
+                return(0);
+            }
+        done += (size_t)n;
+    }
+if (close(fd) != 0) { return(0); }
+return(1);
+#else
+slashestobackslashes(filename);
+FILE *fp = fopen(filename, "wb");
+if (fp == NULL) { return(0); }
+int ok = (fwrite(data, 1, len, fp) == len);
+if (fclose(fp) != 0) { ok = 0; }
+return(ok);
+#endif
+}
+
+int write_counted(char *path, const char *data, size_t len, struct relm3u_stats *ps)
+{   // writewholefile(), counted in ps
+long long t0 = now_ns();
+int done = writewholefile(path, data, len);
+stats_add(&ps->write_ns, now_ns() - t0);
+if (done) { stats_add(&ps->bytes_written, len); }
+return(done);
+}
+
+// -----------------------------------------------------------------------------
+// DUPLICATE ENTRIES
+//
+// With RELM3U_DUPES each entry is identified by the file it refers to, device
+// and inode, however its path is written, and looked up in a hash table of the
+// context. A file met before in the same playlist or in another playlist of
+// the run is reported; with RELM3U_DEDUPE a repeat within one playlist is also
+// left out of the rewritten playlist, repeats across playlists are only
+// reported. Entries not found are identified by their normalised text within
+// their playlist, as are all entries on Windows, which has no inodes.
+
+#define DUPETEXT  0xFFFFFFFFFFFFFFFFull     // device of an entry identified by text
+
+struct dupeslot
+{
+    unsigned long long dev;
+    unsigned long long ino;     // or hash of the text
+    uint32_t list;              // playlist first met in, 0 = empty slot
+    uint32_t line;              // and its line number
+};
+
+unsigned long long dupe_texthash(char *s, unsigned long long seed, int fold)
+{   // FNV-1a over a string, letters folded to lower case if wanted
+unsigned long long h = 14695981039346656037ull ^ seed;
+while (*s)
+    {
+        unsigned char c = (unsigned char)*s++;
+        if (fold && (c >= 'A') && (c <= 'Z')) { c = c - 'A' + 'a'; }
+        h = (h ^ c) * 1099511628211ull;
+    }
+return(h);
+}
+
+void dupe_identify(char *playlistpath, char *linbuf, int method, uint32_t list, unsigned long long *dev, unsigned long long *ino)
+{   // identity of an entry: device and inode of the file found, else its text
+*dev = DUPETEXT;
+*ino = dupe_texthash(linbuf, list, 0);
+if ((method <= 0) || (strlength(playlistpath) + strlength(linbuf) >= PATHMAX)) { return; }
+char path[PATHMAX];
+sprintf(path, "%s%s", playlistpath, linbuf);
+path_normalise(path);
+*ino = dupe_texthash(path, 0, 0);
+#ifdef UNIXES
+struct stat st;
+if (stat(path, &st) == 0) { *dev = st.st_dev; *ino = st.st_ino; }
+#else
+*ino = dupe_texthash(path, 0, 1);
+#endif
+return;
+}
+
+uint32_t dupes_playlist(relm3u_ctx *ctx, char *m3ufilepath)
+{   // number a playlist for the duplicate table
+    // return (0) when memory is short, duplicates are not looked for then
+uint32_t list = 0;
+#ifdef UNIXES
+pthread_mutex_lock(&ctx->dupelock);
+#endif
+if (ctx->ndupelists == ctx->adupelists)
+    {
+        uint32_t n = (ctx->adupelists == 0) ? 256 : ctx->adupelists * 2;
+        char **p = realloc(ctx->dupelists, n * sizeof(char *));
+        if (p != NULL) { ctx->dupelists = p; ctx->adupelists = n; }
+    }
+if (ctx->ndupelists < ctx->adupelists)
+    {
+        ctx->dupelists[ctx->ndupelists] = strdup(m3ufilepath);
+        if (ctx->dupelists[ctx->ndupelists] != NULL) { list = ++ctx->ndupelists; }
+    }
+#ifdef UNIXES
+pthread_mutex_unlock(&ctx->dupelock);
+#endif
+return(list);
+}
+
+int dupes_check(relm3u_ctx *ctx, unsigned long long dev, unsigned long long ino, uint32_t list, uint32_t line, uint32_t *firstlist, uint32_t *firstline, char **firstpath)
+{   // look a file up and remember where it was met first
+    // return (1) when met before, at line firstline of playlist firstlist
+    // (firstpath), return (0) when it is new or memory is short
+    // a playlist converted again takes over the files of its last conversion
+int found = 0;
+#ifdef UNIXES
+pthread_mutex_lock(&ctx->dupelock);
+#endif
+if (2 * (ctx->dupeused + 1) > ctx->dupesize)
+    {   // keep the table at most half full
+        uint32_t n = (ctx->dupesize == 0) ? 4096 : ctx->dupesize * 2;
+        struct dupeslot *t = calloc(n, sizeof(struct dupeslot));
+        uint32_t i = 0;
+        for (i = 0; (t != NULL) && (i < ctx->dupesize); i++)
+            {
+                struct dupeslot *d = &ctx->dupes[i];
+                if (d->list == 0) { continue; }
+                uint32_t j = (uint32_t)(((d->ino ^ d->dev) * 0x9E3779B97F4A7C15ull) >> 32) & (n - 1);
+                while (t[j].list != 0) { j = (j + 1) & (n - 1); }
+                t[j] = *d;
+            }
+        if (t != NULL) { free(ctx->dupes); ctx->dupes = t; ctx->dupesize = n; }
+    }
+if (2 * (ctx->dupeused + 1) <= ctx->dupesize)
+    {
+        uint32_t i = (uint32_t)(((ino ^ dev) * 0x9E3779B97F4A7C15ull) >> 32) & (ctx->dupesize - 1);
+        struct dupeslot *d = &ctx->dupes[i];
+        while ((d->list != 0) && ((d->dev != dev) || (d->ino != ino)))
+            {
+                i = (i + 1) & (ctx->dupesize - 1);
+                d = &ctx->dupes[i];
+            }
+        if ((d->list != 0) && (d->list != list) && strcomp(ctx->dupelists[d->list - 1], ctx->dupelists[list - 1]))
+            {   d->list = list; d->line = line;   }
+        else if (d->list != 0)
+            {
+                *firstlist = d->list;
+                *firstline = d->line;
+                *firstpath = ctx->dupelists[d->list - 1];
+                found = 1;
+            }
+        else
+            {   d->dev = dev; d->ino = ino; d->list = list; d->line = line; ctx->dupeused++;    }
+    }
+#ifdef UNIXES
+pthread_mutex_unlock(&ctx->dupelock);
+#endif
+return(found);
+}
+
+void dupes_free(relm3u_ctx *ctx)
+{
+uint32_t i = 0;
+for (i = 0; i < ctx->ndupelists; i++) { free(ctx->dupelists[i]); }
+free(ctx->dupelists);
+free(ctx->dupes);
+return;
+}
+
+struct playlistrefs
+{   // entries of one playlist as resolved on the last conversion
+    char base[PATHMAX];     // canonical folder of the playlist
+    char *names;            // NUL-separated absolute path of each entry found,
+    size_t used, size;      // '?' and filename of each entry not found
+};
+
+struct entryrec
+{
+    struct relm3u_entry entry;  // paths not set yet
+    size_t name;                // offset of the path in names
+    size_t also;                // offset of the other playlist in names, (-1) for none
+};
+
+struct entrylog
+{   // outcome of each entry of one playlist, see relm3u_convert_entries()
+    struct outbuf recs;     // struct entryrec
+    struct outbuf names;    // NUL-terminated paths
+};
+
+struct lineout
+{   // where the resolved lines of one playlist go
+    struct outbuf *fw;      // new playlist, or NULL
+    FILE *out;              // report
+    int filesfound;
+    int filestotal;
+    struct playlistrefs *refs;  // remembers the entries, or NULL
+    struct entrylog *log;   // logs the outcome of the entries, or NULL
+    relm3u_ctx *ctx;
+    struct relm3u_stats *ps;
+    char *playlistpath;
+    uint32_t list;          // number in the duplicate table, 0 = not looked for
+    uint32_t lineno;        // lines emitted so far
+    int dedupe;             // leave repeated files out of the new playlist
+    int dupes;              // repeats within the playlist
+    int across;             // files met in another playlist before
+    struct outbuf block;    // '#' lines since the last entry, they go along with the next one
+    int blockinf;           // an #EXTINF line is among them
+    int extended;           // #EXTM3U seen, #EXTINF lines may be made (RELM3U_EXTINF)
+};
+
+void lineout_init(struct lineout *lo, relm3u_ctx *ctx, char *m3ufilepath, char *playlistpath, int seriousflag, struct outbuf *fw, FILE *out, struct relm3u_stats *ps)
+{   // start the output of one playlist, m3ufilepath NULL = no duplicates looked for
+lo->fw = fw;
+lo->out = out;
+lo->filestotal = 0;
+lo->filesfound = 0;
+lo->refs = NULL;
+lo->log = NULL;
+lo->ctx = ctx;
+lo->ps = ps;
+lo->playlistpath = playlistpath;
+lo->list = 0;
+if ((m3ufilepath != NULL) && (ctx->flags & (RELM3U_DUPES | RELM3U_DEDUPE))) { lo->list = dupes_playlist(ctx, m3ufilepath); }
+lo->lineno = 0;
+lo->dedupe = seriousflag && (ctx->flags & RELM3U_DEDUPE);
+lo->dupes = 0;
+lo->across = 0;
+memset(&lo->block, 0, sizeof(struct outbuf));
+lo->blockinf = 0;
+lo->extended = 0;
+return;
+}
+
+void lineout_finish(struct lineout *lo)
+{   // '#' lines after the last entry stay at the end of the new playlist
+if ((lo->fw != NULL) && (lo->block.used > 0)) { outbuf_add(lo->fw, lo->block.data, lo->block.used); }
+if ((lo->fw != NULL) && lo->block.failed) { lo->fw->failed = 1; }
+free(lo->block.data);
+memset(&lo->block, 0, sizeof(struct outbuf));
+return;
+}
+
+void lineout_summary(struct lineout *lo)
+{   // report the totals of one playlist
+fprintf(lo->out, "\nFOUND: %d / %d\n", lo->filesfound, lo->filestotal);
+if (lo->list > 0) { fprintf(lo->out, "DUPLICATES: %d WITHIN, %d ACROSS PLAYLISTS\n", lo->dupes, lo->across); }
+return;
+}
+
+int report_method(int method)
+{   // search method as reported, of what resolve_playlist_line() returned:
+    // 1, 2 or 3 (content), ambiguous matches of search method 2 counted as 2
+return((method == 3) ? 2 : (method == 4) ? 3 : method);
+}
+
+void lineout_log(struct lineout *lo, char *linbuf, int method, int dropped, uint32_t firstline, char *firstpath)
+{   // log the outcome of one entry, the paths are placed later; an entry
+    // repeating one of this playlist has firstline, one of another playlist
+    // has firstpath as well
+struct entryrec rec;
+memset(&rec, 0, sizeof(rec));
+rec.entry.line = lo->lineno;
+rec.entry.method = report_method(method);
+rec.entry.ambiguous = (method == 3);
+rec.entry.dropped = dropped;
+if (firstpath == NULL)  { rec.entry.duplicate_of = firstline; }
+else                    { rec.entry.also_line = firstline; }
+rec.name = lo->log->names.used;
+rec.also = (size_t)-1;
+outbuf_add(&lo->log->names, linbuf, strlen(linbuf) + 1);
+if (firstpath != NULL)
+    {
+        rec.also = lo->log->names.used;
+        outbuf_add(&lo->log->names, firstpath, strlen(firstpath) + 1);
+    }
+outbuf_add(&lo->log->recs, (const char *)&rec, sizeof(rec));
+return;
+}
+
+void count_entry(struct relm3u_stats *ps, int method)
+{   // add the outcome of one playlist entry to the counters of its playlist
+stats_add(&ps->entries, 1);
+if (method == 1)        { stats_add(&ps->found_probe, 1); }
+else if (method == 4)   { stats_add(&ps->found_content, 1); }
+else if (method >= 2)   { stats_add(&ps->found_search, 1); }
+else                    { stats_add(&ps->missing, 1); }
+if (method == 3)        { stats_add(&ps->ties, 1); }
+return;
+}
+
+int prepare_playlist_line(char *linbuf)
+{   // normalise one playlist line (PATHMAX) in place
+    // return (1) when it is an entry to look for, (0) when it is no candidate
+
+// clean line ends from whitespaces and other unwanted stuff
+strlinetrim(linbuf);
+
+// discard lines that are empty after trimming
+if (linbuf[0] == 0)     { return(0); }
+
+// discard all #EXT taglines
+if (linbuf[0] == '#')   { return(0); }
+
+// convert backslashes to slashes
+backslashestoslashes(linbuf);
+
+    // remove the file protocol prefix
+    //strlefttrim(linbuf, "file://");
+
+// refined procedure: remove any protocol prefix and drive letters
+// (bug report 20230318, Richard)
+remove_protocol_and_drive_letters(linbuf);
+strlefttrim(linbuf, "/");
+
+// decode possible URL-style path
+urltostring(linbuf);
+
+    // slash-out drive letter from an absolute dos/win path
+    //if (linbuf[1] == ':')    {   linbuf[0] = '/'; linbuf[1] = '/';   }
+
+    // discard lines with other protocol prefixes
+    //if (strfindchr(linbuf,':'))    { continue; }
+
+// so this IS a candidate
+//puts(linbuf);
+return(1);
+}
+
+int settle_playlist_line(relm3u_ctx *ctx, char *linbuf, char *playlistpath, struct relm3u_stats *ps, struct fprint *known, int method)
+{   // an entry search method 1 did not find (method 0) is searched for by
+    // methods 2 and 3, the outcome is counted in ps
+    // return the method as resolve_playlist_line() does
+long long t1 = now_ns();
+if (method == 0)
+    {   // blind search ('find' / 'dir')
+        stats_add(&ps->searches, 1);
+        int found = find_relpath_by_search(ctx, linbuf, playlistpath, ps);
+        if (found)  { method = (found == 2) ? 3 : 2; stats_add(&ps->search_hits, 1); }
+        stats_add(&ps->search_ns, now_ns() - t1);
+    }
+#ifdef UNIXES
+if ((method == 0) && (ctx->flags & RELM3U_FINGERPRINT))
+    {   // renamed file, found by content
+        long long t2 = now_ns();
+        int found = find_relpath_by_content(ctx, linbuf, playlistpath, known, ps);
+        if (found)  { method = 4; }
+        if (found == 2) { stats_add(&ps->ties, 1); }
+        stats_add(&ps->search_ns, now_ns() - t2);
+    }
+#else
+(void)known;
+#endif
+count_entry(ps, method);
+return(method);
+}
+
+int resolve_playlist_line(relm3u_ctx *ctx, char *linbuf, char *playlistpath, struct probedirs *pd, struct relm3u_stats *ps, struct fprint *known)
+{   // normalise one playlist line and find the file relative to the playlist
+    // linbuf must hold PATHMAX characters, pd holds the playlist folder handles
+    // known is the content fingerprint of the entry from the last run, or NULL
+    // the outcome is counted in ps
+    // return (1) or (2) when found by search method 1 or 2, linbuf = relative path
+    // return (3) as (2), but other files matched equally well (ambiguous)
+    // return (4) when found by search method 3 (content fingerprint)
+    // return (0) when not found, linbuf = normalised path
+    // return (-1) when the line is no candidate at all
+if (!prepare_playlist_line(linbuf)) { return(-1); }
+int method = 0;
+long long t0 = now_ns();
+if (find_relpath_by_pathprobing(ctx, linbuf, playlistpath, pd, ps))   { method = 1; }  // file found on modified playlist path
+stats_add(&ps->probe_ns, now_ns() - t0);
+return(settle_playlist_line(ctx, linbuf, playlistpath, ps, known, method));
+}
+
+void resolve_playlist_lines(relm3u_ctx *ctx, char **lines, int *method, int n, char *playlistpath, struct probedirs *pd, struct relm3u_stats *ps)
+{   // resolve_playlist_line() for up to PROBEBATCH lines, method[i] of lines[i];
+    // search method 1 tests the candidates of all of them together
+char *entries[PROBEBATCH];
+int which[PROBEBATCH];
+int found[PROBEBATCH];
+int m = 0;
+int i = 0;
+for (i = 0; i < n; i++)
+    {
+        method[i] = -1;
+        if (prepare_playlist_line(lines[i])) { entries[m] = lines[i]; which[m] = i; m++; }
+    }
+long long t0 = now_ns();
+probe_lines(ctx, entries, m, found, playlistpath, pd, ps);
+stats_add(&ps->probe_ns, now_ns() - t0);
+for (i = 0; i < m; i++)
+    {   method[which[i]] = settle_playlist_line(ctx, entries[i], playlistpath, ps, NULL, found[i]);   }
+return;
+}
+
+int take_playlist_line(struct relm3u_stats *ps, char *line, size_t len, char *linbuf, char **longline)
+{   // copy one line as delivered by playlist_nextline() into linbuf (PATHMAX)
+    // return (1) when it is to be resolved by resolve_playlist_line()
+    // a line too long for a path is not truncated, but settled right here:
+    // return (-1) when it is no candidate, (0) with *longline = the trimmed
+    // line (release with free()) when it is an entry that cannot be found
+    // one byte of linbuf is kept for the '/' probe_prepare() puts in front
+*longline = NULL;
+if (len >= PATHMAX - 1)
+    {   // trim as strlinetrim() would, maybe it fits then
+        while ((len > 0) && ((unsigned char)*line > 127))  { line++; len--; }
+        while ((len > 0) && ((unsigned char)*line < 33))   { line++; len--; }
+        while ((len > 0) && ((unsigned char)line[len - 1] < 33))   { len--; }
+    }
+if (len < PATHMAX - 1)
+    {
+        memcpy(linbuf, line, len);
+        linbuf[len] = 0;
+        return(1);
+    }
+// linbuf is left empty then, it may still hold a line of an earlier batch
+linbuf[0] = 0;
+if (line[0] == '#') { return(-1); }
+*longline = malloc(len + 1);
+if (*longline == NULL) { return(-1); }
+memcpy(*longline, line, len);
+(*longline)[len] = 0;
+count_entry(ps, 0);
+return(0);
+}
+
+void playlistrefs_add(struct playlistrefs *refs, char *linbuf, int method)
+{   // remember an entry: absolute path when found, '?' and filename when not
+char entry[2 * PATHMAX + 2];
+if (method > 0)
+    {
+        sprintf(entry, "%s/%s", refs->base, linbuf);
+        path_normalise(entry);
+    }
+else
+    {
+        entry[0] = '?';
+        get_only_filename(entry + 1, linbuf);
+    }
+size_t len = strlen(entry) + 1;
+if (refs->used + len > refs->size)
+    {
+        size_t n = (refs->size == 0) ? 4096 : refs->size * 2;
+        while (refs->used + len > n) { n = n * 2; }
+        char *p = realloc(refs->names, n);
+        if (p == NULL) { return; }
+        refs->names = p;
+        refs->size = n;
+    }
+memcpy(refs->names + refs->used, entry, len);
+refs->used += len;
+return;
+}
+
+void lineout_comment(struct lineout *lo, char *linbuf)
+{   // a '#' line: directives of the playlist as a whole are written where they
+    // are, any other line waits in the block of the entry that follows it
+if (strleftcomp(linbuf, "#EXTM3U") || strleftcomp(linbuf, "#PLAYLIST:") || strleftcomp(linbuf, "#EXTENC:"))
+    {
+        if (strleftcomp(linbuf, "#EXTM3U")) { lo->extended = 1; }
+        if (lo->fw != NULL) { outbuf_addline(lo->fw, linbuf); }
+        return;
+    }
+if (strleftcomp(linbuf, "#EXTINF:")) { lo->blockinf = 1; }
+if (lo->fw != NULL) { outbuf_addline(&lo->block, linbuf); }
+return;
+}
+
+int lineout_extinf(struct lineout *lo, char *linbuf, char *extinf)
+{   // #EXTINF line (PATHMAX) of a found entry made of the tags of its file
+    // return (0) when the file has neither tag nor known duration
+#ifdef UNIXES
+char path[2 * PATHMAX + 2];
+sprintf(path, "%s%s", lo->playlistpath, linbuf);
+const char *paths[1] = { path };
+struct relm3u_tags t;
+memset(&t, 0, sizeof(t));
+tags_of_files(lo->ctx, paths, 1, &t, lo->ps);
+if (!t.tagged && (t.duration_ms == 0)) { return(0); }
+int secs = (t.duration_ms > 0) ? (t.duration_ms + 500) / 1000 : -1;
+char file[PATHMAX];
+if (t.title[0] == 0)
+    {   // the filename without extension stands in for the title
+        get_only_filename(file, linbuf);
+        char *dot = strrchr(file, '.');
+        if ((dot != NULL) && (dot != file)) { *dot = 0; }
+    }
+else { sprintf(file, "%s", t.title); }
+char name[RELM3U_TAGTEXT];      // as long as a tag at most
+size_t len = strlen(file);
+if (len >= sizeof(name)) { len = sizeof(name) - 1; }
+memcpy(name, file, len);
+name[len] = 0;
+if (t.artist[0] != 0)   { snprintf(extinf, PATHMAX, "#EXTINF:%d,%s - %s", secs, t.artist, name); }
+else                    { snprintf(extinf, PATHMAX, "#EXTINF:%d,%s", secs, name); }
+return(1);
+#else
+(void)lo;
+(void)linbuf;
+(void)extinf;
+return(0);
+#endif
+}
+
+int emit_playlist_line(struct lineout *lo, char *linbuf, int method)
+{   // write resolved line to the new playlist and report it, along with the
+    // '#' lines before it; lines with method (-1) are empty or '#' lines
+    // return (0) when it was left out of the new playlist as a repeat
+lo->lineno++;
+if (method < 0)
+    {
+        if ((linbuf != NULL) && (linbuf[0] == '#')) { lineout_comment(lo, linbuf); }
+        return(1);
+    }
+lo->filestotal++;
+
+uint32_t firstlist = 0;
+uint32_t firstline = 0;
+char *firstpath = NULL;
+int repeat = 0;
+if (lo->list > 0)
+    {
+        unsigned long long dev, ino;
+        dupe_identify(lo->playlistpath, linbuf, method, lo->list, &dev, &ino);
+        repeat = dupes_check(lo->ctx, dev, ino, lo->list, lo->lineno, &firstlist, &firstline, &firstpath);
+    }
+int dropped = repeat && (firstlist == lo->list) && lo->dedupe && (method > 0);
+
+char extinf[PATHMAX];
+int made = 0;
+if (method > 0)
+    {
+        // an entry of an extended playlist without #EXTINF line gets one
+        if ( !dropped && lo->extended && !lo->blockinf && (lo->ctx->flags & RELM3U_EXTINF) &&
+             (strlength(linbuf) < PATHMAX) )  { made = lineout_extinf(lo, linbuf, extinf); }
+        if ((lo->fw != NULL) && !dropped)
+            {
+                if (lo->block.used > 0) { outbuf_add(lo->fw, lo->block.data, lo->block.used); }
+                if (made)               { outbuf_addline(lo->fw, extinf); }
+                outbuf_addline(lo->fw, linbuf);
+            }
+        // the search method is reported, ambiguous matches are of method 2
+        fprintf(lo->out, "%d: %s\n", report_method(method), linbuf);
+        if (method == 3)    { fputs("?: AMBIGUOUS, OTHER FILES MATCH AS WELL\n", lo->out); }
+        if (made)           { fprintf(lo->out, "I: %s\n", extinf); }
+        lo->filesfound++;
+    }
+else
+    {   fprintf(lo->out, "X: %s\n", linbuf);   }
+if (lo->log != NULL)
+    {
+        int within = repeat && (firstlist == lo->list);
+        lineout_log(lo, linbuf, method, dropped, repeat ? firstline : 0, (repeat && !within) ? firstpath : NULL);
+    }
+
+// the '#' lines of an entry left out go with it
+if ((lo->fw != NULL) && lo->block.failed) { lo->fw->failed = 1; }
+lo->block.used = 0;
+lo->block.failed = 0;
+lo->blockinf = 0;
+if (repeat && (firstlist == lo->list))
+    {
+        fprintf(lo->out, "D: DUPLICATE OF LINE %u%s\n", firstline, dropped ? ", LEFT OUT" : "");
+        stats_add(&lo->ps->duplicates, 1);
+        lo->dupes++;
+    }
+else if (repeat)
+    {
+        fprintf(lo->out, "D: ALSO IN \"%s\", LINE %u\n", firstpath, firstline);
+        stats_add(&lo->ps->duplicates_across, 1);
+        lo->across++;
+    }
+if (dropped)
+    {   stats_add(&lo->ps->duplicates_dropped, 1); return(0);   }
+if ((lo->refs != NULL) && (strlen(linbuf) < PATHMAX)) { playlistrefs_add(lo->refs, linbuf, method); }
+return(1);
+}
+
+int convert_lines_batched(relm3u_ctx *ctx, struct playlistdata *pl, struct lineout *lo, char *playlistpath, struct probedirs *pd, struct relm3u_stats *ps)
+{   // resolve all lines of pl PROBEBATCH at a time, write them in order
+    // return (0) when memory is short (nothing done then)
+char (*lines)[PATHMAX] = malloc(PROBEBATCH * sizeof(*lines));
+if (lines == NULL) { return(0); }
+char *longline[PROBEBATCH];
+int method[PROBEBATCH];
+size_t pos = 0;
+int more = 1;
+while (more)
+    {
+        // take a batch, lines settled right away are not resolved
+        char *pending[PROBEBATCH];
+        int which[PROBEBATCH];
+        int got[PROBEBATCH];
+        int n = 0;
+        int m = 0;
+        while (n < PROBEBATCH)
+            {
+                char *line;
+                size_t len;
+                more = playlist_nextline(pl, &pos, &line, &len);
+                if (!more) { break; }
+                method[n] = take_playlist_line(ps, line, len, lines[n], &longline[n]);
+                if (method[n] == 1) { which[m++] = n; }
+                n++;
+            }
+        int i = 0;
+        for (i = 0; i < m; i++) { pending[i] = lines[which[i]]; }
+        resolve_playlist_lines(ctx, pending, got, m, playlistpath, pd, ps);
+        for (i = 0; i < m; i++) { method[which[i]] = got[i]; }
+        for (i = 0; i < n; i++)
+            {
+                emit_playlist_line(lo, (longline[i] != NULL) ? longline[i] : lines[i], method[i]);
+                free(longline[i]);
+            }
+    }
+free(lines);
+return(1);
+}
+
+#ifdef UNIXES
+// -----------------------------------------------------------------------------
+// PARALLEL LINE RESOLUTION (UNIX)
+//
+// Lines of one playlist are resolved by worker threads while the calling
+// thread keeps reading ahead and writes results strictly in original order.
+// Lines live in a ring of LINEWINDOW slots, so memory stays bounded no matter
+// how long the playlist is: reading stalls while the oldest line is pending.
+// A worker takes a share of the pending lines, up to PROBEBATCH, at a time.
+
+#define LINEWINDOW  256     // lines in flight per playlist
+#define LINEPENDING -2      // slot read, but not resolved yet
+
+struct linewindow
+{
+    char (*lines)[PATHMAX]; // ring of line buffers
+    char **longline;        // line too long for its buffer, per slot, or NULL
+    int *method;            // result per slot, LINEPENDING while unresolved
+    long long nread;        // lines read into the ring so far
+    long long nclaimed;     // lines handed to workers so far
+    int eof;
+    int njobs;              // workers sharing the lines
+    relm3u_ctx *ctx;
+    char *playlistpath;
+    struct probedirs *pd;
+    struct relm3u_stats *ps;
+    pthread_mutex_t lock;
+    pthread_cond_t work;    // lines were added or input is exhausted
+    pthread_cond_t done;    // a line was resolved
+};
+
+void *line_worker(void *arg)
+{   // resolve lines in the order they were read until input is exhausted
+struct linewindow *w = arg;
+pthread_mutex_lock(&w->lock);
+while (1)
+    {
+        while ((w->nclaimed == w->nread) && (!w->eof)) { pthread_cond_wait(&w->work, &w->lock); }
+        if (w->nclaimed == w->nread) { break; }
+
+        // a fair share of the lines read, lines settled when read are skipped
+        long long share = (w->nread - w->nclaimed + w->njobs - 1) / w->njobs;
+        if (share > PROBEBATCH) { share = PROBEBATCH; }
+        char *lines[PROBEBATCH];
+        int slots[PROBEBATCH];
+        int method[PROBEBATCH];
+        int n = 0;
+        while ((share-- > 0) && (w->nclaimed < w->nread))
+            {
+                int slot = (int)(w->nclaimed++ % LINEWINDOW);
+                if (w->method[slot] == LINEPENDING) { slots[n] = slot; lines[n] = w->lines[slot]; n++; }
+            }
+        if (n == 0) { continue; }
+        pthread_mutex_unlock(&w->lock);
+
+        resolve_playlist_lines(w->ctx, lines, method, n, w->playlistpath, w->pd, w->ps);
+
+        pthread_mutex_lock(&w->lock);
+        int i = 0;
+        for (i = 0; i < n; i++) { w->method[slots[i]] = method[i]; }
+        pthread_cond_broadcast(&w->done);
+    }
+pthread_mutex_unlock(&w->lock);
+return(NULL);
+}
+
+int convert_lines_parallel(relm3u_ctx *ctx, struct playlistdata *pl, struct lineout *lo, char *playlistpath, struct probedirs *pd, struct relm3u_stats *ps, int njobs)
+{   // resolve all lines of pl on njobs threads, write them in original order
+    // return (0) when memory is short (nothing done then)
+struct linewindow w;
+w.lines = malloc(LINEWINDOW * sizeof(*w.lines));
+w.longline = malloc(LINEWINDOW * sizeof(char *));
+w.method = malloc(LINEWINDOW * sizeof(int));
+if ((w.lines == NULL) || (w.longline == NULL) || (w.method == NULL))
+    {   free(w.lines); free(w.longline); free(w.method); return(0);  }
+w.nread = 0;
+w.nclaimed = 0;
+w.eof = 0;
+w.njobs = njobs;
+w.ctx = ctx;
+w.playlistpath = playlistpath;
+w.pd = pd;
+w.ps = ps;
+pthread_mutex_init(&w.lock, NULL);
+pthread_cond_init(&w.work, NULL);
+pthread_cond_init(&w.done, NULL);
+
+pthread_t workers[MAXJOBS];
+int started = 0;
+while (started < njobs)
+    {
+        if (pthread_create(&workers[started], NULL, line_worker, &w) != 0) { break; }
+        started++;
+    }
+
+long long nemitted = 0;
+size_t pos = 0;
+while (1)
+    {
+        // read ahead as far as the ring allows
+        while ((!w.eof) && (w.nread - nemitted < LINEWINDOW))
+            {
+                int slot = (int)(w.nread % LINEWINDOW);
+                char *line;
+                size_t len;
+                int more = playlist_nextline(pl, &pos, &line, &len);
+                int method = LINEPENDING;
+                if (more)
+                    {
+                        method = take_playlist_line(ps, line, len, w.lines[slot], &w.longline[slot]);
+                        if (method == 1) { method = LINEPENDING; }
+                    }
+                pthread_mutex_lock(&w.lock);
+                if (more)   { w.method[slot] = method; w.nread++; }
+                else        { w.eof = 1; }
+                pthread_cond_broadcast(&w.work);
+                pthread_mutex_unlock(&w.lock);
+            }
+        if (nemitted == w.nread) { break; }
+
+        // wait for the oldest line, without any worker resolve it here
+        int slot = (int)(nemitted % LINEWINDOW);
+        pthread_mutex_lock(&w.lock);
+        if ((started == 0) && (w.method[slot] == LINEPENDING))
+            {
+                w.nclaimed++;
+                pthread_mutex_unlock(&w.lock);
+                w.method[slot] = resolve_playlist_line(ctx, w.lines[slot], playlistpath, pd, ps, NULL);
+                pthread_mutex_lock(&w.lock);
+            }
+        while (w.method[slot] == LINEPENDING) { pthread_cond_wait(&w.done, &w.lock); }
+        pthread_mutex_unlock(&w.lock);
+
+        if (w.longline[slot] != NULL)
+            {
+                emit_playlist_line(lo, w.longline[slot], w.method[slot]);
+                free(w.longline[slot]);
+            }
+        else
+            {   emit_playlist_line(lo, w.lines[slot], w.method[slot]);   }
+        nemitted++;
+    }
+
+while (started > 0) { pthread_join(workers[--started], NULL); }
+pthread_mutex_destroy(&w.lock);
+pthread_cond_destroy(&w.work);
+pthread_cond_destroy(&w.done);
+free(w.lines);
+free(w.longline);
+free(w.method);
+return(1);
+}
+#endif
+
+int backup_playlist(char *m3ufilepath, char *targetfilename, struct playlistdata *pl, struct relm3u_stats *ps)
+{   // write the playlist content pl to the first free numbered backup filename
+    // targetfilename (PATHMAX) delivers the backup filename
+    // return (1) on success, (0) on failure
+
+// find free backup filename
+int bakfno = 0;
+while (bakfno < 99)
+    {
+        sprintf(targetfilename, "%s.%02d.bak", m3ufilepath, bakfno);
+        bakfno++;
+        if (check_file_exist(targetfilename)) { continue; } else { break; }
+    }
+return(write_counted(targetfilename, pl->data, pl->len, ps));
+}
+
+void convert_playlist_lines(relm3u_ctx *ctx, struct playlistdata *pl, struct lineout *lo, char *playlistpath, struct probedirs *pd, struct relm3u_stats *ps, int linejobs)
+{   // process playlist in batches of lines, spread over linejobs worker threads
+    // if wanted, line by line when memory is short
+char linbuf[PATHMAX] = "";
+int linesdone = 0;
+#ifdef UNIXES
+if (linejobs > 1)
+    {   linesdone = convert_lines_parallel(ctx, pl, lo, playlistpath, pd, ps, linejobs);   }
+#else
+(void)linejobs;
+#endif
+if (!linesdone)
+    {   linesdone = convert_lines_batched(ctx, pl, lo, playlistpath, pd, ps);   }
+size_t pos = 0;
+char *line;
+size_t len;
+while ((!linesdone) && playlist_nextline(pl, &pos, &line, &len))
+    {
+        char *longline;
+        int method = take_playlist_line(ps, line, len, linbuf, &longline);
+        if (method == 1)
+            {   method = resolve_playlist_line(ctx, linbuf, playlistpath, pd, ps, NULL);  }
+        emit_playlist_line(lo, (longline != NULL) ? longline : linbuf, method);
+        free(longline);
+    }
+return;
+}
+
+int convert_playlist_to_relative(relm3u_ctx *ctx, char *m3ufilepath, int seriousflag, int linejobs, FILE *out, struct playlistrefs *refs, struct entrylog *log, struct relm3u_stats *ps)
+{   // make playlist with original pathfilename but relative paths, as possible
+    // lines are resolved on linejobs threads, the report goes to the out stream
+    // the outcome of each entry is logged when log is given
+    // everything done is counted in ps
+char targetfilename [PATHMAX] = "";
+char playlistpath[PATHMAX] = "";
+
+get_only_filepath(playlistpath, m3ufilepath);
+
+if (!check_file_exist(m3ufilepath)) { fputs("FILE DOES NOT EXIST.\n", out); return(0); }
+
+struct playlistdata pl;
+if (seriousflag == 1)       // SERIOUS MODE!
+    {
+        fputs("SERIOUS MODE. PLAYLIST GONNA GET MODIFIED.\n\n", out);
+
+        // CREATE BACK-UP FILE, straight from the playlist as read
+        if (!playlist_load(m3ufilepath, &pl))   { return(0); }
+        stats_add(&ps->bytes_read, pl.len);
+        if (!backup_playlist(m3ufilepath, targetfilename, &pl, ps))  { playlist_unload(&pl); return(0); }
+    }
+
+else                        // TESTING MODE
+
+    {
+        fputs("TEST MODE. NO WRITE ACCESS. JUST INFO.\n\n", out);
+    }
+
+fprintf(out, "PATH: \"%s\"\n\n", m3ufilepath);
+
+if (seriousflag != 1)
+    {
+        if (!playlist_load(m3ufilepath, &pl))   { return(0); }
+        stats_add(&ps->bytes_read, pl.len);
+    }
+
+// new playlist is collected in memory, in test mode it is not even that
+struct outbuf ob;
+ob.data = NULL;
+ob.used = 0;
+ob.size = 0;
+ob.failed = 0;
+
+// watch mode (refs) converts the same playlists over and over, duplicates are
+// not looked for there
+struct lineout lo;
+lineout_init(&lo, ctx, (refs == NULL) ? m3ufilepath : NULL, playlistpath, seriousflag, (seriousflag == 1) ? &ob : NULL, out, ps);
+lo.refs = refs;
+lo.log = log;
+if (refs != NULL)
+    {   // entries are remembered by absolute path
+        refs->used = 0;
+        #ifdef UNIXES
+        if (realpath((playlistpath[0] == 0) ? "." : playlistpath, refs->base) == NULL)  { lo.refs = NULL; }
+        #else
+        sprintf(refs->base, "%s", playlistpath);
+        #endif
+    }
+
+// folder handles for probing, shared by all lines of this playlist
+struct probedirs pd;
+probedirs_init(&pd, ctx->radius + 1);
+#ifdef UNIXES
+probedirs_open(&pd, playlistpath, ctx->radius + 1);
+#endif
+
+convert_playlist_lines(ctx, &pl, &lo, playlistpath, &pd, ps, linejobs);
+
+#ifdef UNIXES
+probedirs_close(&pd);
+#endif
+
+// the playlist is read completely before it is overwritten
+playlist_unload(&pl);
+
+lineout_finish(&lo);
+lineout_summary(&lo);
+if (seriousflag == 1)
+    {
+        int written = (!ob.failed) && write_counted(m3ufilepath, (ob.data != NULL) ? ob.data : "", ob.used, ps);
+        free(ob.data);
+        if (!written) { return(0); }
+    }
+fputs("\n", out);
+return(1);
+}
+
+#ifdef UNIXES
+// -----------------------------------------------------------------------------
+// INCREMENTAL CONVERSION (UNIX)
+//
+// A state file remembers per playlist the hash of its content, every entry
+// with what it resolved to, and the mtimes of the folders the entries were
+// found in. A playlist whose content is unchanged, whose folders are all
+// unchanged and which has no entry missing is skipped without touching a
+// single entry. Otherwise only entries that are new or whose folder changed are
+// resolved again; the others are taken over as they are. In serious mode the
+// playlist is only rewritten, with back-up, when its content actually changes.
+// The state file is only written in serious mode.
+
+#define STATEMAGIC    "RELM3USTATE 1"
+#define STATEFILENAME ".relm3u.state"
+
+struct statedir
+{   // folder entries were found in, shared by all records
+    char *path;
+    int checked;            // current mtime below was taken in this run
+    int64_t mtime_sec;      // -1 = folder does not exist
+    uint32_t mtime_nsec;
+};
+
+struct staterecdir
+{   // folder of a record with its mtime when the entries were resolved
+    int dir;
+    int64_t mtime_sec;      // -1 = look again
+    uint32_t mtime_nsec;
+};
+
+struct stateentry
+{
+    char *key;              // line as it is in the playlist file
+    char *output;           // relative path written for it
+    int method;             // search method that found it, 0 = not found
+    int recdir;             // folder in the record, -1 = none
+    struct fprint fp;       // content of the file found, size 0 = unknown
+};
+
+struct staterecord
+{
+    char *path;             // canonical path of the playlist
+    uint64_t hash;          // content hash of the playlist file
+    int missing;            // entries not found
+    struct staterecdir *dirs;   int ndirs, adirs;
+    struct stateentry *entries; int nentries, aentries;
+};
+
+struct runstate
+{
+    char path[PATHMAX];     // state file
+    time_t runstart;
+    struct staterecord **recs;  int nrecs, arecs;   // NULL while in use
+    struct statedir *dirs;      int ndirs, adirs;
+    uint32_t *dirslots;         uint32_t dirslotsize;   // dir index plus one
+};
+
+uint64_t state_hash64(char *buf, size_t len)
+{   // FNV-1a, 64 bit
+uint64_t h = 14695981039346656037ull;
+size_t i = 0;
+for (i = 0; i < len; i++) { h = (h ^ (unsigned char)buf[i]) * 1099511628211ull; }
+return(h);
+}
+
+void *state_grow(void *table, int *alloc, int need, size_t size)
+{   // make room for need elements, return NULL on failure with table untouched
+if (need <= *alloc) { return(table); }
+int n = (*alloc == 0) ? 16 : *alloc;
+while (n < need) { n = n * 2; }
+void *p = realloc(table, (size_t)n * size);
+if (p == NULL) { return(NULL); }
+*alloc = n;
+return(p);
+}
+
+int state_dirfind(struct runstate *st, char *path)
+{   // deliver index of a folder, adding it when unknown, (-1) when out of memory
+    // caller holds the state lock
+if (2 * (st->ndirs + 1) > (int)st->dirslotsize)
+    {
+        uint32_t n = (st->dirslotsize == 0) ? 1024 : st->dirslotsize * 2;
+        uint32_t *t = calloc(n, sizeof(uint32_t));
+        if (t == NULL) { return(-1); }
+        int d = 0;
+        for (d = 0; d < st->ndirs; d++)
+            {
+                uint32_t i = probecache_hash(st->dirs[d].path) & (n - 1);
+                while (t[i] != 0) { i = (i + 1) & (n - 1); }
+                t[i] = d + 1;
+            }
+        free(st->dirslots);
+        st->dirslots = t;
+        st->dirslotsize = n;
+    }
+uint32_t i = probecache_hash(path) & (st->dirslotsize - 1);
+while (st->dirslots[i] != 0)
+    {
+        if (strcomp(st->dirs[st->dirslots[i] - 1].path, path)) { return(st->dirslots[i] - 1); }
+        i = (i + 1) & (st->dirslotsize - 1);
+    }
+struct statedir *t = state_grow(st->dirs, &st->adirs, st->ndirs + 1, sizeof(struct statedir));
+if (t == NULL) { return(-1); }
+st->dirs = t;
+struct statedir *sd = &st->dirs[st->ndirs];
+sd->path = strdup(path);
+if (sd->path == NULL) { return(-1); }
+sd->checked = 0;
+st->dirslots[i] = ++st->ndirs;
+return(st->ndirs - 1);
+}
+
+void state_dirnow(relm3u_ctx *ctx, int dir, int64_t *sec, uint32_t *nsec)
+{   // deliver current mtime of a folder, looked at once per run
+struct runstate *st = ctx->state;
+char path[PATHMAX];
+pthread_mutex_lock(&ctx->statelock);
+int checked = st->dirs[dir].checked;
+*sec = st->dirs[dir].mtime_sec;
+*nsec = st->dirs[dir].mtime_nsec;
+sprintf(path, "%s", st->dirs[dir].path);
+pthread_mutex_unlock(&ctx->statelock);
+if (checked) { return; }
+
+struct stat sb;
+*sec = -1;
+*nsec = 0;
+if ((stat(path, &sb) == 0) && S_ISDIR(sb.st_mode))
+    {   *sec = (int64_t)sb.st_mtime; *nsec = (uint32_t)sb.st_mtim.tv_nsec;   }
+pthread_mutex_lock(&ctx->statelock);
+st->dirs[dir].checked = 1;
+st->dirs[dir].mtime_sec = *sec;
+st->dirs[dir].mtime_nsec = *nsec;
+pthread_mutex_unlock(&ctx->statelock);
+return;
+}
+
+int state_recdirsame(relm3u_ctx *ctx, struct staterecdir *rd)
+{   // is the folder of a record still as it was? (1/0)
+int64_t sec;
+uint32_t nsec;
+if (rd->mtime_sec < 0) { return(0); }
+state_dirnow(ctx, rd->dir, &sec, &nsec);
+return((sec == rd->mtime_sec) && (nsec == rd->mtime_nsec));
+}
+
+void state_recordfree(struct staterecord *rec)
+{
+if (rec == NULL) { return; }
+int i = 0;
+for (i = 0; i < rec->nentries; i++) { free(rec->entries[i].key); free(rec->entries[i].output); }
+free(rec->entries);
+free(rec->dirs);
+free(rec->path);
+free(rec);
+return;
+}
+
+struct staterecord *state_takerecord(relm3u_ctx *ctx, char *path)
+{   // take the record of a playlist out of the state for exclusive use,
+    // deliver NULL when there is none
+struct runstate *st = ctx->state;
+struct staterecord *rec = NULL;
+pthread_mutex_lock(&ctx->statelock);
+int i = 0;
+for (i = 0; i < st->nrecs; i++)
+    {
+        if ((st->recs[i] == NULL) || !strcomp(st->recs[i]->path, path)) { continue; }
+        rec = st->recs[i];
+        st->recs[i] = st->recs[--st->nrecs];
+        break;
+    }
+pthread_mutex_unlock(&ctx->statelock);
+return(rec);
+}
+
+void state_putrecord(relm3u_ctx *ctx, struct staterecord *rec)
+{   // hand a record (back) to the state
+struct runstate *st = ctx->state;
+pthread_mutex_lock(&ctx->statelock);
+struct staterecord **t = state_grow(st->recs, &st->arecs, st->nrecs + 1, sizeof(struct staterecord *));
+if (t == NULL)  { state_recordfree(rec); }
+else            { st->recs = t; st->recs[st->nrecs++] = rec; }
+pthread_mutex_unlock(&ctx->statelock);
+return;
+}
+
+struct stateentry *state_addentry(struct staterecord *rec, char *key, char *output, int method, int recdir)
+{
+struct stateentry *t = state_grow(rec->entries, &rec->aentries, rec->nentries + 1, sizeof(struct stateentry));
+if (t == NULL) { return(NULL); }
+rec->entries = t;
+struct stateentry *e = &rec->entries[rec->nentries];
+e->key = strdup(key);
+e->output = strdup(output);
+if ((e->key == NULL) || (e->output == NULL)) { free(e->key); free(e->output); return(NULL); }
+e->method = method;
+e->recdir = recdir;
+e->fp.size = 0;
+e->fp.hash = 0;
+rec->nentries++;
+return(e);
+}
+
+int state_addrecdir(relm3u_ctx *ctx, struct staterecord *rec, char *dirpath)
+{   // deliver folder index within a record, taking the current mtime when new
+pthread_mutex_lock(&ctx->statelock);
+int dir = state_dirfind(ctx->state, dirpath);
+pthread_mutex_unlock(&ctx->statelock);
+if (dir < 0) { return(-1); }
+int i = 0;
+for (i = rec->ndirs - 1; i >= 0; i--) { if (rec->dirs[i].dir == dir) { return(i); } }
+struct staterecdir *t = state_grow(rec->dirs, &rec->adirs, rec->ndirs + 1, sizeof(struct staterecdir));
+if (t == NULL) { return(-1); }
+rec->dirs = t;
+struct staterecdir *rd = &rec->dirs[rec->ndirs];
+rd->dir = dir;
+state_dirnow(ctx, dir, &rd->mtime_sec, &rd->mtime_nsec);
+// a folder changed right now may change again unnoticed within the same timestamp
+if (rd->mtime_sec >= (int64_t)ctx->state->runstart - 1) { rd->mtime_sec = -1; }
+return(rec->ndirs++);
+}
+
+int state_load(struct runstate *st)
+{   // read the state file, a missing file is an empty state
+    // return (0) when the file exists but cannot be read
+FILE *fp = fopen(st->path, "r");
+if (fp == NULL) { return(errno == ENOENT); }
+char *line = NULL;
+size_t linesize = 0;
+ssize_t len;
+struct staterecord *rec = NULL;
+int ok = 0;
+if ((len = getline(&line, &linesize, fp)) > 0)
+    {   line[strcspn(line, "\n")] = 0; ok = strcomp(line, STATEMAGIC);  }
+while (ok && ((len = getline(&line, &linesize, fp)) > 0))
+    {
+        line[strcspn(line, "\n")] = 0;
+        char *rest = line + 2;
+        if (strleftcomp(line, "D "))
+            {   if (state_dirfind(st, rest) != st->ndirs - 1) { ok = 0; }  }
+        else if (strleftcomp(line, "P "))
+            {
+                unsigned long long hash;
+                int missing, n;
+                if (sscanf(rest, "%llx %d %n", &hash, &missing, &n) < 2) { ok = 0; break; }
+                rec = calloc(1, sizeof(struct staterecord));
+                if (rec == NULL) { ok = 0; break; }
+                rec->path = strdup(rest + n);
+                rec->hash = hash;
+                rec->missing = missing;
+                struct staterecord **t = state_grow(st->recs, &st->arecs, st->nrecs + 1, sizeof(struct staterecord *));
+                if ((rec->path == NULL) || (t == NULL)) { state_recordfree(rec); ok = 0; break; }
+                st->recs = t;
+                st->recs[st->nrecs++] = rec;
+            }
+        else if (strleftcomp(line, "R ") && (rec != NULL))
+            {
+                long long sec;
+                unsigned int nsec;
+                int dir;
+                if ((sscanf(rest, "%d %lld %u", &dir, &sec, &nsec) != 3) || (dir < 0) || (dir >= st->ndirs)) { ok = 0; break; }
+                struct staterecdir *t = state_grow(rec->dirs, &rec->adirs, rec->ndirs + 1, sizeof(struct staterecdir));
+                if (t == NULL) { ok = 0; break; }
+                rec->dirs = t;
+                rec->dirs[rec->ndirs].dir = dir;
+                rec->dirs[rec->ndirs].mtime_sec = sec;
+                rec->dirs[rec->ndirs].mtime_nsec = nsec;
+                rec->ndirs++;
+            }
+        else if (strleftcomp(line, "E ") && (rec != NULL))
+            {
+                int method, recdir, n;
+                if (sscanf(rest, "%d %d %n", &method, &recdir, &n) < 2) { ok = 0; break; }
+                char *key = rest + n;
+                char *output = strchr(key, '\t');
+                if ((output == NULL) || (recdir >= rec->ndirs)) { ok = 0; break; }
+                *output++ = 0;
+                if (state_addentry(rec, key, output, method, recdir) == NULL) { ok = 0; break; }
+            }
+        else if (strleftcomp(line, "F ") && (rec != NULL) && (rec->nentries > 0))
+            {   // content fingerprint of the entry before
+                struct fprint *fp = &rec->entries[rec->nentries - 1].fp;
+                if (sscanf(rest, "%llu %llx", &fp->size, &fp->hash) != 2) { ok = 0; break; }
+            }
+        else
+            {   ok = 0; }
+    }
+free(line);
+fclose(fp);
+if (!ok)
+    {   // start over from scratch rather than trust a damaged file
+        while (st->nrecs > 0) { state_recordfree(st->recs[--st->nrecs]); }
+    }
+return(1);
+}
+
+int state_save(struct runstate *st)
+{   // write the state file, replacing the previous one
+char tmppath[PATHMAX + 8];
+sprintf(tmppath, "%s.tmp", st->path);
+FILE *fp = fopen(tmppath, "w");
+if (fp == NULL) { return(0); }
+fprintf(fp, "%s\n", STATEMAGIC);
+int i = 0;
+for (i = 0; i < st->ndirs; i++) { fprintf(fp, "D %s\n", st->dirs[i].path); }
+for (i = 0; i < st->nrecs; i++)
+    {
+        struct staterecord *rec = st->recs[i];
+        fprintf(fp, "P %016llx %d %s\n", (unsigned long long)rec->hash, rec->missing, rec->path);
+        int j = 0;
+        for (j = 0; j < rec->ndirs; j++)
+            {   fprintf(fp, "R %d %lld %u\n", rec->dirs[j].dir, (long long)rec->dirs[j].mtime_sec, rec->dirs[j].mtime_nsec);   }
+        for (j = 0; j < rec->nentries; j++)
+            {
+                struct stateentry *e = &rec->entries[j];
+                fprintf(fp, "E %d %d %s\t%s\n", e->method, e->recdir, e->key, e->output);
+                if (e->fp.size > 0) { fprintf(fp, "F %llu %016llx\n", e->fp.size, e->fp.hash); }
+            }
+    }
+if (fclose(fp) != 0)                { unlink(tmppath); return(0); }
+if (rename(tmppath, st->path) != 0) { unlink(tmppath); return(0); }
+return(1);
+}
+
+void state_free(struct runstate *st)
+{
+if (st == NULL) { return; }
+while (st->nrecs > 0) { state_recordfree(st->recs[--st->nrecs]); }
+int i = 0;
+for (i = 0; i < st->ndirs; i++) { free(st->dirs[i].path); }
+free(st->recs);
+free(st->dirs);
+free(st->dirslots);
+free(st);
+return;
+}
+
+int convert_playlist_incremental(relm3u_ctx *ctx, char *m3ufilepath, int seriousflag, FILE *out, struct relm3u_stats *ps)
+{   // same as convert_playlist_to_relative(), guided by the state of the last run
+char playlistpath[PATHMAX] = "";
+char canonpath[PATHMAX] = "";
+char base[PATHMAX] = "";
+char linbuf[PATHMAX] = "";
+char key[PATHMAX] = "";
+
+get_only_filepath(playlistpath, m3ufilepath);
+if (!check_file_exist(m3ufilepath)) { fputs("FILE DOES NOT EXIST.\n", out); return(0); }
+if (realpath(m3ufilepath, canonpath) == NULL)   { return(0); }
+if (realpath((playlistpath[0] == 0) ? "." : playlistpath, base) == NULL)   { return(0); }
+
+struct playlistdata pl;
+if (!playlist_load(m3ufilepath, &pl)) { return(0); }
+stats_add(&ps->bytes_read, pl.len);
+uint64_t hash = state_hash64(pl.data, pl.len);
+
+// skip the playlist when neither it nor any folder of its entries changed
+struct staterecord *old = state_takerecord(ctx, canonpath);
+// a playlist skipped would not be looked at for duplicates
+if ((old != NULL) && (old->hash == hash) && (old->missing == 0) && !(ctx->flags & (RELM3U_DUPES | RELM3U_DEDUPE)))
+    {
+        int same = 1;
+        int i = 0;
+        for (i = 0; same && (i < old->ndirs); i++) { same = state_recdirsame(ctx, &old->dirs[i]); }
+        if (same)
+            {
+                fprintf(out, "PATH: \"%s\"\n\n", m3ufilepath);
+                fputs("UNCHANGED SINCE LAST RUN. SKIPPED.\n\n", out);
+                state_putrecord(ctx, old);
+                playlist_unload(&pl);
+                return(1);
+            }
+    }
+
+if (seriousflag)    { fputs("SERIOUS MODE. PLAYLIST GONNA GET MODIFIED.\n\n", out); }
+else                { fputs("TEST MODE. NO WRITE ACCESS. JUST INFO.\n\n", out); }
+fprintf(out, "PATH: \"%s\"\n\n", m3ufilepath);
+
+// new playlist content is collected in memory first
+struct outbuf ob;
+ob.data = NULL;
+ob.used = 0;
+ob.size = 0;
+ob.failed = 0;
+struct staterecord *rec = calloc(1, sizeof(struct staterecord));
+if (rec == NULL)    { state_recordfree(old); playlist_unload(&pl); return(0);  }
+rec->path = strdup(canonpath);
+
+struct lineout lo;
+lineout_init(&lo, ctx, m3ufilepath, playlistpath, seriousflag, &ob, out, ps);
+
+struct probedirs pd;
+probedirs_open(&pd, playlistpath, ctx->radius + 1);
+
+int hint = 0;
+size_t pos = 0;
+char *line;
+size_t len;
+while (playlist_nextline(&pl, &pos, &line, &len))
+    {
+        // a line too long for a path is reported, but not remembered
+        char *longline;
+        int method = take_playlist_line(ps, line, len, linbuf, &longline);
+        if (method != 1)
+            {
+                emit_playlist_line(&lo, longline, method);
+                if (method == 0) { rec->missing++; }
+                free(longline);
+                continue;
+            }
+        sprintf(key, "%s", linbuf);
+        strlinetrim(key);
+
+        // entries found before in a folder unchanged since are taken over
+        struct stateentry *prev = NULL;
+        if ((old != NULL) && (key[0] != 0) && (key[0] != '#'))
+            {
+                int i = 0;
+                for (i = 0; i < old->nentries; i++)
+                    {
+                        struct stateentry *e = &old->entries[(hint + i) % old->nentries];
+                        if (strcomp(e->key, key)) { prev = e; hint = (hint + i + 1) % old->nentries; break; }
+                    }
+            }
+        // the content found last time finds the file again after a rename
+        struct fprint fp = { 0, 0 };
+        if (prev != NULL) { fp = prev->fp; }
+        if ( (prev != NULL) &&
+             ((prev->method <= 0) || (prev->recdir < 0) || !state_recdirsame(ctx, &old->dirs[prev->recdir])) )
+            {   prev = NULL;    }
+        if (prev != NULL)
+            {
+                sprintf(linbuf, "%s", prev->output);
+                method = prev->method;
+                count_entry(ps, method);
+            }
+        else
+            {
+                method = resolve_playlist_line(ctx, linbuf, playlistpath, &pd, ps, &fp);
+                if (method != 4) { fp.size = 0; }
+            }
+        if (!emit_playlist_line(&lo, linbuf, method) || (method < 0)) { continue; }
+
+        // remember the entry as it will be in the file after this run
+        int recdir = -1;
+        if (method > 0)
+            {
+                char entrypath[2 * PATHMAX + 2];
+                sprintf(entrypath, "%s/%s", base, linbuf);
+                path_normalise(entrypath);
+                if ((fp.size == 0) && (ctx->flags & RELM3U_FINGERPRINT) && fprint_file(entrypath, &fp))
+                    {   stats_add(&ps->fingerprints, 1);    }
+                char *slash = strrchr(entrypath, '/');
+                if (slash != NULL)
+                    {
+                        *slash = 0;
+                        if (strlength(entrypath) < PATHMAX) { recdir = state_addrecdir(ctx, rec, (entrypath[0] == 0) ? "/" : entrypath); }
+                    }
+            }
+        else
+            {   rec->missing++;  }
+        if (seriousflag && (method == 0))   { continue; }   // dropped from the file
+        struct stateentry *e = state_addentry(rec, seriousflag ? linbuf : key, linbuf, method, recdir);
+        if ((e != NULL) && (method > 0)) { e->fp = fp; }
+    }
+probedirs_close(&pd);
+state_recordfree(old);
+
+lineout_finish(&lo);
+lineout_summary(&lo);
+
+int done = 1;
+rec->hash = hash;
+if (seriousflag)
+    {
+        rec->missing = 0;
+        if (ob.failed) { done = 0; }
+        else if ((ob.used == pl.len) && ((ob.used == 0) || (memcmp(ob.data, pl.data, ob.used) == 0)))
+            {   fputs("NOTHING TO CHANGE. PLAYLIST LEFT AS IT IS.\n", out);   }
+        else
+            {
+                char bakfilename[PATHMAX];
+                done = backup_playlist(m3ufilepath, bakfilename, &pl, ps);
+                // the playlist is let go before it is overwritten
+                playlist_unload(&pl);
+                if (done) { done = write_counted(m3ufilepath, (ob.data != NULL) ? ob.data : "", ob.used, ps); }
+                rec->hash = state_hash64(ob.data, ob.used);
+            }
+    }
+playlist_unload(&pl);
+fputs("\n", out);
+
+// a playlist not written as planned is looked at in full next time
+if (done && (rec->path != NULL))    { state_putrecord(ctx, rec); }
+else                                { state_recordfree(rec); }
+free(ob.data);
+return(done);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// WATCH MODE (LINUX)
+//
+// Keeps the playlists below a collection root valid while files are moved
+// around. Every folder of the tree is watched through inotify. Each playlist
+// is resolved once at start (without writing) to learn which files it refers
+// to. After that, only events are processed: once the tree has been quiet for
+// WATCHSETTLE milliseconds, the filename indexes are brought up to date, which
+// re-reads just the folders whose mtime changed, and the playlists referring
+// to anything moved or deleted are converted again, in serious mode with the
+// usual back-up. Playlists with entries not found are converted again when a
+// file of the same name (or any folder) shows up.
+
+#ifdef __linux__
+
+#define WATCHSETTLE   500       // quiet time in ms before a batch of events is handled
+#define WATCHEVENTS   (IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE | IN_CREATE)
+
+struct watchplaylist
+{
+    char *path;                 // canonical path of the playlist
+    struct playlistrefs refs;   // entries as resolved on the last conversion
+    int affected;               // convert again in this batch
+};
+
+struct watchstate
+{
+    int fd;                     // inotify instance
+    char **wdpath;              // canonical folder path per watch descriptor
+    int *wdseen;                // generation of the last scan seeing the folder
+    int nwd;                    // watch descriptors covered by the tables
+    int nwatched;               // folders watched
+    int generation;
+    struct watchplaylist *pls;  // playlists below the root
+    int npls, apls;
+    char *gone;                 // paths moved away or deleted in this batch,
+    size_t goneused, gonesize;  // '?' and name of files that showed up
+    int dirsmoved;              // a folder came or went, watches must follow
+    int overflow;               // events were lost, look at everything
+};
+
+int watch_strappend(char **buf, size_t *used, size_t *size, char *str)
+{   // append NUL-terminated string to a growing string list
+size_t len = strlen(str) + 1;
+if (*used + len > *size)
+    {
+        size_t n = (*size == 0) ? 4096 : *size * 2;
+        while (*used + len > n) { n = n * 2; }
+        char *p = realloc(*buf, n);
+        if (p == NULL) { return(0); }
+        *buf = p;
+        *size = n;
+    }
+memcpy(*buf + *used, str, len);
+*used += len;
+return(1);
+}
+
+int watch_isplaylist(char *name)
+{
+return( (fnmatch("*.m3u", name, FNM_CASEFOLD) == 0) ||
+        (fnmatch("*.m3u8", name, FNM_CASEFOLD) == 0) );
+}
+
+void watch_addwd(struct watchstate *ws, char *dirpath)
+{   // watch one folder, or take note of its current path when watched already
+int wd = inotify_add_watch(ws->fd, dirpath, WATCHEVENTS | IN_ONLYDIR | IN_DONT_FOLLOW);
+if (wd < 0) { return; }
+if (wd >= ws->nwd)
+    {
+        int n = (ws->nwd == 0) ? 1024 : ws->nwd;
+        while (n <= wd) { n = n * 2; }
+        char **p = realloc(ws->wdpath, n * sizeof(char *));
+        if (p == NULL) { return; }
+        ws->wdpath = p;
+        int *q = realloc(ws->wdseen, n * sizeof(int));
+        if (q == NULL) { return; }
+        ws->wdseen = q;
+        while (ws->nwd < n) { ws->wdpath[ws->nwd] = NULL; ws->wdseen[ws->nwd] = 0; ws->nwd++; }
+    }
+if (ws->wdpath[wd] == NULL)                 { ws->nwatched++; }
+if ((ws->wdpath[wd] == NULL) || !strcomp(ws->wdpath[wd], dirpath))
+    {   free(ws->wdpath[wd]); ws->wdpath[wd] = strdup(dirpath);  }
+ws->wdseen[wd] = ws->generation;
+return;
+}
+
+void watch_scan(struct watchstate *ws, char *dirpath, int depth)
+{   // watch dirpath and all folders below, symbolic links are not followed
+    // dirpath is a PATHMAX buffer which is extended and restored in place
+watch_addwd(ws, dirpath);
+if (depth >= IDXMAXDEPTH) { return; }
+DIR *dp = opendir(dirpath); if (dp == NULL) { return; }
+int dirlen = strlength(dirpath);
+struct dirent *de;
+while ((de = readdir(dp)) != NULL)
+    {
+        char *name = de->d_name;
+        if ((name[0] == '.') && ((name[1] == 0) || ((name[1] == '.') && (name[2] == 0)))) { continue; }
+        if (dirlen + strlength(name) + 2 >= PATHMAX) { continue; }
+        sprintf(dirpath + dirlen, "/%s", name);
+        int isdir = (de->d_type == DT_DIR);
+        if (de->d_type == DT_UNKNOWN)
+            {   struct stat st; isdir = ((lstat(dirpath, &st) == 0) && S_ISDIR(st.st_mode));  }
+        if (isdir) { watch_scan(ws, dirpath, depth + 1); }
+        dirpath[dirlen] = 0;
+    }
+closedir(dp);
+return;
+}
+
+void watch_rescan(struct watchstate *ws, char *rootpath)
+{   // follow moved folders: watch all folders found now, drop the others
+char dirpath[PATHMAX];
+sprintf(dirpath, "%s", rootpath);
+ws->generation++;
+watch_scan(ws, dirpath, 1);
+int wd = 0;
+for (wd = 0; wd < ws->nwd; wd++)
+    {
+        if ((ws->wdpath[wd] == NULL) || (ws->wdseen[wd] == ws->generation)) { continue; }
+        inotify_rm_watch(ws->fd, wd);
+        free(ws->wdpath[wd]);
+        ws->wdpath[wd] = NULL;
+        ws->nwatched--;
+    }
+return;
+}
+
+struct watchplaylist *watch_addplaylist(struct watchstate *ws, char *path)
+{   // take on a playlist, or deliver it when known already
+int i = 0;
+for (i = 0; i < ws->npls; i++) { if (strcomp(ws->pls[i].path, path)) { return(&ws->pls[i]); } }
+if (ws->npls == ws->apls)
+    {
+        int n = (ws->apls == 0) ? 256 : ws->apls * 2;
+        struct watchplaylist *p = realloc(ws->pls, n * sizeof(struct watchplaylist));
+        if (p == NULL) { return(NULL); }
+        ws->pls = p;
+        ws->apls = n;
+    }
+struct watchplaylist *pl = &ws->pls[ws->npls];
+memset(pl, 0, sizeof(struct watchplaylist));
+pl->path = strdup(path);
+if (pl->path == NULL) { return(NULL); }
+ws->npls++;
+return(pl);
+}
+
+void watch_dropplaylist(struct watchstate *ws, char *path)
+{
+int i = 0;
+for (i = 0; i < ws->npls; i++)
+    {
+        if (!strcomp(ws->pls[i].path, path)) { continue; }
+        free(ws->pls[i].path);
+        free(ws->pls[i].refs.names);
+        ws->pls[i] = ws->pls[--ws->npls];
+        return;
+    }
+return;
+}
+
+void watch_event(struct watchstate *ws, struct inotify_event *ev)
+{   // take note of one event, the batch is handled when the tree is quiet
+if (ev->mask & IN_Q_OVERFLOW)   { ws->overflow = 1; ws->dirsmoved = 1; return; }
+if ((ev->len == 0) || (ev->wd < 0) || (ev->wd >= ws->nwd) || (ws->wdpath[ev->wd] == NULL)) { return; }
+char *name = ev->name;
+if (strleftcomp(name, OWNFILES)) { return; }
+
+char path[2 * PATHMAX + 2];
+sprintf(path, "%s/%s", ws->wdpath[ev->wd], name);
+if (strlength(path) >= PATHMAX) { return; }
+int isdir = ((ev->mask & IN_ISDIR) != 0);
+if (isdir) { ws->dirsmoved = 1; }
+
+if (ev->mask & (IN_MOVED_FROM | IN_DELETE))
+    {
+        if (!isdir && watch_isplaylist(name))   { watch_dropplaylist(ws, path); }
+        watch_strappend(&ws->gone, &ws->goneused, &ws->gonesize, path);
+    }
+if (ev->mask & (IN_MOVED_TO | IN_CREATE))
+    {
+        if (!isdir && watch_isplaylist(name))
+            {
+                struct watchplaylist *pl = watch_addplaylist(ws, path);
+                if (pl != NULL) { pl->affected = 1; }
+            }
+        char shown[PATHMAX + 2];
+        sprintf(shown, "?%s", isdir ? "" : name);
+        watch_strappend(&ws->gone, &ws->goneused, &ws->gonesize, shown);
+    }
+return;
+}
+
+int watch_isaffected(struct watchstate *ws, struct watchplaylist *pl)
+{   // does a playlist refer to anything in the batch?
+if (ws->overflow) { return(1); }
+size_t g = 0;
+while (g < ws->goneused)
+    {
+        char *gone = ws->gone + g;
+        size_t gonelen = strlen(gone);
+        g += gonelen + 1;
+        size_t r = 0;
+        while (r < pl->refs.used)
+            {
+                char *ref = pl->refs.names + r;
+                size_t reflen = strlen(ref);
+                r += reflen + 1;
+                if (gone[0] == '?')
+                    {   // something showed up, a missing entry may be found now
+                        if (ref[0] != '?') { continue; }
+                        if ((gone[1] == 0) || idx_namecomp(gone + 1, ref + 1)) { return(1); }
+                    }
+                else if ( (ref[0] == '/') && (strncmp(ref, gone, gonelen) == 0) &&
+                          ((ref[gonelen] == 0) || (ref[gonelen] == '/')) )
+                    {   return(1);  }
+            }
+    }
+return(0);
+}
+
+int watch_convert(relm3u_ctx *ctx, struct watchplaylist *pl, int seriousflag, FILE *report)
+{   // convert a playlist again and remember what it refers to now
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+int done = convert_playlist_to_relative(ctx, pl->path, seriousflag, 1, report, &pl->refs, NULL, &ps);
+if (done)   { ps.playlists = 1; }
+else        { ps.failed = 1; }
+stats_merge(ctx, &ps);
+fputs(done ? "SUCCESS.\n\n" : "FAILED.\n\n", report);
+fflush(report);
+return(done);
+}
+
+int watch_tree(relm3u_ctx *ctx, char *rootpath, int seriousflag, FILE *report, volatile int *stop)
+{
+struct watchstate ws;
+memset(&ws, 0, sizeof(ws));
+ws.fd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+if (ws.fd < 0) { fputs("CANNOT WATCH FOR CHANGES.\n", report); return(0); }
+watch_rescan(&ws, rootpath);
+
+// learn what the playlists refer to, without writing anything (and uncounted)
+struct relm3u_stats scratch;
+FILE *quiet = fopen("/dev/null", "w");
+if (quiet == NULL) { close(ws.fd); return(0); }
+struct m3uiter it;
+char pathstr[PATHMAX];
+sprintf(pathstr, "%s/", rootpath);
+m3uiter_open(&it, pathstr, 1);
+while (m3uiter_next(&it, pathstr))
+    {
+        struct watchplaylist *pl = watch_addplaylist(&ws, pathstr);
+        if (pl == NULL) { continue; }
+        memset(&scratch, 0, sizeof(scratch));
+        convert_playlist_to_relative(ctx, pl->path, 0, 1, quiet, &pl->refs, NULL, &scratch);
+    }
+m3uiter_close(&it);
+fclose(quiet);
+fprintf(report, "WATCHING %d FOLDERS, %d PLAYLISTS.\n\n", ws.nwatched, ws.npls);
+fflush(report);
+
+char buf[65536] __attribute__((aligned(__alignof__(struct inotify_event))));
+int pending = 0;
+while (!*stop)
+    {
+        // wait for events, a batch is handled after WATCHSETTLE ms of quiet
+        struct pollfd pfd = { ws.fd, POLLIN, 0 };
+        int r = poll(&pfd, 1, pending ? WATCHSETTLE : 1000);
+        if ((r < 0) && (errno != EINTR))  { break; }
+        if (r > 0)
+            {
+                ssize_t n;
+                while ((n = read(ws.fd, buf, sizeof(buf))) > 0)
+                    {
+                        char *p = buf;
+                        while (p < buf + n)
+                            {
+                                struct inotify_event *ev = (struct inotify_event *)p;
+                                watch_event(&ws, ev);
+                                p += sizeof(struct inotify_event) + ev->len;
+                            }
+                        pending = 1;
+                    }
+                continue;
+            }
+        if ((r < 0) || !pending) { continue; }
+
+        // the tree is quiet now, handle the batch
+        int affected = 0;
+        pending = 0;
+        libindex_refresh(ctx);
+        if (ws.dirsmoved) { watch_rescan(&ws, rootpath); }
+        int i = 0;
+        for (i = 0; i < ws.npls; i++)
+            {
+                struct watchplaylist *pl = &ws.pls[i];
+                if (watch_isaffected(&ws, pl)) { pl->affected = 1; }
+                if (pl->affected) { affected++; }
+            }
+        if (affected > 0)   { fprintf(report, "CHANGES SEEN, %d PLAYLIST(S) AFFECTED.\n\n", affected); }
+        for (i = 0; i < ws.npls; i++)
+            {
+                struct watchplaylist *pl = &ws.pls[i];
+                if (pl->affected)   { watch_convert(ctx, pl, seriousflag, report); }
+                pl->affected = 0;
+            }
+        ws.goneused = 0;
+        ws.dirsmoved = 0;
+        ws.overflow = 0;
+    }
+
+close(ws.fd);
+int i = 0;
+for (i = 0; i < ws.nwd; i++)    { free(ws.wdpath[i]); }
+for (i = 0; i < ws.npls; i++)   { free(ws.pls[i].path); free(ws.pls[i].refs.names); }
+free(ws.wdpath);
+free(ws.wdseen);
+free(ws.pls);
+free(ws.gone);
+return(1);
+}
+
+#endif
+
+#ifdef UNIXES
+// -----------------------------------------------------------------------------
+// SERVER MODE (UNIX)
+//
+// Answers other programs on a Unix domain socket, so a host repairing single
+// playlists now and then does not pay for a cold start each time: the
+// filename indexes, the folders met while probing and the tag caches stay
+// resident in the context between requests. Accepted connections are queued
+// to a fixed pool of workers (more than SERVEQUEUE waiting are turned away),
+// each worker serving one connection at a time and its requests in order.
+// While requests come in, the indexes are brought up to date every
+// SERVEREFRESH milliseconds, lookups go on meanwhile. The requests are
+// described at relm3u_serve() in librelm3u.h.
+
+#define SERVEREFRESH  5000          // ms between index refreshes while busy
+#define SERVEQUEUE    64            // connections waiting for a worker
+#define SERVEMAXDATA  (64 << 20)    // largest playlist taken by CONVERT
+
+struct servestate
+{
+    relm3u_ctx *ctx;
+    FILE *quiet;                // reports of conversions go nowhere
+    int queue[SERVEQUEUE];      // accepted connections, as a ring
+    int head, count;
+    int *active;                // connection served per worker, (-1) for none
+    int closed;                 // no more connections come
+    long long requests;         // requests answered
+    pthread_mutex_t lock;
+    pthread_cond_t ready;       // a connection is queued or closed is set
+};
+
+struct serveworker
+{
+    struct servestate *ss;
+    int no;
+};
+
+int serve_send(int fd, const char *data, size_t len)
+{   // send all of data; a client gone does not raise SIGPIPE where the system
+    // allows to say so, elsewhere the host has to ignore SIGPIPE
+    // return (0) when the client is gone
+while (len > 0)
+    {
+        #ifdef MSG_NOSIGNAL
+        ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+        #else
+        ssize_t n = write(fd, data, len);
+        #endif
+        if ((n < 0) && (errno == EINTR)) { continue; }
+        if (n <= 0) { return(0); }
+        data += n;
+        len -= n;
+    }
+return(1);
+}
+
+char *serve_field(char **rest)
+{   // cut the next tab-separated field off *rest, NULL when there is none
+if (*rest == NULL) { return(NULL); }
+char *field = *rest;
+char *tab = strchr(field, '\t');
+if (tab != NULL)    { *tab = 0; *rest = tab + 1; }
+else                { *rest = NULL; }
+return(field);
+}
+
+int serve_convert(relm3u_ctx *ctx, char *m3ufilepath, struct playlistdata *pl, struct outbuf *ob, FILE *out, int *found, int *total)
+{   // convert a playlist handed over in memory as if it was read from
+    // m3ufilepath, as serious mode would but writing nothing: the new playlist
+    // is collected in ob; duplicates are not looked for
+    // return (0) when memory was short
+char playlistpath[PATHMAX] = "";
+get_only_filepath(playlistpath, m3ufilepath);
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+stats_add(&ps.bytes_read, pl->len);
+
+struct lineout lo;
+lineout_init(&lo, ctx, NULL, playlistpath, 1, ob, out, &ps);
+struct probedirs pd;
+probedirs_init(&pd, ctx->radius + 1);
+probedirs_open(&pd, playlistpath, ctx->radius + 1);
+convert_playlist_lines(ctx, pl, &lo, playlistpath, &pd, &ps, 1);
+probedirs_close(&pd);
+lineout_finish(&lo);
+
+*found = lo.filesfound;
+*total = lo.filestotal;
+if (!ob->failed)    { ps.playlists = 1; }
+else                { ps.failed = 1; }
+stats_merge(ctx, &ps);
+return(!ob->failed);
+}
+
+int serve_request(struct servestate *ss, int fd, FILE *in, char *req)
+{   // answer one request line, the data of CONVERT is read from in
+    // return (0) when the connection is to be closed
+char reply[2 * PATHMAX + 64];
+char *rest = req;
+char *verb = serve_field(&rest);
+
+if (strcmp(verb, "RESOLVE") == 0)
+    {
+        char *m3upath = serve_field(&rest);
+        char *entry = serve_field(&rest);
+        char result[PATHMAX];
+        int method = -1;
+        int ambiguous = 0;
+        if ((entry != NULL) && (rest == NULL))  { method = relm3u_resolve(ss->ctx, m3upath, entry, result, PATHMAX, &ambiguous); }
+        if (method < 0)     { return(serve_send(fd, "ERR\tBAD RESOLVE\n", 16)); }
+        int n = snprintf(reply, sizeof(reply), "OK\t%d\t%d\t%s\n", method, ambiguous, result);
+        return(serve_send(fd, reply, n));
+    }
+
+if (strcmp(verb, "CONVERT") == 0)
+    {
+        char *m3upath = serve_field(&rest);
+        char *lenstr = serve_field(&rest);
+        char *end = NULL;
+        long long len = (lenstr != NULL) ? strtoll(lenstr, &end, 10) : -1;
+        if ((rest != NULL) || (lenstr == NULL) || (*lenstr == 0) || (*end != 0) || (len < 0) || (len > SERVEMAXDATA) || (strlen(m3upath) >= PATHMAX))
+            {   // the data that follows cannot be told from requests
+                serve_send(fd, "ERR\tBAD CONVERT\n", 16);
+                return(0);
+            }
+        struct playlistdata pl;
+        pl.data = malloc((len > 0) ? len : 1);
+        pl.len = len;
+        pl.mapped = 0;
+        if (pl.data == NULL)    { serve_send(fd, "ERR\tOUT OF MEMORY\n", 18); return(0); }
+        if (fread(pl.data, 1, len, in) != (size_t)len)  { free(pl.data); return(0); }
+
+        char m3ufilepath[PATHMAX];
+        sprintf(m3ufilepath, "%s", m3upath);
+        struct outbuf ob;
+        memset(&ob, 0, sizeof(ob));
+        int found = 0;
+        int total = 0;
+        int done = serve_convert(ss->ctx, m3ufilepath, &pl, &ob, ss->quiet, &found, &total);
+        free(pl.data);
+        int alive = 0;
+        if (!done)  { alive = serve_send(fd, "ERR\tOUT OF MEMORY\n", 18); }
+        else
+            {
+                int n = snprintf(reply, sizeof(reply), "OK\t%d\t%d\t%zu\n", found, total, ob.used);
+                alive = serve_send(fd, reply, n) && serve_send(fd, (ob.data != NULL) ? ob.data : "", ob.used);
+            }
+        free(ob.data);
+        return(alive);
+    }
+
+if ((strcmp(verb, "REFRESH") == 0) && (rest == NULL))
+    {
+        libindex_refresh(ss->ctx);
+        return(serve_send(fd, "OK\n", 3));
+    }
+
+return(serve_send(fd, "ERR\tUNKNOWN REQUEST\n", 20));
+}
+
+void serve_connection(struct servestate *ss, int fd)
+{   // answer the requests of one connection until the client hangs up
+int rfd = dup(fd);
+FILE *in = (rfd >= 0) ? fdopen(rfd, "r") : NULL;
+if (in == NULL)
+    {
+        if (rfd >= 0) { close(rfd); }
+        return;
+    }
+char *req = NULL;
+size_t reqsize = 0;
+ssize_t n;
+while ((n = getline(&req, &reqsize, in)) > 0)
+    {
+        if (req[n - 1] != '\n') { break; }      // cut off
+        req[--n] = 0;
+        if ((n > 0) && (req[n - 1] == '\r')) { req[--n] = 0; }
+        int alive = serve_request(ss, fd, in, req);
+        pthread_mutex_lock(&ss->lock);
+        ss->requests++;
+        pthread_mutex_unlock(&ss->lock);
+        if (!alive) { break; }
+    }
+free(req);
+fclose(in);
+return;
+}
+
+void *serve_worker(void *arg)
+{   // take connections off the queue until it is closed
+struct serveworker *w = arg;
+struct servestate *ss = w->ss;
+while (1)
+    {
+        pthread_mutex_lock(&ss->lock);
+        while ((ss->count == 0) && !ss->closed) { pthread_cond_wait(&ss->ready, &ss->lock); }
+        if (ss->count == 0)
+            {
+                pthread_mutex_unlock(&ss->lock);
+                break;
+            }
+        int fd = ss->queue[ss->head];
+        ss->head = (ss->head + 1) % SERVEQUEUE;
+        ss->count--;
+        ss->active[w->no] = fd;
+        pthread_mutex_unlock(&ss->lock);
+
+        serve_connection(ss, fd);
+
+        pthread_mutex_lock(&ss->lock);
+        ss->active[w->no] = -1;
+        pthread_mutex_unlock(&ss->lock);
+        close(fd);
+    }
+return(NULL);
+}
+
+int serve_listen(const char *sockpath, FILE *report)
+{   // bind a listening socket to sockpath; a socket file left over by an
+    // earlier run is replaced, anything else there is left alone
+    // return the socket, (-1) on failure
+struct sockaddr_un sa;
+memset(&sa, 0, sizeof(sa));
+sa.sun_family = AF_UNIX;
+if (strlen(sockpath) >= sizeof(sa.sun_path))    { fputs("SOCKET PATH TOO LONG.\n", report); return(-1); }
+sprintf(sa.sun_path, "%s", sockpath);
+
+int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+if (fd < 0) { fputs("CANNOT MAKE SOCKET.\n", report); return(-1); }
+fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+struct stat st;
+if (lstat(sockpath, &st) == 0)
+    {
+        if (!S_ISSOCK(st.st_mode))  { fputs("SOCKET PATH IS TAKEN BY A FILE.\n", report); close(fd); return(-1); }
+        if (connect(fd, (struct sockaddr *)&sa, sizeof(sa)) == 0)
+            {   fputs("SOCKET IS IN USE BY ANOTHER SERVER.\n", report); close(fd); return(-1);  }
+        unlink(sockpath);
+        // a failed connect leaves the socket unusable on some systems
+        close(fd);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) { fputs("CANNOT MAKE SOCKET.\n", report); return(-1); }
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+if ((bind(fd, (struct sockaddr *)&sa, sizeof(sa)) != 0) || (listen(fd, SERVEQUEUE) != 0))
+    {
+        fprintf(report, "CANNOT LISTEN ON \"%s\".\n", sockpath);
+        close(fd);
+        return(-1);
+    }
+return(fd);
+}
+
+int serve_socket(relm3u_ctx *ctx, const char *sockpath, int njobs, FILE *report, volatile int *stop)
+{   // accept connections until *stop becomes non-zero, then let the workers
+    // finish the requests under way and remove the socket
+int lfd = serve_listen(sockpath, report);
+if (lfd < 0) { return(0); }
+
+struct servestate ss;
+memset(&ss, 0, sizeof(ss));
+ss.ctx = ctx;
+ss.quiet = fopen("/dev/null", "w");
+ss.active = malloc(njobs * sizeof(int));
+struct serveworker *workers = malloc(njobs * sizeof(struct serveworker));
+pthread_t *threads = malloc(njobs * sizeof(pthread_t));
+if ((ss.quiet == NULL) || (ss.active == NULL) || (workers == NULL) || (threads == NULL))
+    {
+        fputs("OUT OF MEMORY.\n", report);
+        if (ss.quiet != NULL) { fclose(ss.quiet); }
+        free(ss.active);
+        free(workers);
+        free(threads);
+        close(lfd);
+        unlink(sockpath);
+        return(0);
+    }
+pthread_mutex_init(&ss.lock, NULL);
+pthread_cond_init(&ss.ready, NULL);
+
+int started = 0;
+while (started < njobs)
+    {
+        ss.active[started] = -1;
+        workers[started].ss = &ss;
+        workers[started].no = started;
+        if (pthread_create(&threads[started], NULL, serve_worker, &workers[started]) != 0) { break; }
+        started++;
+    }
+int served = (started > 0);
+if (!served)    { fputs("CANNOT START WORKERS.\n", report); }
+else            { fprintf(report, "SERVING ON \"%s\" WITH %d WORKERS.\n", sockpath, started); fflush(report); }
+
+long long refreshed = 0;     // requests answered at the last refresh
+long long lastrefresh = now_ns();
+while (served && !*stop)
+    {
+        struct pollfd pfd;
+        pfd.fd = lfd;
+        pfd.events = POLLIN;
+        int ready = poll(&pfd, 1, 1000);
+        if ((ready > 0) && (pfd.revents & POLLIN))
+            {
+                int cfd = accept(lfd, NULL, NULL);
+                if (cfd >= 0)
+                    {
+                        fcntl(cfd, F_SETFD, FD_CLOEXEC);
+                        pthread_mutex_lock(&ss.lock);
+                        int queued = (ss.count < SERVEQUEUE);
+                        if (queued)
+                            {
+                                ss.queue[(ss.head + ss.count) % SERVEQUEUE] = cfd;
+                                ss.count++;
+                                pthread_cond_signal(&ss.ready);
+                            }
+                        pthread_mutex_unlock(&ss.lock);
+                        if (!queued)    { serve_send(cfd, "ERR\tBUSY\n", 9); close(cfd); }
+                    }
+            }
+
+        // files come and go while the server runs, keep the indexes close
+        pthread_mutex_lock(&ss.lock);
+        long long requests = ss.requests;
+        pthread_mutex_unlock(&ss.lock);
+        if ((requests != refreshed) && (now_ns() - lastrefresh >= SERVEREFRESH * 1000000LL))
+            {
+                libindex_refresh(ctx);
+                refreshed = requests;
+                lastrefresh = now_ns();
+            }
+    }
+
+// connections queued are hung up on, those being served see their end
+pthread_mutex_lock(&ss.lock);
+ss.closed = 1;
+while (ss.count > 0)
+    {
+        close(ss.queue[ss.head]);
+        ss.head = (ss.head + 1) % SERVEQUEUE;
+        ss.count--;
+    }
+int i = 0;
+for (i = 0; i < started; i++)
+    {   if (ss.active[i] >= 0) { shutdown(ss.active[i], SHUT_RD); }   }
+pthread_cond_broadcast(&ss.ready);
+pthread_mutex_unlock(&ss.lock);
+for (i = 0; i < started; i++)   { pthread_join(threads[i], NULL); }
+
+close(lfd);
+unlink(sockpath);
+pthread_mutex_destroy(&ss.lock);
+pthread_cond_destroy(&ss.ready);
+fclose(ss.quiet);
+free(ss.active);
+free(workers);
+free(threads);
+return(served);
+}
+#endif
+
+#ifdef UNIXES
+// -----------------------------------------------------------------------------
+// PLAYLIST GENERATION FROM TAGS (UNIX)
+//
+// Makes one playlist '!_<folder>.m3u8' per music folder as autogen_playlists.py
+// does: all .mp3 and .m4a files below the folder, sorted by year, album and
+// track number from their tags, in a folder 'playlists' next to the music
+// folders. Missing tag fields get the script's defaults, album "AAAAA", track
+// and year 0. The files are listed through the library index and their tags
+// are looked up on TAGJOBS threads at a time (see MUSIC FILE TAGS). Entries are
+// made relative by search method 1 from the playlists folder, as a conversion
+// of the playlist would make them.
+
+#define TAGJOBS       8             // files looked up at a time
+#define GENFOLDER     "playlists"
+#define GENNOALBUM    "AAAAA"
+
+struct genfile
+{   // one music file of a playlist to be generated
+    uint32_t file;          // file number in the index
+    uint32_t folder;        // directory number of the music folder it belongs to
+    struct tagdata td;
+};
+
+struct genwork
+{   // tags of the music files being read
+    relm3u_ctx *ctx;
+    struct libindex *ix;
+    struct genfile *files;
+    uint32_t nfiles;
+    uint32_t next;          // first file not claimed by a reader yet
+    pthread_mutex_t lock;
+    struct relm3u_stats *ps;
+};
+
+void *tag_worker(void *arg)
+{   // get the tags of batches of files until none are left
+struct genwork *w = arg;
+char relpath[PATHMAX];
+char (*paths)[2 * PATHMAX + 2] = malloc(TAGBATCH * sizeof(*paths));
+struct tagquery q[TAGBATCH];
+if (paths == NULL) { return(NULL); }
+while (1)
+    {
+        pthread_mutex_lock(&w->lock);
+        uint32_t i = w->next;
+        uint32_t end = (w->nfiles - i > TAGBATCH) ? i + TAGBATCH : w->nfiles;
+        w->next = end;
+        pthread_mutex_unlock(&w->lock);
+        if (i >= end) { break; }
+
+        int n = 0;
+        for (; i < end; i++, n++)
+            {
+                struct genfile *g = &w->files[i];
+                libindex_path(w->ix, g->file, relpath, PATHMAX);
+                sprintf(paths[n], "%s/%s", w->ix->rootpath, relpath);
+                q[n].path = paths[n];
+                q[n].td = &g->td;
+            }
+        tags_get(w->ctx, w->ix, q, n, w->ps);
+        for (i = end - n; i < end; i++)
+            {
+                struct tagdata *td = &w->files[i].td;
+                if (!(td->found & TAGALBUM)) { sprintf(td->album, "%s", GENNOALBUM); }
+            }
+    }
+free(paths);
+return(NULL);
+}
+
+int genfile_cmp(const void *a, const void *b)
+{   // by music folder, then year, album and track number, then listing order
+const struct genfile *x = a, *y = b;
+if (x->folder != y->folder)         { return((x->folder < y->folder) ? -1 : 1); }
+if (x->td.year != y->td.year)       { return((x->td.year < y->td.year) ? -1 : 1); }
+int c = strcmp(x->td.album, y->td.album);
+if (c != 0)                         { return(c); }
+if (x->td.track != y->td.track)     { return((x->td.track < y->td.track) ? -1 : 1); }
+if (x->file != y->file)             { return((x->file < y->file) ? -1 : 1); }
+return(0);
+}
+
+void gen_probedirs(struct probedirs *pd, char *pllpath, char *basepath, int nlevels)
+{   // folder handles for probing from the playlists folder, nlevels >= 2 since
+    // entries lead out of it; while it does not exist yet (test mode) basepath
+    // holding it and its ancestors serve alone
+probedirs_open(pd, pllpath, nlevels);
+if (pd->fd[1] >= 0) { return; }
+probedirs_close(pd);
+struct probedirs up;
+probedirs_open(&up, basepath, nlevels - 1);
+probedirs_init(pd, nlevels);
+int level = 0;
+for (level = 1; level < nlevels; level++)
+    {   pd->fd[level] = up.fd[level - 1]; pd->dev[level] = up.dev[level - 1]; pd->ino[level] = up.ino[level - 1];  }
+return;
+}
+
+int generate_write(char *m3upath, struct outbuf *ob, FILE *out, struct relm3u_stats *ps)
+{   // write a generated playlist, an existing one is backed up first unless
+    // it is the same; return (1) on success, (0) on failure
+if (ob->failed) { return(0); }
+if (!check_file_exist(m3upath)) { return(write_counted(m3upath, (ob->data != NULL) ? ob->data : "", ob->used, ps)); }
+struct playlistdata pl;
+if (!playlist_load(m3upath, &pl)) { return(0); }
+stats_add(&ps->bytes_read, pl.len);
+int done = 1;
+if ((ob->used == pl.len) && ((ob->used == 0) || (memcmp(ob->data, pl.data, ob->used) == 0)))
+    {   fputs("NOTHING TO CHANGE. PLAYLIST LEFT AS IT IS.\n", out);   }
+else
+    {
+        char bakfilename[PATHMAX];
+        done = backup_playlist(m3upath, bakfilename, &pl, ps);
+        playlist_unload(&pl);
+        if (done) { done = write_counted(m3upath, (ob->data != NULL) ? ob->data : "", ob->used, ps); }
+    }
+playlist_unload(&pl);
+return(done);
+}
+
+int generate_playlists(relm3u_ctx *ctx, char *folder, int all, int seriousflag, FILE *out, struct relm3u_stats *ps)
+{   // one playlist per music folder below folder (all = 1), or for folder
+    // itself (all = 0), into the folder 'playlists' beside the music folders
+    // return the number of playlists generated, (-1) when folder cannot be read
+char canon[PATHMAX];
+if ((realpath(folder, canon) == NULL) || (strlength(canon) < 2)) { fputs("FOLDER DOES NOT EXIST.\n", out); return(-1); }
+
+// the music folders and the playlists folder are in basepath
+char basepath[PATHMAX + 2];
+char pllpath[PATHMAX + 16];
+char *foldername = strrchr(canon, '/') + 1;
+if (all)    { sprintf(basepath, "%s/", canon); }
+else        { memcpy(basepath, canon, foldername - canon); basepath[foldername - canon] = 0; }
+sprintf(pllpath, "%s%s/", basepath, GENFOLDER);
+
+struct libindex *ix = libindex_acquire(ctx, libindex_treeof(ctx, canon));
+if (ix == NULL) { fputs("FOLDER CANNOT BE READ.\n", out); return(-1); }
+char *sub = canon + ix->rootlen;
+if (*sub == '/') { sub++; }
+int sublen = strlength(sub);
+int64_t sd = libindex_finddir(ix, sub);
+if (sd < 0) { libindex_release(ctx); fputs("FOLDER CANNOT BE READ.\n", out); return(-1); }
+struct genwork w;
+memset(&w, 0, sizeof(w));
+w.ctx = ctx;
+w.ix = ix;
+w.ps = ps;
+uint32_t afiles = 0;
+
+// music files below the folder, with the music folder each belongs to
+char name[PATHMAX];
+uint32_t f = 0;
+for (f = 0; f < ix->hdr->nfiles; f++)
+    {
+        uint32_t d = ix->entries[f].dir;
+        uint32_t below = d;
+        while ((d != (uint32_t)sd) && (d != 0)) { below = d; d = ix->dirs[d].parent; }
+        if (d != (uint32_t)sd) { continue; }
+        if (all && ((below == (uint32_t)sd) || strcomp(ix->pool + ix->dirs[below].nameofs, GENFOLDER))) { continue; }
+        if (!tag_isaudio(libindex_filename(ix, f, name))) { continue; }
+        struct genfile *t = idx_grow(w.files, &afiles, w.nfiles + 1, sizeof(struct genfile));
+        if (t == NULL) { free(w.files); libindex_release(ctx); fputs("FOLDER CANNOT BE READ.\n", out); return(-1); }
+        w.files = t;
+        w.files[w.nfiles].file = f;
+        w.files[w.nfiles].folder = all ? below : (uint32_t)sd;
+        w.nfiles++;
+    }
+
+// their tags, from the tag cache or read by TAGJOBS threads
+pthread_mutex_init(&w.lock, NULL);
+pthread_t tids[TAGJOBS];
+int started = 0;
+while ((started < TAGJOBS - 1) && ((uint32_t)started * TAGBATCH < w.nfiles))
+    {
+        if (pthread_create(&tids[started], NULL, tag_worker, &w) != 0) { break; }
+        started++;
+    }
+tag_worker(&w);
+while (started > 0) { pthread_join(tids[--started], NULL); }
+pthread_mutex_destroy(&w.lock);
+tagcache_flush(ctx, ix);
+if (w.nfiles > 0) { qsort(w.files, w.nfiles, sizeof(struct genfile), genfile_cmp); }
+
+if (seriousflag && (w.nfiles > 0)) { mkdir(pllpath, 0777); }
+struct probedirs pd;
+gen_probedirs(&pd, pllpath, basepath, (ctx->radius < 1) ? 2 : ctx->radius + 1);
+int made = 0;
+uint32_t i = 0;
+while (i < w.nfiles)
+    {
+        uint32_t folderno = w.files[i].folder;
+        if (all) { foldername = ix->pool + ix->dirs[folderno].nameofs; }
+        char m3upath[2 * PATHMAX];
+        sprintf(m3upath, "%s!_%s.m3u8", pllpath, foldername);
+        if (seriousflag)    { fputs("SERIOUS MODE. PLAYLIST GONNA GET WRITTEN.\n\n", out); }
+        else                { fputs("TEST MODE. NO WRITE ACCESS. JUST INFO.\n\n", out); }
+        fprintf(out, "PATH: \"%s\"\n\n", m3upath);
+
+        struct outbuf ob;
+        ob.data = NULL;
+        ob.used = 0;
+        ob.size = 0;
+        ob.failed = 0;
+        struct lineout lo;
+        lineout_init(&lo, ctx, NULL, pllpath, seriousflag, &ob, out, ps);
+        int notag = 0, noalbum = 0, notrack = 0, noyear = 0;
+        for (; (i < w.nfiles) && (w.files[i].folder == folderno); i++)
+            {   // entry relative to basepath, then to the playlists folder
+                struct genfile *g = &w.files[i];
+                char relpath[PATHMAX];
+                char linbuf[2 * PATHMAX];
+                if (libindex_path(ix, g->file, relpath, PATHMAX) < 0) { continue; }
+                char *below = relpath + sublen + ((sublen > 0) ? 1 : 0);
+                if (all)    { sprintf(linbuf, "%s", below); }
+                else if (strlength(foldername) + strlength(below) + 2 < PATHMAX) { sprintf(linbuf, "%s/%s", foldername, below); }
+                else        { continue; }
+                int method = find_relpath_by_pathprobing(ctx, linbuf, pllpath, &pd, ps) ? 1 : 0;
+                count_entry(ps, method);
+                emit_playlist_line(&lo, linbuf, method);
+
+                struct tagdata *td = &g->td;
+                if (!(td->found & TAGANY)) { fputs("T: NO TAG\n", out); notag++; continue; }
+                if (!(td->found & TAGALBUM)) { noalbum++; }
+                if (!(td->found & TAGTRACK)) { notrack++; }
+                if (!(td->found & TAGYEAR))  { noyear++; }
+                char what[64] = "";
+                if (!(td->found & TAGALBUM)) { strcat(what, ", ALBUM"); }
+                if (!(td->found & TAGTRACK)) { strcat(what, ", TRACK NUMBER"); }
+                if (!(td->found & TAGYEAR))  { strcat(what, ", YEAR"); }
+                if (what[0] != 0) { fprintf(out, "T: NO%s IN TAG\n", what + 1); }
+            }
+        lineout_summary(&lo);
+        fprintf(out, "MISSING: %d TAGS, %d ALBUMS, %d TRACK NUMBERS, %d YEARS\n", notag, noalbum, notrack, noyear);
+        if (!seriousflag || generate_write(m3upath, &ob, out, ps))   { made++; }
+        else                                                        { fputs("PLAYLIST CANNOT BE WRITTEN.\n", out); }
+        fputs("\n", out);
+        free(ob.data);
+    }
+probedirs_close(&pd);
+libindex_release(ctx);
+free(w.files);
+if (w.nfiles == 0) { fputs("NO MUSIC FILES FOUND.\n\n", out); }
+return(made);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// LIBRARY INTERFACE
+//
+// Thin entry points over the functions above, see librelm3u.h. Strings from
+// the host are copied into PATHMAX buffers first, since the conversion works
+// on its strings in place.
+
+relm3u_ctx *relm3u_open(const char *libroot, int flags)
+{
+relm3u_ctx *ctx = calloc(1, sizeof(relm3u_ctx));
+if (ctx == NULL) { return(NULL); }
+ctx->flags = flags;
+ctx->radius = RELM3U_RADIUS;
+#ifdef UNIXES
+pthread_rwlock_init(&ctx->indexlock, NULL);
+pthread_rwlock_init(&ctx->probelock, NULL);
+pthread_mutex_init(&ctx->statslock, NULL);
+pthread_mutex_init(&ctx->ringlock, NULL);
+pthread_mutex_init(&ctx->statelock, NULL);
+pthread_mutex_init(&ctx->fplock, NULL);
+pthread_mutex_init(&ctx->dupelock, NULL);
+pthread_rwlock_init(&ctx->taglock, NULL);
+if (libroot != NULL)
+    {   // index the library tree now, playlists below it share this index
+        char canonpath[PATHMAX];
+        if (realpath(libroot, canonpath) == NULL) { relm3u_close(ctx); return(NULL); }
+        sprintf(ctx->library, "%s", canonpath);
+        if (libindex_acquire(ctx, canonpath) != NULL) { libindex_release(ctx); }
+    }
+#else
+(void)libroot;
+#endif
+return(ctx);
+}
+
+void relm3u_close(relm3u_ctx *ctx)
+{
+if (ctx == NULL) { return; }
+#ifdef UNIXES
+libindex_free_all(ctx);
+probecache_free(ctx);
+pthread_rwlock_destroy(&ctx->indexlock);
+pthread_rwlock_destroy(&ctx->probelock);
+pthread_mutex_destroy(&ctx->statslock);
+#ifdef PROBEURING
+probering_free_all(ctx);
+#endif
+pthread_mutex_destroy(&ctx->ringlock);
+state_free(ctx->state);
+pthread_mutex_destroy(&ctx->statelock);
+pthread_mutex_destroy(&ctx->fplock);
+pthread_mutex_destroy(&ctx->dupelock);
+pthread_rwlock_destroy(&ctx->taglock);
+while (ctx->nsnapshots > 0) { free(ctx->snapshots[--ctx->nsnapshots]); }
+#endif
+dupes_free(ctx);
+free(ctx);
+return;
+}
+
+int relm3u_resolve(relm3u_ctx *ctx, const char *m3upath, const char *entry, char *result, size_t resultsize, int *ambiguous)
+{
+char linbuf[PATHMAX];
+char playlistpath[PATHMAX];
+if (ambiguous != NULL) { *ambiguous = 0; }
+if ((strlen(m3upath) >= PATHMAX) || (strlen(entry) >= PATHMAX - 1)) { return(-1); }
+sprintf(linbuf, "%s", entry);
+get_only_filepath(playlistpath, (char *)m3upath);
+
+struct probedirs pd;
+probedirs_init(&pd, ctx->radius + 1);
+#ifdef UNIXES
+probedirs_open(&pd, playlistpath, ctx->radius + 1);
+#endif
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+int method = resolve_playlist_line(ctx, linbuf, playlistpath, &pd, &ps, NULL);
+stats_merge(ctx, &ps);
+#ifdef UNIXES
+probedirs_close(&pd);
+#endif
+if (resultsize > 0) { snprintf(result, resultsize, "%s", linbuf); }
+if (ambiguous != NULL) { *ambiguous = (method == 3); }
+return(report_method(method));
+}
+
+int relm3u_convert(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, FILE *report)
+{
+return(relm3u_convert_stats(ctx, m3upath, serious, linejobs, report, NULL));
+}
+
+int relm3u_convert_stats(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, FILE *report, struct relm3u_stats *stats)
+{
+char m3ufilepath[PATHMAX];
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+int done = 0;
+if (strlen(m3upath) < PATHMAX)
+    {
+        sprintf(m3ufilepath, "%s", m3upath);
+        if (linejobs < 1)       { linejobs = 1; }
+        if (linejobs > MAXJOBS) { linejobs = MAXJOBS; }
+        #ifdef UNIXES
+        if (ctx->state != NULL) { done = convert_playlist_incremental(ctx, m3ufilepath, (serious != 0), report, &ps); }
+        else
+        #endif
+        done = convert_playlist_to_relative(ctx, m3ufilepath, (serious != 0), linejobs, report, NULL, NULL, &ps);
+    }
+if (done)   { ps.playlists = 1; }
+else        { ps.failed = 1; }
+stats_merge(ctx, &ps);
+if (stats != NULL) { *stats = ps; }
+return(done);
+}
+
+int relm3u_convert_buffer(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, char **report, size_t *reportlen, struct relm3u_stats *stats)
+{
+*report = NULL;
+*reportlen = 0;
+#ifdef UNIXES
+FILE *out = open_memstream(report, reportlen);
+if (out == NULL) { return(0); }
+int done = relm3u_convert_stats(ctx, m3upath, serious, linejobs, out, stats);
+if (fclose(out) != 0) { free(*report); *report = NULL; *reportlen = 0; }
+#else
+// no memory streams here, go through a temporary file
+FILE *out = tmpfile();
+if (out == NULL) { return(0); }
+int done = relm3u_convert_stats(ctx, m3upath, serious, linejobs, out, stats);
+long len = ftell(out);
+if (len >= 0)   { *report = malloc(len + 1); }
+if (*report != NULL)
+    {
+        rewind(out);
+        *reportlen = fread(*report, 1, len, out);
+        (*report)[*reportlen] = 0;
+    }
+fclose(out);
+#endif
+return(done);
+}
+
+int relm3u_convert_entries(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, FILE *report, struct relm3u_entry **entries, int *nentries, struct relm3u_stats *stats)
+{   // the records and their paths are handed over in one block
+char m3ufilepath[PATHMAX];
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+struct entrylog log;
+memset(&log, 0, sizeof(log));
+*entries = NULL;
+*nentries = 0;
+int done = 0;
+int usable = (strlen(m3upath) < PATHMAX);
+#ifdef UNIXES
+// a playlist skipped as unchanged would have no records to deliver
+if (ctx->state != NULL) { fputs("NOT AVAILABLE IN INCREMENTAL MODE.\n", report); usable = 0; }
+#endif
+if (usable)
+    {
+        sprintf(m3ufilepath, "%s", m3upath);
+        if (linejobs < 1)       { linejobs = 1; }
+        if (linejobs > MAXJOBS) { linejobs = MAXJOBS; }
+        done = convert_playlist_to_relative(ctx, m3ufilepath, (serious != 0), linejobs, report, NULL, &log, &ps);
+    }
+if (done)   { ps.playlists = 1; }
+else        { ps.failed = 1; }
+stats_merge(ctx, &ps);
+if (stats != NULL) { *stats = ps; }
+
+int n = log.recs.used / sizeof(struct entryrec);
+if (!log.recs.failed && !log.names.failed)
+    {
+        *entries = malloc(n * sizeof(struct relm3u_entry) + log.names.used + 1);
+    }
+if (*entries != NULL)
+    {
+        *nentries = n;
+        char *names = (char *)(*entries + n);
+        if (log.names.used > 0) { memcpy(names, log.names.data, log.names.used); }
+        struct entryrec *recs = (struct entryrec *)log.recs.data;
+        int i = 0;
+        for (i = 0; i < n; i++)
+            {
+                (*entries)[i] = recs[i].entry;
+                (*entries)[i].path = names + recs[i].name;
+                (*entries)[i].also_in = (recs[i].also != (size_t)-1) ? names + recs[i].also : NULL;
+            }
+    }
+free(log.recs.data);
+free(log.names.data);
+return(done);
+}
+
+int relm3u_generate(relm3u_ctx *ctx, const char *folder, int all, int serious, FILE *report, struct relm3u_stats *stats)
+{
+char folderpath[PATHMAX];
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+int made = -1;
+#ifdef UNIXES
+if (strlen(folder) < PATHMAX)
+    {
+        sprintf(folderpath, "%s", folder);
+        made = generate_playlists(ctx, folderpath, (all != 0), (serious != 0), report, &ps);
+    }
+#else
+(void)folderpath;
+(void)all;
+(void)serious;
+fputs("NOT AVAILABLE ON THIS SYSTEM.\n", report);
+#endif
+if (made > 0) { ps.playlists = made; }
+stats_merge(ctx, &ps);
+if (stats != NULL) { *stats = ps; }
+return(made);
+}
+
+int relm3u_tags(relm3u_ctx *ctx, const char **paths, int n, struct relm3u_tags *tags)
+{
+struct relm3u_stats ps;
+memset(&ps, 0, sizeof(ps));
+int nread = 0;
+if (n <= 0) { return(0); }
+memset(tags, 0, (size_t)n * sizeof(struct relm3u_tags));
+#ifdef UNIXES
+nread = tags_of_files(ctx, paths, n, tags, &ps);
+#else
+(void)paths;
+#endif
+stats_merge(ctx, &ps);
+return(nread);
+}
+
+int relm3u_set_radius(relm3u_ctx *ctx, int radius)
+{
+if ((radius < 0) || (radius > RELM3U_MAXRADIUS)) { return(0); }
+ctx->radius = radius;
+return(1);
+}
+
+int relm3u_set_library(relm3u_ctx *ctx, const char *folder)
+{
+#ifdef UNIXES
+char canonpath[PATHMAX];
+if ((strlen(folder) >= PATHMAX) || (realpath(folder, canonpath) == NULL)) { return(0); }
+pthread_rwlock_wrlock(&ctx->indexlock);
+sprintf(ctx->library, "%s", canonpath);
+// only the index of the library tree is written from now on
+int i = 0;
+for (i = 0; i < ctx->nroots; i++)
+    {   ctx->roots[i]->persist = (ctx->flags & RELM3U_PERSIST_INDEX) && libindex_islibrary(ctx, ctx->roots[i]);  }
+pthread_rwlock_unlock(&ctx->indexlock);
+return(1);
+#else
+(void)ctx;
+(void)folder;
+return(0);
+#endif
+}
+
+int relm3u_add_snapshot(relm3u_ctx *ctx, const char *folder)
+{
+#ifdef UNIXES
+if ((ctx->nsnapshots == FPMAXSNAPSHOTS) || (strlen(folder) >= PATHMAX)) { return(0); }
+char *copy = strdup(folder);
+if (copy == NULL) { return(0); }
+// a trailing slash would double with the entry's path
+size_t len = strlen(copy);
+while ((len > 1) && (copy[len - 1] == '/')) { copy[--len] = 0; }
+ctx->snapshots[ctx->nsnapshots++] = copy;
+return(1);
+#else
+(void)ctx;
+(void)folder;
+return(0);
+#endif
+}
+
+void relm3u_free(void *p)
+{
+free(p);
+return;
+}
+
+void relm3u_get_stats(relm3u_ctx *ctx, struct relm3u_stats *stats)
+{
+#ifdef UNIXES
+pthread_mutex_lock(&ctx->statslock);
+#endif
+*stats = ctx->stats;
+#ifdef UNIXES
+pthread_mutex_unlock(&ctx->statslock);
+#endif
+return;
+}
+
+relm3u_iter *relm3u_find_open(const char *startpath, int recurse)
+{   // the iterator is delivered even when the start folder cannot be read,
+    // it just finds nothing then
+char pathstr[PATHMAX];
+if (strlen(startpath) >= PATHMAX) { return(NULL); }
+sprintf(pathstr, "%s", startpath);
+relm3u_iter *it = calloc(1, sizeof(relm3u_iter));
+if (it == NULL) { return(NULL); }
+m3uiter_open(it, pathstr, recurse);
+return(it);
+}
+
+int relm3u_find_next(relm3u_iter *it, char *path, size_t pathsize)
+{   // paths longer than the host buffer are passed over
+char pathstr[PATHMAX];
+while (m3uiter_next(it, pathstr))
+    {
+        if (strlen(pathstr) >= pathsize) { continue; }
+        memcpy(path, pathstr, strlen(pathstr) + 1);
+        return(1);
+    }
+if (pathsize > 0) { path[0] = 0; }
+return(0);
+}
+
+void relm3u_find_close(relm3u_iter *it)
+{
+if (it == NULL) { return; }
+m3uiter_close(it);
+free(it);
+return;
+}
+
+int relm3u_watch(relm3u_ctx *ctx, const char *root, int serious, FILE *report, volatile int *stop)
+{
+#ifdef __linux__
+char rootpath[PATHMAX];
+if (realpath(root, rootpath) == NULL) { fputs("FOLDER DOES NOT EXIST.\n", report); return(0); }
+return(watch_tree(ctx, rootpath, (serious != 0), report, stop));
+#else
+(void)ctx; (void)root; (void)serious; (void)stop;
+fputs("WATCH MODE NEEDS LINUX.\n", report);
+return(0);
+#endif
+}
+
+int relm3u_serve(relm3u_ctx *ctx, const char *sockpath, int njobs, FILE *report, volatile int *stop)
+{
+#ifdef UNIXES
+if (njobs < 1)          { njobs = 1; }
+if (njobs > MAXJOBS)    { njobs = MAXJOBS; }
+return(serve_socket(ctx, sockpath, njobs, report, stop));
+#else
+(void)ctx; (void)sockpath; (void)njobs; (void)stop;
+fputs("SERVER MODE NEEDS A UNIX SYSTEM.\n", report);
+return(0);
+#endif
+}
+
+int relm3u_state_open(relm3u_ctx *ctx, const char *statepath)
+{
+#ifdef UNIXES
+if (strlen(statepath) >= PATHMAX) { return(0); }
+struct runstate *st = calloc(1, sizeof(struct runstate));
+if (st == NULL) { return(0); }
+sprintf(st->path, "%s", statepath);
+st->runstart = time(NULL);
+if (!state_load(st)) { state_free(st); return(0); }
+pthread_mutex_lock(&ctx->statelock);
+state_free(ctx->state);
+ctx->state = st;
+pthread_mutex_unlock(&ctx->statelock);
+return(1);
+#else
+(void)ctx; (void)statepath;
+return(0);
+#endif
+}
+
+int relm3u_state_save(relm3u_ctx *ctx)
+{
+#ifdef UNIXES
+pthread_mutex_lock(&ctx->statelock);
+int done = (ctx->state != NULL) && state_save(ctx->state);
+pthread_mutex_unlock(&ctx->statelock);
+return(done);
+#else
+(void)ctx;
+return(0);
+#endif
+}
@@ -0,0 +1,225 @@
+// -----------------------------------------------------------------------------
+// L I B R E L M 3 U
+// Playlist conversion of relm3u as a library for embedding into other tools
+// (C) 2020-2024 Julien Thomas
+//
+// THIS IS OPEN SOURCE FREEWARE, NO WARRANTIES, NO RESTRICTIONS
+//
+// -----------------------------------------------------------------------------
+//
+// All state lives in a context object, there are no globals and no function
+// statics. A context may be shared by several threads of the host process, and
+// several contexts may run side by side.
+//
+// Build as shared library (Unix):
+//   gcc -O2 -fPIC -shared -fvisibility=hidden -pthread -o librelm3u.so librelm3u.c
+//
+// Use from Python via ctypes:
+//   lib = ctypes.CDLL("./librelm3u.so")
+//   lib.relm3u_open.restype = ctypes.c_void_p
+//   ctx = lib.relm3u_open(b"/music", 0)
+//   ...
+//   lib.relm3u_close(ctypes.c_void_p(ctx))
+//
+// -----------------------------------------------------------------------------
+
+#ifndef LIBRELM3U_H
+#define LIBRELM3U_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#if defined(__GNUC__) && !defined(_WIN32)
+    #define RELM3U_API __attribute__((visibility("default")))
+#else
+    #define RELM3U_API
+#endif
+
+#define RELM3U_MAXJOBS        256   // worker threads per call or host pool
+#define RELM3U_PERSIST_INDEX  1     // flag: keep '.relm3u.idx' files on disk
+#define RELM3U_FINGERPRINT    2     // flag: find renamed files by content (Unix)
+#define RELM3U_DUPES         4     // flag: report entries of the same file
+#define RELM3U_DEDUPE        8     // flag: as RELM3U_DUPES, rewritten playlists lose repeats
+#define RELM3U_EXTINF        16    // flag: entries without #EXTINF line get one from tags (Unix)
+#define RELM3U_MAXSNAPSHOTS  8     // snapshot folders per context
+#define RELM3U_STATLEVELS     8     // probe levels counted apart, the last takes the rest
+#define RELM3U_RADIUS         2     // folders above the playlist folder searched by default
+#define RELM3U_MAXRADIUS      7     // at most
+#define RELM3U_TAGTEXT        256   // bytes kept of a tag text field
+
+typedef struct relm3u_ctx relm3u_ctx;
+typedef struct m3uiter relm3u_iter;
+
+struct relm3u_tags
+{   // tag fields of a music file
+    char album[RELM3U_TAGTEXT];     // "" when missing
+    char title[RELM3U_TAGTEXT];
+    char artist[RELM3U_TAGTEXT];
+    int track;                      // 0 when missing
+    int year;
+    int duration_ms;                // 0 when unknown
+    int tagged;                     // (1) when the file has a tag
+};
+
+struct relm3u_entry
+{   // outcome of one playlist entry, see relm3u_convert_entries()
+    int line;                       // line number in the playlist, from 1
+    int method;                     // search method 1, 2 or 3 (content), 0 when not found
+    int ambiguous;                  // other files matched as well (method 2)
+    int dropped;                    // left out of the new playlist as a repeat
+    int duplicate_of;               // with RELM3U_DUPES: line of the same file met
+                                    // before in this playlist, 0 when none
+    const char *also_in;            // with RELM3U_DUPES: playlist converted before
+    int also_line;                  // holding the same file, and its line; NULL, 0
+    const char *path;               // path found, relative to the playlist, or the
+                                    // entry as normalised when not found
+};
+
+struct relm3u_stats
+{   // running totals of a context, or the counters of one playlist
+    long long playlists;        // playlists converted
+    long long failed;           // playlists that could not be converted
+    long long entries;          // playlist entries looked at
+    long long found_probe;      // entries found by search method 1 (probing)
+    long long found_search;     // entries found by search method 2 (search)
+    long long found_content;    // entries found by search method 3 (content fingerprint)
+    long long missing;          // entries not found at all
+    long long probes[RELM3U_STATLEVELS];        // paths probed per updir level
+    long long probe_hits[RELM3U_STATLEVELS];    // of them found
+    long long probe_batches;    // sets of probes submitted at once (io_uring)
+    long long searches;         // filename searches of search method 2
+    long long search_hits;      // of them found
+    long long key_hits;         // of them found by normalised filename key only
+    long long ties;             // of them found among equally good candidates
+    long long fingerprints;     // files read for their content fingerprint
+    long long duplicates;       // entries of a file met before in the same playlist
+    long long duplicates_across;    // entries of a file met before in another playlist
+    long long duplicates_dropped;   // repeats left out of rewritten playlists
+    long long tags_read;        // music files whose tags were read
+    long long tags_cached;      // music files whose tags came from the tag cache
+    long long spawns;           // processes started ('find', 'dir')
+    long long bytes_read;       // playlist bytes read
+    long long bytes_written;    // playlist and back-up bytes written
+    long long probe_ns;         // wall time probing, summed over threads
+    long long search_ns;        // wall time searching, index building included
+    long long write_ns;         // wall time writing playlists and back-ups
+};
+
+// open a context; libroot (or NULL) names the music library tree, as
+// relm3u_set_library() does, and is indexed right away.
+// flags are RELM3U_PERSIST_INDEX, RELM3U_FINGERPRINT, RELM3U_DUPES,
+// RELM3U_DEDUPE, RELM3U_EXTINF or 0; duplicates are looked for across all
+// playlists converted on the context (not by relm3u_watch())
+// return NULL when libroot cannot be read or memory is short
+RELM3U_API relm3u_ctx *relm3u_open(const char *libroot, int flags);
+
+// release a context and everything it holds
+RELM3U_API void relm3u_close(relm3u_ctx *ctx);
+
+// resolve one playlist entry for the playlist at m3upath; *ambiguous (unless
+// NULL) is set to (1) when other files matched as well (the nearest is taken)
+// return (1), (2) or (3) when found by search method 1, 2 or 3 (content
+// fingerprint), the method numbers of the report, result = relative path
+// return (0) when not found, result = normalised path
+// return (-1) when the entry is no candidate (empty line, #EXT tag)
+RELM3U_API int relm3u_resolve(relm3u_ctx *ctx, const char *m3upath, const char *entry, char *result, size_t resultsize, int *ambiguous);
+
+// convert one playlist, lines are resolved on linejobs threads, the report
+// as printed by relm3u goes to the report stream; '#' lines are kept with the
+// entry that follows them, an entry left out takes them along
+// serious = (1) rewrites the playlist after making a numbered back-up
+// return (1) on success, (0) on failure
+RELM3U_API int relm3u_convert(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, FILE *report);
+
+// same as relm3u_convert(), stats receives the counters of this playlist alone
+// (the running totals of the context grow by them as well)
+RELM3U_API int relm3u_convert_stats(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, FILE *report, struct relm3u_stats *stats);
+
+// same as relm3u_convert_stats(), but the report is delivered in a buffer
+// allocated by the library, release with relm3u_free(); stats may be NULL
+RELM3U_API int relm3u_convert_buffer(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, char **report, size_t *reportlen, struct relm3u_stats *stats);
+
+// same as relm3u_convert_stats(), the outcome of each entry is delivered in
+// playlist order as *nentries records in one block *entries allocated by the
+// library, release with relm3u_free(); *entries is NULL when memory was short;
+// fails on a context with the state of relm3u_state_open(), since a playlist
+// skipped as unchanged has no records; stats may be NULL
+RELM3U_API int relm3u_convert_entries(relm3u_ctx *ctx, const char *m3upath, int serious, int linejobs, FILE *report, struct relm3u_entry **entries, int *nentries, struct relm3u_stats *stats);
+
+RELM3U_API void relm3u_free(void *p);
+
+// name a folder holding an old copy of the library (backup, snapshot) where
+// search method 3 looks for the original of an entry not found otherwise
+// (Unix, with RELM3U_FINGERPRINT); return (0) when there are too many
+RELM3U_API int relm3u_add_snapshot(relm3u_ctx *ctx, const char *folder);
+
+// set how many folders above the playlist folder are searched, nearest first
+// (0 .. RELM3U_MAXRADIUS, RELM3U_RADIUS by default); search method 2 indexes
+// the library tree and, of the search folders above it, the tree below the
+// topmost of them as deep as searched; a larger radius indexes more
+// return (0) when radius is out of range (left as it is then)
+RELM3U_API int relm3u_set_radius(relm3u_ctx *ctx, int radius);
+
+// name the music library tree (Unix only): search method 2 indexes it as a
+// whole, and with RELM3U_PERSIST_INDEX the index, fingerprint and tag files
+// are written at its top and nowhere else; without a library tree nothing is
+// written; return (0) when folder cannot be read
+RELM3U_API int relm3u_set_library(relm3u_ctx *ctx, const char *folder);
+
+// generate playlists from the tags of music files (Unix only), as
+// autogen_playlists.py does: one playlist '!_<folder>.m3u8' per music folder
+// below folder (all = 1) or for folder itself (all = 0), in the folder
+// 'playlists' beside the music folders; the .mp3 and .m4a files below a music
+// folder are sorted by year, album and track number; serious = (1) writes them
+// (an existing playlist is backed up first), the report goes to the report
+// stream; stats may be NULL
+// return the number of playlists generated, (-1) when folder cannot be read
+RELM3U_API int relm3u_generate(relm3u_ctx *ctx, const char *folder, int all, int serious, FILE *report, struct relm3u_stats *stats);
+
+// tag fields of n music files (.mp3, .m4a) at once (Unix only); with
+// RELM3U_PERSIST_INDEX they are cached in '.relm3u.tags' at the top of the
+// library tree holding the file, and only files changed since are read again
+// return the number of files whose tags were read from the file
+RELM3U_API int relm3u_tags(relm3u_ctx *ctx, const char **paths, int n, struct relm3u_tags *tags);
+
+// deliver the running totals of a context
+RELM3U_API void relm3u_get_stats(relm3u_ctx *ctx, struct relm3u_stats *stats);
+
+// incremental conversion (Unix only): relm3u_convert() then consults a state
+// file of the last run, skips playlists unchanged since and resolves again only
+// entries whose folders changed; in serious mode a playlist is only rewritten
+// (with back-up) when its content changes
+// open: load the state file, a missing file is fine; return (0) on failure
+// save: write the state file back; return (0) on failure
+RELM3U_API int relm3u_state_open(relm3u_ctx *ctx, const char *statepath);
+RELM3U_API int relm3u_state_save(relm3u_ctx *ctx);
+
+// keep the playlists below root valid while files are moved (Linux only):
+// resolves every playlist once, then converts again only the playlists that
+// refer to files or folders moved or deleted, as they are reported by inotify
+// return (1) when *stop became non-zero (checked once a second), (0) on failure
+RELM3U_API int relm3u_watch(relm3u_ctx *ctx, const char *root, int serious, FILE *report, volatile int *stop);
+
+// answer requests on the Unix domain socket sockpath (Unix only), on njobs
+// connections at a time, keeping indexes and caches of ctx warm in between;
+// requests are lines of tab-separated fields, answered in order:
+//   RESOLVE <playlist path> <entry>    ->  OK <method> <ambiguous> <resolved entry>
+//     method as relm3u_resolve() returns it, ambiguous 1 or 0
+//   CONVERT <playlist path> <length>   ->  OK <found> <total> <length>
+//     followed by the playlist bytes       followed by the converted playlist
+//   REFRESH                            ->  OK (indexes brought up to date)
+// failures are answered by ERR <reason>; CONVERT writes nothing, converting
+// as serious mode would; the host should ignore SIGPIPE where MSG_NOSIGNAL
+// is missing
+// return (1) when *stop became non-zero (checked once a second), (0) on failure
+RELM3U_API int relm3u_serve(relm3u_ctx *ctx, const char *sockpath, int njobs, FILE *report, volatile int *stop);
+
+// playlist discovery: recurse = (1) finds *.m3u and *.m3u8 in the whole tree
+// below startpath, recurse = (0) finds the files matching the filename part of
+// startpath in its folder; next delivers one path per call and returns (0)
+// when there are no more
+RELM3U_API relm3u_iter *relm3u_find_open(const char *startpath, int recurse);
+RELM3U_API int relm3u_find_next(relm3u_iter *it, char *path, size_t pathsize);
+RELM3U_API void relm3u_find_close(relm3u_iter *it);
+
+#endif
@@ -0,0 +1,98 @@
+import argparse
+import unicodedata
+
+# Generates unikey.h, the tables behind the normalised filename keys of
+# librelm3u (see unikey_make() there).
+#
+# A key is the filename case-folded (full Unicode case folding, as str.casefold),
+# canonically decomposed and with runs of whitespace and separator punctuation
+# turned into one space. Canonical decomposition is taken instead of NFC since
+# two names are equal in NFC exactly when they are equal in NFD, and NFD needs
+# no composition step.
+#
+# Per code point the table holds NFD(casefold(NFD(c))), a single space for
+# separators and nothing for apostrophes, which are dropped. Code points mapped
+# to themselves and Hangul syllables (decomposed arithmetically) are left out.
+# Combining classes are kept as ranges for the canonical ordering of marks.
+
+SEPARATORS = set("\t\n\v\f\r _-.,;:()[]{}")
+APOSTROPHES = set("'`´‘’ʼ")
+
+def is_separator(c):
+    if(c in SEPARATORS):
+        return True
+    if(ord(c) < 128):
+        return False
+    return unicodedata.category(c) in ("Zs", "Zl", "Zp", "Pd", "Ps", "Pe")
+
+def is_hangul_syllable(cp):
+    return 0xAC00 <= cp <= 0xD7A3
+
+def key_of(c):
+    if(is_separator(c)):
+        return " "
+    if(c in APOSTROPHES):
+        return ""
+    k = unicodedata.normalize("NFD", unicodedata.normalize("NFD", c).casefold())
+    # a mapping may end up in ASCII punctuation itself (U+037E to ';')
+    return "".join(" " if is_separator(x) else x for x in k if x not in APOSTROPHES)
+
+def c_array(ctype, name, values, per_line=8, fmt="0x%04X"):
+    lines = [f"static const {ctype} {name}[{len(values)}] =", "{"]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+def main():
+    parser = argparse.ArgumentParser(prog="mkunikey.py",
+        description="Generate the normalised filename key tables of librelm3u.")
+    parser.add_argument("-o", "--output", help="Header to write.", type=str, default="unikey.h")
+    args = parser.parse_args()
+
+    ascii_map = []
+    cps = []
+    ofs = [0]
+    seq = []
+    for cp in range(0x110000):
+        if(0xD800 <= cp <= 0xDFFF or is_hangul_syllable(cp)):
+            continue
+        c = chr(cp)
+        k = key_of(c)
+        if(cp < 128):
+            # 0 drops the character, separators become a space
+            ascii_map.append(ord(k) if k else 0)
+            continue
+        if(k == c):
+            continue
+        cps.append(cp)
+        seq.extend(ord(x) for x in k)
+        ofs.append(len(seq))
+
+    ccc = []
+    start = None
+    for cp in range(0x110001):
+        cls = unicodedata.combining(chr(cp)) if cp < 0x110000 else 0
+        if(start is not None and (cls != ccc_cls or cp == 0x110000)):
+            ccc.append((start, cp - 1, ccc_cls))
+            start = None
+        if(start is None and cls != 0):
+            start, ccc_cls = cp, cls
+
+    with open(args.output, "w", encoding="ascii") as f:
+        f.write("// generated by mkunikey.py from Unicode %s, do not edit\n" % unicodedata.unidata_version)
+        f.write("// normalised filename keys: case folding, canonical decomposition, separators\n\n")
+        f.write("#define UNIKEY_UNICODE  \"%s\"\n" % unicodedata.unidata_version)
+        f.write("#define UNIKEY_MAXSEQ   %d     // longest mapping of one code point\n\n"
+                % max(ofs[i + 1] - ofs[i] for i in range(len(cps))))
+        f.write("// ASCII: folded character, ' ' for separators, 0 to drop\n")
+        f.write(c_array("unsigned char", "unikey_ascii", ascii_map, 16, "%3d") + "\n\n")
+        f.write("// code points with a mapping, ascending; mapping i is unikey_seq[unikey_ofs[i] .. unikey_ofs[i+1]]\n")
+        f.write(c_array("uint32_t", "unikey_cps", cps) + "\n\n")
+        f.write(c_array("uint16_t", "unikey_ofs", ofs, 12, "%5d") + "\n\n")
+        f.write(c_array("uint32_t", "unikey_seq", seq) + "\n\n")
+        f.write("// canonical combining classes other than 0: first, last code point, class\n")
+        f.write(c_array("uint32_t", "unikey_ccc", [v for r in ccc for v in r], 9, "0x%05X") + "\n")
+
+if __name__ == "__main__":
+    main()
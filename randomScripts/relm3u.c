@@ -23,886 +23,399 @@
 // 20210607 Added support for .m3u8 files in the recursive search
 // 20230320 Hardened protocol/path filtering for references to mixed paths
 // 20231220 Fixed some details on filenpaths, quoting rules on Linux console
+// 20261017 Unix: in-process filename index replaces one 'find' per lookup
+// 20261017 Unix: filename index persisted as '.relm3u.idx' in the submitted directory, mtime-validated
+// 20261017 Unix: option '-j N' converts playlists on N worker threads
+// 20261017 Unix: lines of a single playlist resolved in parallel, in order
+// 20261017 Unix: probing via folder handles, missing folders remembered
+// 20261017 Unix: native playlist discovery, no depth limit, streamed to '-j'
+// 20261017 Conversion moved into librelm3u, relm3u is a thin command line tool
+// 20261017 Linux: option '--watch' keeps playlists valid as files are moved
+// 20261017 Unix: option '--incremental' skips playlists unchanged since last run
+// 20261017 Playlists read in one piece (mmap), written at once, lines of any length
+// 20261017 Line normalisation on SSE2/AVX2 string kernels, chosen at run time
+// 20261017 Benchmarks: 'make bench' runs bench/ on a fabricated library
+// 20261017 Option '--stats=json': counters of each resolution stage to stderr
+// 20261017 Unix: filenames also matched by normalised key (case, Unicode form, separators)
+// 20261017 Unix: of several files found, the one sharing most of the entry's path wins
+// 20261017 Unix: library index keeps folder names once and front-codes filenames
+// 20261017 Unix: options '--fingerprint', '--snapshot=DIR' find renamed files by content
+// 20261017 options '--dupes', '--dedupe' report and drop entries of the same file
+// 20261017 Unix: option '--generate' makes playlists from ID3v2/MP4 tags (autogen_playlists.py)
+// 20261017 Unix: tags cached per inode and mtime in '.relm3u.tags', only changed files are read
+// 20261017 #EXTINF and other '#' lines are kept with their entries; Unix: option '--extinf'
+// 20261017 lines probed in batches, on Linux all candidates of a batch go to io_uring at once
+// 20261017 option '--radius=N': number of folders above the playlist folder searched
+// 20261017 Unix: option '--serve=SOCK' answers resolve/convert requests on a socket, index kept warm
+// 20261017 option '--batch': playlist paths from stdin, one JSON line of results per playlist
 //
 // -----------------------------------------------------------------------------
 //
+#define _GNU_SOURCE
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "librelm3u.h"
+
+// build together with the library:
+//   gcc -O2 -pthread -o relm3u relm3u.c librelm3u.c
 
 #define PATHMAX  4096
+#define MAXJOBS  RELM3U_MAXJOBS     // worker threads for '-j'
+#define SERVEJOBS  4                // connections served at a time without '-j'
 
 // detect unix-based systems and define symbol UNIXES for briefness
 #if defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
 #define UNIXES
 #endif
 
-#ifdef _WIN32
-    #define SLASH "\\"
-#else
-    #define SLASH "/"
+#ifdef UNIXES
+#include <pthread.h>
+#include <signal.h>
 #endif
 
-// -----------------------------------------------------------------------------
-
-// these few string manipulation routines were taken from 'joystring' library
-
-int strlength(char *bstr)
-{   // find length of null-terminated char array
-    // return values from 0 to length (in byte characters)
-int i = 0;  while (*bstr++)    { i++ ; }
-return (i);
-}
-
-int strlefttrim (char *astr, char *cstr)
-{   // remove left part of astr that is identical to cstr
-// return(1) on trim success, otherwise (0)
-// abort if one of strings is null
-if (astr[0] == 0)   { return(0); }
-if (cstr[0] == 0)   { return(0); }
-int i = 0;
-int j = 0;
-// check up to where the strings are identical
-while (astr[i] == cstr[i])  { i++; }
-// abort when cstr was NOT fully identical with left from astr
-if (cstr[i] != 0)   { return(0); }
-// otherwise shift astr down by number of characters in cstr
-j = i;
-i = 0;
-while (astr[j]) { astr[i++] = astr[j++]; }
-astr[i] = 0;
-return (1);
-}
-
-int strleftcutident(char *astr, char *cstr)
-{   // remove only the identical part of astr and cstr
-if (astr[0] == 0)   { return(0); }
-if (cstr[0] == 0)   { return(0); }
-int i = 0;
-int j = 0;
-while ((astr[i] == cstr[i]) && (astr[i] != 0)) { i++; }
-// fast leave when astr is identical to cstr up to the end
-if (astr[i] == 0)   { astr[0] = 0; return(1); }
-// otherwise shift astr down by number of characters in cstr
-j = i;
-i = 0;
-while (astr[j] != 0) { astr[i++] = astr[j++]; }
-astr[i] = 0;
-return (1);
-}
-
-int strleftcomp(char *astr, char *cstr)
-{   // is cstr a left sided subset of astr ? (0/1)
-if (astr == NULL) { return(0); }
-if (cstr == NULL) { return(0); }
-while ((*astr != 0) && (*cstr != 0))
-    {   if (*astr != *cstr) { break; }
-        astr++; cstr++;
-    }
-if (*cstr == 0)     { return(1); }
-return(0);
-}
-
-int strcomp(char *astr, char *bstr)
-{   // compare strings, return (1) when identical, return (0) when different
-while ((*astr != 0) && (*bstr != 0))
-    {   if (*astr != *bstr) { break; }
-        astr++; bstr++;
-    }
-if ((*astr == 0) && (*bstr == 0)) { return(1); }
-return(0);
-}
+volatile int stopwatch = 0;    // set by SIGINT/SIGTERM in watch and server mode
 
-int strfindchr(char *sourcestr, char searchchr)
-{   // check for a single search character to exist within the source string
-    // return (1) when found
-    // return (0) when not found or search character was NULL
-if (sourcestr[0] == 0)  { return (0); }
-while (*sourcestr)  { if (*sourcestr++ == searchchr) { return(1); } }
-return(0);
+#ifdef UNIXES
+void on_stop_signal(int sig)
+{
+(void)sig;
+stopwatch = 1;
+return;
 }
+#endif
 
-int strrightcomp(char *astr, char *cstr)
+int endswith(char *astr, char *cstr)
 {   // is cstr a right sided subset of astr ?
-int i = 0; while (astr[i] != 0) { i++; }
-int j = 0; while (cstr[j] != 0) { j++; }
-if (j > i)  { return(0); }
-while (j > 0)  {   i-- ; j-- ;  if (astr[i] != cstr[j])  { return(0); }    }
-return (1);
-}
-
-int strfindstr(char *sourcestr, char *searchstr)
-{   // find first occurrence of search string within source string
-    // and return direct index
-    // or return (-1) if not found
-if (sourcestr[0] == 0)  { return (-1); }
-if (searchstr[0] == 0)  { return (-1); }
-int i = 0;
-int j = 0;
-while ( sourcestr[i] != 0)
-    {
-        j = 0;
-        while ( (unsigned)searchstr[j] == (unsigned)sourcestr[i+j])
-            {
-                j++;
-                if (searchstr[j] == 0)     // found whole part str!
-                    { return(i);  }
-            }
-    i++;
-    }
-return(-1);
-}
-
-void strlinetrim(char *astr)
-{   // trim linestring from leading and trailing controls and whitespaces
-int i = 0;
-int j = 0;
-
-// skip non-ascii characters (e.g. Unicode BOM or code points)
-while (((unsigned char)astr[i] > 127) && (astr[i] != 0))  { i++; }
-
-// left trim
-while (((unsigned char)astr[i] < 33) && (astr[i] != 0))  { i++; }
-j = i;
-i = 0;
-while (astr[j] != 0)
-    {  astr[i++] = astr[j++]; }
-astr[i] = 0;
-// right trim
-i = 0; while (astr[i]) { i++ ; }
-while ((i > 0) && ((unsigned char)astr[i] < 33))
-    {   astr[i] = 0; i--; }
-
-return;
+size_t i = strlen(astr);
+size_t j = strlen(cstr);
+return((j <= i) && (strcmp(astr + i - j, cstr) == 0));
 }
 
-int strappendsafe(char *targetstr, int targetmax, char *appendstr)
-{   // append targetstr with appendstr up to length of targetmax
-int i = 0; while (targetstr[i] != 0) { i++; }
-int j = 0;
-while ((appendstr[j]) && (i < targetmax))  { targetstr[i++] = appendstr[j++]; }
-targetstr[i] = 0;
-if (i == targetmax) { return(0); }
-return(1);
+int is_serious_switch(char *arg)
+{   // the serious switch exactly, anything else ending in 's' is no switch
+return( (strcmp(arg, "-s") == 0) || (strcmp(arg, "s") == 0) ||
+        (strcmp(arg, "--serious") == 0) || (strcmp(arg, "serious") == 0) );
 }
 
 // -----------------------------------------------------------------------------
-
-int urltostring(char *astr)
-{   // convert 'percent-encoded' characters to ASCII/UTF-8 in the same string
-// These 'Reserved Characters' pursuant to RFC 3986 must be decoded
-// SPC  !   #   $   %   &   '   (   )   *   +   ,   /   :   ;   =   ?   @   [   ]
-// %20 %21 %23 %24 %25 %26 %27 %28 %29 %2A %2B %2C %2F %3A %3B %3D %3F %40 %5B %5D
+// STATISTICS
 //
-// fast hex-to-nibble conversion table
-static unsigned char const H2N [] =
-//  0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15
-  { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0, 	// 0..9
-    0,10,11,12,13,14,15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 	// A..F
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 	//
-    0,10,11,12,13,14,15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 	// a..f
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-
-int i = 0;
-int j = 0;
-unsigned char a = 0;
-while (astr[i] != 0)
-    {
-        if (astr[i] == '%')     // found 'percent-encoding'
-            {
-                // get byte value from two consecutive ascii hex digits
-                i++;
-                a =     H2N[ (unsigned char)astr[i] ]  << 4 ;   i++;
-                a = a + H2N[ (unsigned char)astr[i] ]  ;        i++;
-                astr[j++] = a;
-            }
-        else
-            {   astr[j++] = astr[i++]; }
-    }
-astr[j] = 0;
-return(1);
-}
-
-void backslashestoslashes(char *pathstring)
-{
-while (*pathstring != 0) { if (*pathstring == 92) { *pathstring = 47; } ; pathstring++; }
-return;
-}
-
-void slashestobackslashes(char *pathstring)
-{
-while (*pathstring != 0) { if (*pathstring == 47) { *pathstring = 92; } ; pathstring++; }
-return;
-}
+// With '--stats=json' the counters of each playlist and of the whole run are
+// written to stderr as JSON, one object per line, e.g. for dashboards:
+//   {"type":"playlist","path":"...","ok":true,"entries":12,...}
+//   {"type":"run","playlists":3,"failed":0,...,"discovery_ns":..,"wall_ns":..}
 
-int check_file_exist(char *filepath)
-{
-#ifdef _WIN32
-    slashestobackslashes(filepath);
-    FILE *fp = fopen(filepath, "rb");
-    backslashestoslashes(filepath);
-    if (fp == NULL)     { return(0) ; }
-    if (fclose(fp)!=0)  { return(0) ; }
+long long clock_ns(void)
+{   // monotonic wall clock in nanoseconds
+#ifdef UNIXES
+struct timespec ts;
+clock_gettime(CLOCK_MONOTONIC, &ts);
+return((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec);
 #else
-    FILE *fp = fopen(filepath, "rb");
-    if (fp == NULL)     { return(0) ; }
-    if (fclose(fp)!=0)  { return(0) ; }
+return((long long)clock() * (1000000000LL / CLOCKS_PER_SEC));
 #endif
-return(1);
 }
 
-int get_only_filepath(char *pathname, char *fullpath)
-{   // extract path only portion of a full path including last slash
-int i = 0;
-// copy fullpath[] to pathname[]
-while (fullpath[i] != 0) { pathname[i] = fullpath[i]; i++; }
-pathname[i] = 0;
-// find last pathseparator
-while (i > 0)
-    {   i--;
-        if ( (pathname[i] == 47) || (pathname[i] == 92)) { break; };
+void json_string(FILE *fp, char *str)
+{   // print str as JSON string, bytes beyond ASCII are passed as they are
+fputc('"', fp);
+while (*str != 0)
+    {
+        unsigned char c = (unsigned char)*str++;
+        if ((c == '"') || (c == 92))    { fputc(92, fp); fputc(c, fp); }
+        else if (c < 32)                { fprintf(fp, "\\u%04x", c); }
+        else                            { fputc(c, fp); }
     }
-// catch no-path condition, replace with current directory path
-if (i == 0)  {  pathname[0] = 0;    }   else    {   pathname[++i] = 0;  }
-return(1);
+fputc('"', fp);
+return;
 }
 
-int get_only_filename(char *filename, char *fullpath)
-{   // extract filename portion of fullpath string,
-    // regardless of slashes or backslashes
+void json_levels(FILE *fp, char *name, long long *counts)
+{   // print a counter per probe level as JSON array member
+fprintf(fp, ",\"%s\":[", name);
 int i = 0;
-int j = 0;
-// find to end of string
-while (fullpath[i] != 0) { i++; }
-// find last pathseparator
-while (i > 0)
-    {
-        i--;
-        if ( (fullpath[i] == 47) || (fullpath[i] == 92)) { break; };
-    }
-// catch no-path condition
-if (i > 0) { i++; }
-while (fullpath[i] != 0)    { filename[j++] = fullpath[i++]; }
-filename[j] = 0;
-return(1);
+for (i = 0; i < RELM3U_STATLEVELS; i++) { fprintf(fp, (i > 0) ? ",%lld" : "%lld", counts[i]); }
+fputc(']', fp);
+return;
 }
 
-int dir_get_recurse_m3u_filepaths(char *pathfilenamestr)
-{   // DIRECTORY-SEARCH OF ALL M3U FILES
-// initial call : submit starting path to search (root of collection)
-// return(1): deliver filename of any *.m3u found in pathfilenamestr
-// return(0): no further filename to deliver, pathfilenamestr = nil
-//
-static FILE *fp;
-static int ictr = 0;
-
-// initial invoke triggers piped directory command
-if (ictr == 0)
+void print_stats_json(FILE *fp, char *path, int done, struct relm3u_stats *st, long long discovery_ns, long long wall_ns)
+{   // one JSON line: a playlist when path is given, the whole run otherwise
+if (path != NULL)
     {
-        char cmdstr[PATHMAX] = "";
-
-        #ifdef _WIN32
-
-            slashestobackslashes(pathfilenamestr);
-            sprintf (cmdstr, "dir /B /S /ON \"%s*.m3u?\" 2>&1", pathfilenamestr);
-
-        #else
-
-            // launch 'find' with search patterns of *.m3u and *.m3u8,
-
-            if (strfindchr(pathfilenamestr, 39))
-                {
-                    sprintf (cmdstr, "find \"%s\" -maxdepth 5 -iname \"*.m3u\" -o -iname \"*.m3u8\" 2>&1",  pathfilenamestr);
-                }
-            else
-                {
-                    sprintf (cmdstr, "find '%s' -maxdepth 5 -iname '*.m3u' -o -iname '*.m3u8' 2>&1",  pathfilenamestr);
-                }
-
-            //~ sprintf (cmdstr, "find \"%s\" -maxdepth 5 -iname \"*.m3u\" -o -iname \"*.m3u8\" 2>&1",  pathfilenamestr);
-            // which results in the command:
-            // find "[PATH]" -maxdepth 5 -iname "*.m3u" -o -iname "*.m3u8"
-            // find '[PATH]' -maxdepth 5 -iname '*.m3u' -o -iname '*.m3u8'
-
-        #endif
-
-        // puts(cmdstr);
-
-        fp = popen(cmdstr, "r"); if (fp == NULL) { fclose(fp); return(0); }
-
-        puts("");
-    }
-
-// deliver path of file found matching
-ictr = 1 ;
-if (fgets(pathfilenamestr, PATHMAX, fp) != NULL)
-    {
-        strlinetrim(pathfilenamestr);
-        backslashestoslashes(pathfilenamestr);
-
-        #ifdef _WIN32
-        // catch general error in absence of absolute path indicators
-        if (strfindchr(pathfilenamestr,'/') == 0)   { pathfilenamestr[0] = 0; ictr = 0; return(0); }
-        if (strfindchr(pathfilenamestr,':') == 0)   { pathfilenamestr[0] = 0; ictr = 0; return(0); }
-        #endif
-
-        #ifdef UNIXES
-        // Unix: catch general errors
-        if (strleftcomp(pathfilenamestr, "find:"))  { pathfilenamestr[0] = 0; ictr = 0; return(0); }
-        if (strfindchr(pathfilenamestr, ':') != 0)  { pathfilenamestr[0] = 0; ictr = 0; return(0); }
-        #endif
-
-        // trim control characters from line string
-        if (pathfilenamestr[0] == 0)    { ictr = 0; return(0); }
-
-        // return TRUE and deliver this line anyway with forward slashes
-        return(1);
+        fputs("{\"type\":\"playlist\",\"path\":", fp);
+        json_string(fp, path);
+        fprintf(fp, ",\"ok\":%s", done ? "true" : "false");
     }
 else
-    {   pclose(fp);   }
-ictr = 0;
-return(0);     // no more entries, finito
+    {   fprintf(fp, "{\"type\":\"run\",\"playlists\":%lld,\"failed\":%lld", st->playlists, st->failed);   }
+fprintf(fp, ",\"entries\":%lld,\"found_probe\":%lld,\"found_search\":%lld,\"found_content\":%lld,\"missing\":%lld",
+        st->entries, st->found_probe, st->found_search, st->found_content, st->missing);
+json_levels(fp, "probes", st->probes);
+json_levels(fp, "probe_hits", st->probe_hits);
+fprintf(fp, ",\"probe_batches\":%lld", st->probe_batches);
+fprintf(fp, ",\"searches\":%lld,\"search_hits\":%lld,\"key_hits\":%lld,\"ties\":%lld,\"fingerprints\":%lld,\"spawns\":%lld",
+        st->searches, st->search_hits, st->key_hits, st->ties, st->fingerprints, st->spawns);
+fprintf(fp, ",\"duplicates\":%lld,\"duplicates_across\":%lld,\"duplicates_dropped\":%lld,\"tags_read\":%lld,\"tags_cached\":%lld",
+        st->duplicates, st->duplicates_across, st->duplicates_dropped, st->tags_read, st->tags_cached);
+fprintf(fp, ",\"bytes_read\":%lld,\"bytes_written\":%lld", st->bytes_read, st->bytes_written);
+fprintf(fp, ",\"probe_ns\":%lld,\"search_ns\":%lld,\"write_ns\":%lld", st->probe_ns, st->search_ns, st->write_ns);
+if (path == NULL)   { fprintf(fp, ",\"discovery_ns\":%lld,\"wall_ns\":%lld", discovery_ns, wall_ns); }
+fputs("}\n", fp);
+fflush(fp);
+return;
 }
 
-int dir_get_current_m3u_filepaths(char *pathfilenamestr)
-{   // DIRECTORY-SEARCH OF M3U FILES ON CURRENT DIRLEVEL ONLY
-// initial call : submit reference path to search within directory tree
-// further calls: deliver each filename with .m3u path and return(TRUE)
-// when no further file is found, deliver nil-string and return(FALSE)
-//
-// NOTE: Expects *pathfilenamestr to be generously dimensioned (4096 byte)
-// WARNING: pathfilenamestr must not be a string literal (segmentation fault)
-// since it is also used for return of found file names
+#ifdef UNIXES
+// -----------------------------------------------------------------------------
+// PARALLEL PLAYLIST CONVERSION (UNIX)
 //
-static FILE *fp;
-static int ictr = 0;
-
-
-if  (   (strrightcomp(pathfilenamestr, ".m3u") == 0) &&
-        (strrightcomp(pathfilenamestr, ".m3u8") == 0)      )
-    {
-        strappendsafe(pathfilenamestr, PATHMAX, SLASH);
-        strappendsafe(pathfilenamestr, PATHMAX, "*.m3u");
-    }
+// With '-j N' the playlists found are converted by N worker threads, which
+// keeps several NAS requests in flight at a time. The main thread keeps on
+// discovering and queues each playlist as soon as it is found, so conversion
+// starts before the search through a big tree is done. The report of a
+// playlist is collected in a library buffer and printed in one piece when the
+// playlist is done, so reports of concurrently converted playlists never
+// interleave.
+
+struct playlistnode
+{
+    struct playlistnode *next;
+    char path[];            // playlist path, as found
+};
 
-// initial invoke triggers piped directory command
-if (ictr == 0)
+struct playlistjobs
+{
+    relm3u_ctx *ctx;        // shared by all workers
+    struct playlistnode *head, *tail;   // playlists found, not yet handed out
+    int closed;             // discovery has finished
+    int processed;          // playlists converted successfully
+    int seriousflag;
+    int statsjson;          // print counters of each playlist to stderr
+    pthread_mutex_t lock;   // guards queue, closed and processed
+    pthread_cond_t ready;   // signalled on new playlist or end of discovery
+    pthread_mutex_t print;  // guards stdout and stderr
+};
+
+void *playlist_worker(void *arg)
+{   // convert playlists until discovery has finished and none is left
+struct playlistjobs *jobs = arg;
+while (1)
     {
-        char cmdstr[PATHMAX] = "";
-
-        #ifdef _WIN32
-
-        // use 'dir' in recursive subdirectory mode to get absolute paths
-        slashestobackslashes(pathfilenamestr);
-        sprintf (cmdstr, "dir /B /S /ON \"%s\" 2>&1", pathfilenamestr);
-
-        #else
-
-        // use 'find' which needs filepath and filepattern as separate arguments
-        char filepathonly[PATHMAX] = ""; get_only_filepath(filepathonly, pathfilenamestr);
-        char filenameonly[PATHMAX] = ""; get_only_filename(filenameonly, pathfilenamestr);
-
-        if (strfindchr(pathfilenamestr, 39))
-            {
-                strappendsafe(cmdstr, PATHMAX, "find \"");
-                strappendsafe(cmdstr, PATHMAX, filepathonly);
-                strappendsafe(cmdstr, PATHMAX, "\" -maxdepth 1 -iname \"");
-                strappendsafe(cmdstr, PATHMAX, filenameonly);
-                strappendsafe(cmdstr, PATHMAX, "\" 2>&1");
-            }
-        else
+        pthread_mutex_lock(&jobs->lock);
+        while ((jobs->head == NULL) && !jobs->closed)  { pthread_cond_wait(&jobs->ready, &jobs->lock); }
+        struct playlistnode *node = jobs->head;
+        if (node != NULL)
             {
-                strappendsafe(cmdstr, PATHMAX, "find '");
-                strappendsafe(cmdstr, PATHMAX, filepathonly);
-                strappendsafe(cmdstr, PATHMAX, "' -maxdepth 1 -iname '");
-                strappendsafe(cmdstr, PATHMAX, filenameonly);
-                strappendsafe(cmdstr, PATHMAX, "' 2>&1");
+                jobs->head = node->next;
+                if (jobs->head == NULL) { jobs->tail = NULL; }
             }
-
-        #endif
-
-        // puts(cmdstr);
-
-        fp = popen(cmdstr, "r"); if (fp == NULL) { fclose(fp); return(0); }
-
-        puts("");
+        pthread_mutex_unlock(&jobs->lock);
+        if (node == NULL) { break; }
+
+        char *report = NULL;
+        size_t reportlen = 0;
+        struct relm3u_stats st;
+        int done = relm3u_convert_buffer(jobs->ctx, node->path, jobs->seriousflag, 1, &report, &reportlen, &st);
+        pthread_mutex_lock(&jobs->print);
+        if (report != NULL) { fwrite(report, 1, reportlen, stdout); }
+        puts(done ? "SUCCESS.\n" : "FAILED.\n");
+        fflush(stdout);
+        if (jobs->statsjson) { print_stats_json(stderr, node->path, done, &st, 0, 0); }
+        pthread_mutex_unlock(&jobs->print);
+        relm3u_free(report);
+        free(node);
+
+        if (done)
+            {   pthread_mutex_lock(&jobs->lock); jobs->processed++; pthread_mutex_unlock(&jobs->lock);  }
     }
+return(NULL);
+}
 
-// deliver path of file found matching
-ictr++ ;
-if (fgets(pathfilenamestr, PATHMAX, fp) != NULL)
+int convert_playlists_parallel(relm3u_ctx *ctx, relm3u_iter *it, int seriousflag, int njobs, int statsjson, long long *discovery_ns)
+{   // convert all playlists delivered by the iterator on a pool of njobs
+    // threads, return number of playlists converted successfully
+    // discovery_ns delivers the time spent finding playlists
+struct playlistjobs jobs;
+jobs.ctx = ctx;
+jobs.head = NULL;
+jobs.tail = NULL;
+jobs.closed = 0;
+jobs.processed = 0;
+jobs.seriousflag = seriousflag;
+jobs.statsjson = statsjson;
+pthread_mutex_init(&jobs.lock, NULL);
+pthread_cond_init(&jobs.ready, NULL);
+pthread_mutex_init(&jobs.print, NULL);
+fflush(stdout);
+
+pthread_t workers[MAXJOBS];
+int started = 0;
+while (started < njobs)
     {
-        strlinetrim(pathfilenamestr);
-        backslashestoslashes(pathfilenamestr);
-
-        #ifdef _WIN32
-        // detect general error by absence of path separators
-        if (!strfindchr(pathfilenamestr,'/'))   { pathfilenamestr[0] = 0; ictr = 0; return(0); }
-        if (!strfindchr(pathfilenamestr,':'))   { pathfilenamestr[0] = 0; ictr = 0; return(0); }
-
-        // when 'dir' in recursive mode will dive into any subdirectories,
-        // suppress further lines when absolute path without filename grows longer
-        static unsigned int i = 0;
-        static unsigned int aplen = 0;
-        if (ictr == 1) // run once
-            {   aplen = 0; while (pathfilenamestr[aplen] != 0)     { aplen++; }
-                while (aplen > 0) {   aplen--; if (pathfilenamestr[aplen] == 47) { break; } ; }
-            }
-
-        i = 0; while (pathfilenamestr[i] != 0)     { i++; }
-        while (i > 0)       { i--; if (pathfilenamestr[i] == 47) { break; } ;  }
-        if ( i > aplen )    { pclose(fp); pathfilenamestr[0] = 0; ictr = 0; return(0); }
-
-        #endif
-
-        #ifdef UNIXES
-        // Unix: catch general error
-        if (strleftcomp(pathfilenamestr,"find:")) { pathfilenamestr[0]=0; ictr=0; return(0); }
-        #endif
-
-        if (pathfilenamestr[0] == 0)    { ictr = 0; return(0); }
-
-        // deliver current directory line in pathfilenamestr and return(TRUE)
-        return(1);
+        if (pthread_create(&workers[started], NULL, playlist_worker, &jobs) != 0) { break; }
+        started++;
     }
-else
-    {   pclose(fp);   }
-ictr = 0;
-return(0);     // no more entries, finito
-}
-
-
-int remove_protocol_and_drive_letters(char *sourcestr)
-{   // search rightmost ':' character in a path, which may indicate protocol
-    // prefix or drive letter, and remove all of them
-    // return (1) when string was modified
-    // return (0) when string was left untouched
 
-if (sourcestr[0] == 0)  { return (0); }
-int i = 0;
-int j = 0;
-while (sourcestr[i] != 0) { i++; } ; i--;
-if (i == 0) { return(0); }
-// get index position of a ':', search from the right of string
-while ((i > 0) && (sourcestr[i] != ':'))  { i--; }
-if (i == 0) { return(0); }  // no occurrence of ':', leave
-j = i + 1;
-i = 0;
-// now shift string to the left
-while (sourcestr[j] != 0) { sourcestr[i++] = sourcestr[j++]; }
-sourcestr[i] = 0;
-return(0);
+// produce: queue each playlist as it is found
+char pathstr[PATHMAX] = "";
+long long t0 = clock_ns();
+while (relm3u_find_next(it, pathstr, PATHMAX))
+    {
+        *discovery_ns += clock_ns() - t0;
+        size_t len = strlen(pathstr) + 1;
+        struct playlistnode *node = malloc(sizeof(struct playlistnode) + len);
+        if (node == NULL) { break; }
+        node->next = NULL;
+        memcpy(node->path, pathstr, len);
+        pthread_mutex_lock(&jobs.lock);
+        if (jobs.tail == NULL) { jobs.head = node; } else { jobs.tail->next = node; }
+        jobs.tail = node;
+        pthread_cond_signal(&jobs.ready);
+        pthread_mutex_unlock(&jobs.lock);
+        t0 = clock_ns();
+    }
+*discovery_ns += clock_ns() - t0;
+pthread_mutex_lock(&jobs.lock);
+jobs.closed = 1;
+pthread_cond_broadcast(&jobs.ready);
+pthread_mutex_unlock(&jobs.lock);
+
+// without any thread at all, do the work right here
+if (started == 0)   { playlist_worker(&jobs); }
+while (started > 0) { pthread_join(workers[--started], NULL); }
+
+pthread_mutex_destroy(&jobs.lock);
+pthread_cond_destroy(&jobs.ready);
+pthread_mutex_destroy(&jobs.print);
+return(jobs.processed);
 }
-
+#endif
 
 // -----------------------------------------------------------------------------
-
-// SEARCH METHOD 1 LINUX & WINDOWS
-int find_relpath_by_pathprobing(char *pathfilename, char *pllpath)
-{   // SEARCH METHOD 1: probe promising paths, deliver relative path
-    // return (1) on success, return (0) on failure (file not found)
-
-// puts ("PATHPROBING");
-
-char *pathfilename_restore = pathfilename;  // original pointer to pathfilename
-char probepath[PATHMAX];
-
-//puts(probepath);
-
-// remove one or more leading './' from pathfilename
-while (strlefttrim(pathfilename, "./")) {};
-
-// add leading '/' to relative path (for loop convenience)
-int i = strlength(pathfilename);
-if (pathfilename[0] != '/')
-    {   pathfilename[++i] = 0;
-        // shift characters backwards
-        while (i > 0) { pathfilename[i] = pathfilename[i-1]; i--; }
-        pathfilename[0] = '/';
-    }
-
-int updir = 0;
-while (updir < 3)
+// BATCH MODE
+//
+// With '--batch' the playlist paths are read from stdin, separated by NUL
+// (find -print0) or newline, whichever comes first. All of them go through
+// one context, so the filename indexes and caches are built once; the current
+// folder is taken as the library directory, in serious mode its index files
+// are kept at its top. For each playlist one JSON line goes to stdout instead
+// of the report:
+//   {"playlist":"...","ok":true,"found":2,"total":3,
+//    "entries":[{"line":2,"method":1,"path":"../a.mp3"},...],"missing":["..."]}
+// With '--dupes' an entry repeating a file carries "duplicate_of" (its line
+// before in the same playlist) or "also_in" and "also_line" (another playlist
+// of the batch); with '--dedupe' in serious mode the repeats left out are
+// marked "dropped".
+
+int read_batch_path(FILE *in, char *path, int *sep)
+{   // read the next path (PATHMAX) of the list on in; *sep is (-1) until the
+    // first separator met decides between NUL and newline for the whole list
+    // return (1) for a path, (-1) for a path too long (skipped), (0) at the end
+int ch = 0;
+while (ch != EOF)
     {
-        // restore *pointer to start of pathfilename
-        pathfilename = pathfilename_restore;
-
-        while (*pathfilename != 0)
+        size_t len = 0;
+        int toolong = 0;
+        while (((ch = getc(in)) != EOF) && (ch != *sep))
             {
-                // skip to next directory level
-                if (*pathfilename != '/') { pathfilename++; continue; }
-                pathfilename++ ;
-
-                switch (updir)
-                    {
-                        case 0 : { sprintf(probepath, "%s%s", pllpath, pathfilename); break; }
-                        case 1 : { sprintf(probepath, "%s../%s", pllpath, pathfilename); break; }
-                        case 2 : { sprintf(probepath, "%s../../%s", pllpath, pathfilename); break; }
-                        case 3 : { sprintf(probepath, "%s../../../%s", pllpath, pathfilename);break; }
-                        case 4 : { sprintf(probepath, "%s../../../../%s", pllpath, pathfilename);break; }
-                        default: { sprintf(probepath, "%s%s", pllpath, pathfilename); }
-                    }
-
-                // test probe path
-                if (check_file_exist(probepath))
-                    {
-                        // remove prepended playlist path and return relative path
-                        strlefttrim(probepath, pllpath);
-
-                        // compose complete relative path
-                        if (strleftcomp(probepath, "../"))
-                            { sprintf(pathfilename_restore, "%s", probepath); }
-                        else
-                            { sprintf(pathfilename_restore, "./%s", probepath); }
-
-                        return(1);
-                    }
+                if ((*sep < 0) && ((ch == 0) || (ch == '\n'))) { *sep = ch; break; }
+                if (len < PATHMAX - 3)  { path[len++] = (char)ch; }
+                else                    { toolong = 1; }
             }
-        updir++;
+        if ((*sep == '\n') && (len > 0) && (path[len - 1] == '\r'))    { len--; }
+        path[len] = 0;
+        if (toolong)    { return(-1); }
+        if (len > 0)    { return(1); }
     }
-// failed to find path, return original submitted path
 return(0);
 }
 
-// SEARCH METHOD 2 for LINUX
-#ifdef UNIXES
-int shell_search_unix(char *dirlinestr, char *pathpatstr, char *searchfile)
-{   // LINUX: outputs first file found in path (forward search)
-    // pathpatstr is the reference path
-    // searchfile is the filename to search for
-    // returns (1) on success;      dirlinestr = fullpath+filename+extension
-    // returns (0) no entry found;  dirlinestr = ""
-FILE *fp;
-char cmdstr[PATHMAX] = "";
-sprintf (cmdstr, "find \"%s\" -maxdepth 7 -iname \"%s\" -type f 2>&1", pathpatstr, searchfile);
-if ((fp = popen(cmdstr, "r"))== NULL)     { return(0); }
-
-// invoke delivers full path of (first) matching filename
-if (fgets(dirlinestr, PATHMAX, fp) != NULL)
-    {
-        // Unix: catch errors
-        if (strleftcomp(dirlinestr, "find:"))   { pclose(fp); return(0); }
-        if ( strfindchr(dirlinestr, ':'))       { pclose(fp); return(0); }
-        if (!strfindchr(dirlinestr, '/'))       { pclose(fp); return(0); }
-        strlinetrim(dirlinestr);
-        pclose(fp);
-        return(1);
-    }
-pclose(fp);
-return(0);
-}
-
-// SEARCH METHOD 2 for LINUX
-int find_relpath_by_search(char *pathfilestr, char *pllpath)
-{   // LINUX: find relative path for a file from absolute pathfilestr, if possible
-    // uses the mighty 'find' utility function on Unix/Linux
-    // return (1) on success, return (0) on failure (file not found)
-
-// int i;
-
-int updir = 0;
-
-char testpath [PATHMAX];
-char searchpath[PATHMAX];
-
-// isolate filename from path
-char searchfile[1024] = ""; get_only_filename(searchfile, pathfilestr);
-
-// joker-out misleading square brackets, which are yet allowed in filenames
+void print_batch_json(FILE *fp, char *path, int done, struct relm3u_entry *entries, int n)
+{   // one JSON line with the outcome of a playlist and of each of its entries
+fputs("{\"playlist\":", fp);
+json_string(fp, path);
+fprintf(fp, ",\"ok\":%s", done ? "true" : "false");
+int found = 0;
 int i = 0;
-while (searchfile[i] != 0)
+for (i = 0; i < n; i++) { if (entries[i].method > 0) { found++; } }
+fprintf(fp, ",\"found\":%d,\"total\":%d,\"entries\":[", found, n);
+for (i = 0; i < n; i++)
     {
-        if (searchfile[i] == '[') { searchfile[i] = '?'; }
-        if (searchfile[i] == ']') { searchfile[i] = '?'; }
-        i++;
-    }
-
-while (updir < 3)
-    {
-        switch (updir)
+        fprintf(fp, "%s{\"line\":%d,\"method\":%d", (i > 0) ? "," : "", entries[i].line, entries[i].method);
+        if (entries[i].ambiguous)   { fputs(",\"ambiguous\":true", fp); }
+        if (entries[i].dropped)     { fputs(",\"dropped\":true", fp); }
+        if (entries[i].duplicate_of > 0)    { fprintf(fp, ",\"duplicate_of\":%d", entries[i].duplicate_of); }
+        if (entries[i].also_in != NULL)
             {
-                case 0 : { sprintf(searchpath, "%s./", pllpath); break; }
-                case 1 : { sprintf(searchpath, "%s../", pllpath); break; }
-                case 2 : { sprintf(searchpath, "%s../../", pllpath); break; }
-                case 3 : { sprintf(searchpath, "%s../../../", pllpath); break; }
-                case 4 : { sprintf(searchpath, "%s../../../../", pllpath); break; }
-                default: { sprintf(searchpath, "%s./", pllpath); }
-            }
-
-        // use shell 'find' with filename 'searchfile' from path 'searchpath'
-        if (shell_search_unix(testpath, searchpath, searchfile))
-            {       // remove prepended playlist path and return relative path
-                    strlefttrim(testpath, pllpath);
-                    sprintf(pathfilestr, "%s", testpath);
-                    return(1);
+                fputs(",\"also_in\":", fp);
+                json_string(fp, (char *)entries[i].also_in);
+                fprintf(fp, ",\"also_line\":%d", entries[i].also_line);
             }
-
-        updir++;
+        fputs(",\"path\":", fp);
+        json_string(fp, (char *)entries[i].path);
+        fputc('}', fp);
     }
-return(0);
-}
-
-#endif
-
-
-// SEARCH METHOD 2 for WINDOWS
-#ifdef __WIN32__
-int shell_search_windows(char *dirlinestr, char *pathpatstr, char *searchfile)
-{   // WINDOWS: outputs first found file's full path (forward)
-    // using 'dir' utility from standard command shell
-    // pathpatstr is the reference path
-    // searchfile is the glob to search
-    // returns (1) on success;      dirlinestr = fullpath+filename+extension
-    // returns (0) no entry found;  dirlinestr = ""
-
-slashestobackslashes(pathpatstr);   // necessary for command shell commands
-//slashestobackslashes(searchfile);   // normally not necessary
-
-// puts(dirlinestr);
-// puts(pathpatstr);
-// puts(searchfile);
-
-FILE *fp;
-char cmdstr[PATHMAX] = "";
-// this 'dir' syntax delivers line-separated strings of *full path*
-sprintf (cmdstr, "dir \"%s\\%s\" /B /S 2>&1", pathpatstr, searchfile);
-//~ puts(cmdstr);
-
-if ((fp = popen(cmdstr, "r")) == NULL)     { return(0); }
-int i = 0;
-if (fgets(dirlinestr, PATHMAX, fp) != NULL)
+fputs("],\"missing\":[", fp);
+int m = 0;
+for (i = 0; i < n; i++)
     {
-        // trim control characters (trailing cr/lf) and drop empty line
-        strlinetrim(dirlinestr);
-        if (dirlinestr[i]==0)               { pclose(fp); return(0); }
-
-        // convert path to forward slashes
-        backslashestoslashes(dirlinestr);
-
-        // detect no-path return
-        if (!strfindchr(dirlinestr, '/'))   { pclose(fp); return(0); }
-        if (!strfindchr(dirlinestr, ':'))   { pclose(fp); return(0); }
-
-        pclose(fp);
-        return(1);
+        if (entries[i].method > 0) { continue; }
+        if (m++ > 0) { fputc(',', fp); }
+        json_string(fp, (char *)entries[i].path);
     }
-puts("UPS");
-pclose(fp);
-return(0);
+fputs("]}\n", fp);
+fflush(fp);
+return;
 }
 
-// SEARCH METHOD 2 for WINDOWS
-int find_relpath_by_search(char *pathfilestr, char *pllpath)
-{   // WINDOWS: find relative path for a file from absolute pathfilestr, if possible
-    // return (1) on success, return (0) on failure (file not found)
-
-// puts("PATHSEARCH");
-
-int updir = 0;
-
-char probepath [PATHMAX];
-char searchpath[PATHMAX];
-
-backslashestoslashes(pllpath);
-backslashestoslashes(pathfilestr);
-
-// puts(pllpath);
-
-// isolate filename from path
-char searchfile[PATHMAX] = "";
-get_only_filename(searchfile, pathfilestr);
-
-while (updir < 3)
-    {
-       switch (updir)
-            {
-                case 0 : { sprintf(searchpath, "%s./", pllpath); break; }
-                case 1 : { sprintf(searchpath, "%s../", pllpath); break; }
-                case 2 : { sprintf(searchpath, "%s../../", pllpath); break; }
-                case 3 : { sprintf(searchpath, "%s../../../", pllpath); break; }
-                case 4 : { sprintf(searchpath, "%s../../../../", pllpath); break; }
-                default: { sprintf(searchpath, "%s./", pllpath); }
-            }
-
-        // note: uses shell 'dir' with filename 'searchfile' on path 'searchpath'
-        if (shell_search_windows(probepath, searchpath, searchfile))
-            {
-                //printf("PLL PATH  : <%s>\n", pllpath);
-                // remove identical part of playlist path
-                strleftcutident(probepath, pllpath);
-
-                //printf("FOUNDPATH : <%s>\n", probepath);
-                // restore directory-upsteps to preceede relative path
-
-                switch (updir)
-                    {
-                        case 0 : { sprintf(pathfilestr, "./%s", probepath); break; }
-                        case 1 : { sprintf(pathfilestr, "../%s", probepath); break; }
-                        case 2 : { sprintf(pathfilestr, "../../%s", probepath); break; }
-                        case 3 : { sprintf(pathfilestr, "../../../%s", probepath); break; }
-                        case 4 : { sprintf(pathfilestr, "../../../../%s", probepath); break; }
-                        default: { sprintf(pathfilestr, "./%s", probepath); }
-                    }
-
-                backslashestoslashes(pathfilestr);
-                return(1);
-            }
-
-        updir++;
-    }
-
-return(0);
-}
+int convert_batch(relm3u_ctx *ctx, int seriousflag, int linejobs, int statsjson)
+{   // convert each playlist listed on stdin, the reports are dropped
+    // return the number of playlists that could not be converted
+#ifdef _WIN32
+FILE *quiet = fopen("NUL", "w");
+#else
+FILE *quiet = fopen("/dev/null", "w");
 #endif
-
-
-int convert_playlist_to_relative(char *m3ufilepath, int seriousflag)
-{   // make playlist with original pathfilename but relative paths, as possible
-char sourcefilename [PATHMAX] = "";
-char targetfilename [PATHMAX] = "";
-char linbuf[PATHMAX] = "";
-char playlistpath[PATHMAX] = "";
-
-get_only_filepath(playlistpath, m3ufilepath);
-
-if (!check_file_exist(m3ufilepath)) { puts("FILE DOES NOT EXIST."); return(0); }
-
-FILE *fr;
-FILE *fw;
-
-if (seriousflag == 1)       // SERIOUS MODE!
+if (quiet == NULL) { return(-1); }
+char listed[PATHMAX];
+char cstr[PATHMAX + 2];
+int sep = -1;
+int failed = 0;
+int got;
+while ((got = read_batch_path(stdin, listed, &sep)) != 0)
     {
-        puts("SERIOUS MODE. PLAYLIST GONNA GET MODIFIED.\n");
-
-        // CREATE BACK-UP FILE
-        //
-        // find free backup filename
-        int bakfno = 0;
-        while (bakfno < 99)
+        if (got < 0)
             {
-                sprintf(targetfilename, "%s.%02d.bak", m3ufilepath, bakfno);
-                bakfno++;
-                if (check_file_exist(targetfilename)) { continue; } else { break; }
-            }
-        // make backup copy
-        // sourcefilename = original m3ufilepath
-        // targetfilename = numbered backup filename
-
-        sprintf(sourcefilename, "%s", m3ufilepath);
-
-        #ifdef _WIN32
-        slashestobackslashes(sourcefilename);
-        slashestobackslashes(targetfilename);
-        #endif
-
-        fr = fopen(sourcefilename, "r"); if (fr == NULL) { return(0); }
-        fw = fopen(targetfilename, "w"); if (fw == NULL) { return(0); }
-        while (fgets(linbuf, sizeof(linbuf), fr)) {  fputs(linbuf, fw);  }
-        if (fclose(fw) != 0) { return(0) ; }
-        if (fclose(fr) != 0) { return(0) ; }
-
-        // backup filename is now sourcefile for conversion
-        sprintf(sourcefilename, "%s", targetfilename);
-        // original filename is now targetfile to overwrite
-        sprintf(targetfilename, "%s", m3ufilepath);
-
-        #ifdef _WIN32
-        slashestobackslashes(sourcefilename);
-        slashestobackslashes(targetfilename);
-        #endif
-    }
-
-else                        // TESTING MODE
-
-    {
-        puts("TEST MODE. NO WRITE ACCESS. JUST INFO.\n");
-
-        sprintf(sourcefilename, "%s", m3ufilepath);
-
-        #ifdef UNIXES
-        sprintf(targetfilename, "%s", "/dev/null");
-        #endif
-
-        #ifdef __WIN32__
-        slashestobackslashes(sourcefilename);
-        sprintf(targetfilename, "%s", "NUL:");
-        #endif
-
-    }
-
-printf("PATH: \"%s\"\n\n", m3ufilepath);
-
-//~ printf("SOURCE: %s\n", sourcefilename);
-//~ printf("TARGET: %s\n", targetfilename);
-
-// parse and modify playlist
-fr = fopen(sourcefilename, "r"); if (fr == NULL) { return(0); }
-fw = fopen(targetfilename, "w"); if (fw == NULL) { return(0); }
-
-int filestotal = 0;
-int filesfound = 0;
-
-// process source file line by line
-while (fgets(linbuf, sizeof(linbuf), fr))
-    {
-        // clean line ends from whitespaces and other unwanted stuff
-        strlinetrim(linbuf);
-
-        // discard lines that are empty after trimming
-        if (linbuf[0] == 0)     { continue; }
-
-        // discard all #EXT taglines
-        if (linbuf[0] == '#')   { continue; }
-
-        // convert backslashes to slashes
-        backslashestoslashes(linbuf);
-
-            // remove the file protocol prefix
-            //strlefttrim(linbuf, "file://");
-
-        // refined procedure: remove any protocol prefix and drive letters
-        // (bug report 20230318, Richard)
-        remove_protocol_and_drive_letters(linbuf);
-        strlefttrim(linbuf, "/");
-
-        // decode possible URL-style path
-        urltostring(linbuf);
-
-            // slash-out drive letter from an absolute dos/win path
-            //if (linbuf[1] == ':')    {   linbuf[0] = '/'; linbuf[1] = '/';   }
-
-            // discard lines with other protocol prefixes
-            //if (strfindchr(linbuf,':'))    { continue; }
-
-        // so this IS a candidate
-        filestotal++;
-
-        //puts(linbuf);
-        if (find_relpath_by_pathprobing(linbuf, playlistpath))
-            {   // file found on modified playlist path
-                fprintf(fw,"%s\n", linbuf);
-                printf("1: %s\n", linbuf);
-                filesfound++;
+                fputs("{\"playlist\":null,\"ok\":false,\"error\":\"path too long\"}\n", stdout);
+                failed++;
+                continue;
             }
+        // a bare filename is taken from the current folder, as on the command line
+        if ((strchr(listed, 47)) || (strchr(listed, 92)))   { sprintf(cstr, "%s", listed); }
+        else                                                { sprintf(cstr, "./%s", listed); }
+        char *c = cstr;
+        while (*c != 0) { if (*c == 92) { *c = 47; } ; c++; }
+
+        struct relm3u_entry *entries;
+        int n;
+        struct relm3u_stats st;
+        int done = relm3u_convert_entries(ctx, cstr, seriousflag, linejobs, quiet, &entries, &n, &st);
+        if (entries != NULL)    { print_batch_json(stdout, listed, done, entries, n); }
         else
-            {   // try blind search ('find' / 'dir')
-                if (find_relpath_by_search(linbuf, playlistpath))
-                    {
-                        fprintf(fw,"%s\n", linbuf);
-                        printf("2: %s\n", linbuf);
-                        filesfound++;
-                    }
-                else
-                    {   printf("X: %s\n", linbuf);   }
+            {
+                fputs("{\"playlist\":", stdout);
+                json_string(stdout, listed);
+                fputs(",\"ok\":false,\"error\":\"out of memory\"}\n", stdout);
             }
+        if (!done || (entries == NULL)) { failed++; }
+        relm3u_free(entries);
+        if (statsjson) { print_stats_json(stderr, cstr, done, &st, 0, 0); }
     }
-
-printf("\nFOUND: %d / %d\n", filesfound, filestotal);
-if (fclose(fw)!=0) { return(0) ; }
-if (fclose(fr)!=0) { return(0) ; }
-puts("");
-return(1);
+fclose(quiet);
+return(failed);
 }
 
 void compiler_version_info(void)
@@ -941,13 +454,18 @@ return;
 
 int main(int argc, char *argv[])
 {
-puts("");
+// in batch mode stdout carries nothing but the JSON lines
+int batch = 0;
+int a = 1;
+for (a = 1; a < argc; a++) { if (strcmp(argv[a], "--batch") == 0) { batch = 1; } }
+if (!batch) { puts(""); }
 if (argc == 1)
     {
     puts("RELM3U  -  CONVERT M3U PLAYLISTS TO RELATIVE LOCAL PATHS\n");
 #ifdef _WIN32
     puts("USAGE:\n");
-    puts("relm3u [path] [serious-switch]\n");
+    puts("relm3u [path] [serious-switch] [--dupes] [--dedupe] [--radius=N]");
+    puts("relm3u --batch [serious-switch] [--dupes] [--dedupe] [--radius=N]\n");
     puts("EXAMPLES:\n");
     puts("Show this help screen");
     puts("relm3u");
@@ -969,15 +487,28 @@ if (argc == 1)
     puts("Paths containing whitespaces, wildcards and special characters");
     puts("must be quoted according to your command shell rules.");
     puts("Only existing local files are kept in the new playlist.");
-    puts("Files not found, extended tags and URLs are removed.");
+    puts("Files not found and URLs are removed, #EXTINF and other '#' lines");
+    puts("stay with the entry they precede and go with it when it is removed.");
     puts("Recursive search through several directory levels");
     puts("may take a little longer. Do not be alarmed.");
+    puts("Files are searched in the playlist folder and in the two folders");
+    puts("above it, nearest first; option '--radius=N' searches N folders");
+    puts("above it instead (0 to 7).");
     puts("This tool can deal with relocated files and playlists.");
     puts("Encoding fully compatible to ASCII/ISO-8859/UTF-8.");
-    puts("Exotic encoding problems may be solved by switching codepage.\n");
+    puts("Exotic encoding problems may be solved by switching codepage.");
+    puts("Option '--dupes' reports entries referring to the same file within");
+    puts("a playlist and across all playlists searched; '--dedupe' also");
+    puts("leaves repeats within a playlist out of the rewritten playlist.");
+    puts("Option '--batch' instead of a path reads playlist paths from stdin,");
+    puts("one per line, and prints one JSON line of results per playlist.\n");
 #else
     puts("USAGE:\n");
-    puts("./relm3u [path] [serious-switch]\n");
+    puts("./relm3u [path] [serious-switch] [-j jobs] [--incremental] [--watch] [--stats=json]");
+    puts("         [--fingerprint] [--snapshot=DIR] [--dupes] [--dedupe] [--extinf] [--radius=N]");
+    puts("./relm3u [path] [serious-switch] --generate [--stats=json]");
+    puts("./relm3u [library path] [serious-switch] --serve=SOCK [-j jobs] [--radius=N] [--stats=json]");
+    puts("./relm3u --batch [serious-switch] [-j jobs] [--stats=json] [...] < list\n");
     puts("EXAMPLES:\n");
     puts("Show this help screen");
     puts("./relm3u");
@@ -993,13 +524,57 @@ if (argc == 1)
     puts("Only by second argument '-s' or '--serious' changes are actually");
     puts("written to the playlist and a back-up file is created.");
     puts("With no further argument, default is safe testing mode.");
+    puts("Option '-j N' converts N playlists at a time, which pays off");
+    puts("on network storage; reports are printed as each one finishes.");
+    puts("A single playlist gets N of its lines resolved at a time instead.");
+    puts("Playlists are handed to the workers while the search goes on.");
+    puts("Option '--incremental' keeps a state file '.relm3u.state' in the");
+    puts("searched folder and skips playlists unchanged since the last run.");
+    puts("Option '--watch' with a directory path keeps running and converts");
+    puts("again each playlist referring to files moved or deleted below it.");
+    puts("Option '--stats=json' writes the counters of each playlist and of");
+    puts("the whole run to stderr, as one JSON object per line ('--stats'");
+    puts("for short).");
+    puts("Option '--fingerprint' finds renamed files by their content, when");
+    puts("the original still exists or '--incremental' recorded it before;");
+    puts("'--snapshot=DIR' names a backup or snapshot holding the originals.");
+    puts("Method 3 in the report marks files found this way.");
+    puts("Option '--dupes' reports entries referring to the same file within");
+    puts("a playlist and across all playlists searched; '--dedupe' also");
+    puts("leaves repeats within a playlist out of the rewritten playlist.");
+    puts("Option '--extinf' adds an #EXTINF line made of the tags of the file");
+    puts("to each entry of an extended playlist (#EXTM3U) which has none.");
+    puts("Option '--generate' makes a playlist '!_<folder>.m3u8' of the .mp3");
+    puts("and .m4a files below each folder in the directory path (or below the");
+    puts("folder path without trailing slash), sorted by year, album and track");
+    puts("number from their tags, in a folder 'playlists' beside the folders.");
+    puts("Option '--serve=SOCK' indexes the library directory path and then");
+    puts("answers requests on the Unix socket SOCK until stopped, keeping the");
+    puts("index in memory: 'RESOLVE<tab>playlist<tab>entry' resolves one entry,");
+    puts("'CONVERT<tab>playlist<tab>length' followed by the playlist bytes");
+    puts("returns the converted playlist, nothing is written; '-j N' serves");
+    puts("N connections at a time (default 4).");
+    puts("Option '--batch' instead of a path reads playlist paths from stdin,");
+    puts("separated by newline or NUL ('find -print0'), converts them on one");
+    puts("shared index and prints one JSON line per playlist instead of the");
+    puts("report: found and total entries, method and path of each entry and");
+    puts("the entries not found, with '--dupes' also the repeats of a file;");
+    puts("'-j N' resolves N lines at a time; the current directory is taken");
+    puts("as the library directory.");
     puts("Paths containing whitespaces, wildcards and special characters");
     puts("must be quoted according to your command shell rules.");
     puts("Only local files that actually exist are kept in the new playlist.");
-    puts("Files not found, extended tags and URLs are removed.");
+    puts("Files not found and URLs are removed, #EXTINF and other '#' lines");
+    puts("stay with the entry they precede and go with it when it is removed.");
     puts("Recursive search through several directory levels");
     puts("may take a little longer. Do not be alarmed.");
+    puts("Files are searched in the playlist folder and in the two folders");
+    puts("above it, nearest first; option '--radius=N' searches N folders");
+    puts("above it instead (0 to 7).");
     puts("This tool can deal with relocated files and playlists.");
+    puts("In serious mode a file index '.relm3u.idx' is kept in the");
+    puts("submitted directory, so later runs only re-read changed folders;");
+    puts("nothing is written above it.");
     puts("Encoding fully compatible to ASCII/ISO-8859/UTF-8.\n");
 #endif
     puts("(C) 2020-2024 Julien Thomas [jtxp.org]");
@@ -1010,24 +585,97 @@ if (argc == 1)
     return(0);
     }
 
-puts ("R E L M 3 U");
+if (!batch) { puts ("R E L M 3 U"); }
 
 // int c = 0; printf("argc: %d\n",argc); while(c<argc) { printf("%d\t<%s>\n",c,argv[c]); c++; }
 
-// parse for second argument which may or may not be the serious switch
+// parse further arguments for the serious switch and options
 int serious = 0;    // safe default
-
-if (argc == 3)
+int jobs = 1;       // playlists converted concurrently
+int jobsgiven = 0;  // '-j' was given
+int watch = 0;      // keep running and follow moved files
+char *sockpath = NULL;  // answer requests on this socket instead
+int incremental = 0;    // consult the state of the last run
+int generate = 0;   // make playlists from tags instead
+int statsjson = 0;  // counters as JSON lines to stderr
+int flags = 0;      // library flags besides the index kept in serious mode
+char *snapshots[RELM3U_MAXSNAPSHOTS];
+int nsnapshots = 0;
+int radius = RELM3U_RADIUS;     // folders searched above the playlist folder
+long long started = clock_ns();
+long long discovery_ns = 0;
+
+// in batch mode there is no path, every argument is an option
+a = batch ? 1 : 2;
+while (a < argc)
     {
-        if (strrightcomp(argv[2], "s"))        { serious = 1; }
-        if (strrightcomp(argv[2], "serious"))  { serious = 1; }
+        if (strncmp(argv[a], "-j", 2) == 0)
+            {   // accept both '-j N' and '-jN'
+                char *num = argv[a] + 2;
+                if ((*num == 0) && (a + 1 < argc)) { num = argv[++a]; }
+                jobs = atoi(num);
+                jobsgiven = 1;
+                if ((jobs < 1) || (jobs > MAXJOBS)) { puts("INVALID NUMBER OF JOBS. BYE."); return(1); }
+            }
+        else if (strcmp(argv[a], "--watch") == 0)  { watch = 1; }
+        else if (strncmp(argv[a], "--serve=", 8) == 0)
+            {
+                sockpath = argv[a] + 8;
+                if (*sockpath == 0) { puts("SOCKET PATH MISSING. BYE."); return(1); }
+            }
+        else if (strcmp(argv[a], "--incremental") == 0)    { incremental = 1; }
+        else if ((strcmp(argv[a], "--stats=json") == 0) || (strcmp(argv[a], "--stats") == 0))  { statsjson = 1; }
+        else if (strcmp(argv[a], "--fingerprint") == 0)    { flags |= RELM3U_FINGERPRINT; }
+        else if (strcmp(argv[a], "--generate") == 0)   { generate = 1; }
+        else if (strcmp(argv[a], "--dupes") == 0)  { flags |= RELM3U_DUPES; }
+        else if (strcmp(argv[a], "--dedupe") == 0) { flags |= RELM3U_DUPES | RELM3U_DEDUPE; }
+        else if (strcmp(argv[a], "--extinf") == 0) { flags |= RELM3U_EXTINF; }
+        else if (strncmp(argv[a], "--radius=", 9) == 0)
+            {
+                char *end;
+                radius = (int)strtol(argv[a] + 9, &end, 10);
+                if ((end == argv[a] + 9) || (*end != 0) || (radius < 0) || (radius > RELM3U_MAXRADIUS))
+                    {   puts("INVALID SEARCH RADIUS. BYE."); return(1);  }
+            }
+        else if (strncmp(argv[a], "--snapshot=", 11) == 0)
+            {
+                if (nsnapshots == RELM3U_MAXSNAPSHOTS) { puts("TOO MANY SNAPSHOT FOLDERS. BYE."); return(1); }
+                snapshots[nsnapshots++] = argv[a] + 11;
+                flags |= RELM3U_FINGERPRINT;
+            }
+        else if (strcmp(argv[a], "--batch") == 0)  { }
+        else if (is_serious_switch(argv[a]))   { serious = 1; }
+        else
+            {   puts("UNKNOWN ARGUMENT. BYE."); return(1);  }
+        a++;
     }
-if (argc > 3)
+
+if (batch)
     {
-        puts("TOO MANY ARGUMENTS. BYE."); return(1);
+        if (watch || generate || incremental || (sockpath != NULL))
+            {   fputs("OPTION NOT AVAILABLE IN BATCH MODE. BYE.\n", stderr); return(1);  }
+        relm3u_ctx *ctx = relm3u_open(NULL, (serious ? RELM3U_PERSIST_INDEX : 0) | flags);
+        if (ctx == NULL) { fputs("OUT OF MEMORY. BYE.\n", stderr); return(1); }
+        relm3u_set_radius(ctx, radius);
+        for (a = 0; a < nsnapshots; a++) { relm3u_add_snapshot(ctx, snapshots[a]); }
+        // the index files sit in the current folder, as for a bare filename
+        relm3u_set_library(ctx, "./");
+        int failed = convert_batch(ctx, serious, jobs, statsjson);
+        if (statsjson)
+            {
+                struct relm3u_stats st;
+                relm3u_get_stats(ctx, &st);
+                print_stats_json(stderr, NULL, 0, &st, 0, clock_ns() - started);
+            }
+        relm3u_close(ctx);
+        return((failed == 0) ? 0 : 1);
     }
 
-if (strlength(argv[1]) < 1)
+// playlists are made from tags, no entry is resolved
+if (generate && ((flags != 0) || jobsgiven || incremental || watch || (sockpath != NULL)))
+    {   puts("OPTION NOT AVAILABLE WITH GENERATE. BYE."); return(1);  }
+
+if (strlen(argv[1]) < 1)
     {
         puts("REFERENCE PATH TOO SHORT. BYE."); return(1);
     }
@@ -1037,52 +685,174 @@ int j = 0;
 // copy submitted path/filename for further processing
 char cstr[PATHMAX] = "";
 
-if ( (strfindchr(argv[1],47)) || (strfindchr(argv[1],92)) )
+if (strlen(argv[1]) >= PATHMAX - 2)
+    {
+        puts("REFERENCE PATH TOO LONG. BYE."); return(1);
+    }
+if ( (strchr(argv[1],47)) || (strchr(argv[1],92)) )
     { sprintf(cstr, "%s", argv[1]); }
 else
     { sprintf(cstr, "./%s", argv[1]); }
 
 // ALWAYS use forward slashes internally
-backslashestoslashes(cstr);
+char *c = cstr;
+while (*c != 0) { if (*c == 92) { *c = 47; } ; c++; }
 
 // printf("\nARGV[1] resolved to: <%s>\n", cstr);
 
 // DECIDE ON DIRECTORY-ONLY OR RECURSIVE PROCESSING MODE
-if (strrightcomp(cstr, "/") || strrightcomp(cstr, "./")  )
+int recurse = endswith(cstr, "/");
+
+if (watch)
     {
-        puts("M3U SEARCH IN SUBMITTED DIRECTORY AND SUBDIRECTORIES\n");
-        while (dir_get_recurse_m3u_filepaths(cstr))
+        if (!recurse) { puts("WATCH MODE NEEDS A DIRECTORY PATH. BYE."); return(1); }
+        if (flags & RELM3U_DUPES) { puts("WATCH MODE DOES NOT LOOK FOR DUPLICATES. BYE."); return(1); }
+        puts("WATCHING DIRECTORY AND SUBDIRECTORIES FOR MOVED FILES");
+        puts("STOP WITH CTRL-C\n");
+        #ifdef UNIXES
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = on_stop_signal;
+        sigaction(SIGINT, &sa, NULL);
+        sigaction(SIGTERM, &sa, NULL);
+        #endif
+        relm3u_ctx *ctx = relm3u_open(NULL, (serious ? RELM3U_PERSIST_INDEX : 0) | flags);
+        if (ctx == NULL) { puts("OUT OF MEMORY. BYE."); return(1); }
+        relm3u_set_radius(ctx, radius);
+        relm3u_set_library(ctx, cstr);
+        for (a = 0; a < nsnapshots; a++) { relm3u_add_snapshot(ctx, snapshots[a]); }
+        int done = relm3u_watch(ctx, cstr, serious, stdout, &stopwatch);
+        if (statsjson)
             {
-                //printf("M3U: <%s>\n", cstr);
-
-                if (convert_playlist_to_relative(cstr, serious))
-                    { puts("SUCCESS."); j++; }
-                else
-                    { puts("FAILED."); }
-                puts("");
+                struct relm3u_stats st;
+                relm3u_get_stats(ctx, &st);
+                print_stats_json(stderr, NULL, 0, &st, 0, clock_ns() - started);
             }
+        relm3u_close(ctx);
+        puts(done ? "\nFINISHED.\n" : "\nFAILED.\n");
+        return(done ? 0 : 1);
     }
-else
+if (sockpath != NULL)
     {
-        puts("M3U SEARCH IN SUBMITTED DIRECTORY ONLY\n");
-        while (dir_get_current_m3u_filepaths(cstr))
+        if (!recurse) { puts("SERVER MODE NEEDS A LIBRARY DIRECTORY PATH. BYE."); return(1); }
+        if (flags & RELM3U_DUPES) { puts("SERVER MODE DOES NOT LOOK FOR DUPLICATES. BYE."); return(1); }
+        puts("INDEXING LIBRARY DIRECTORY AND SUBDIRECTORIES");
+        puts("STOP WITH CTRL-C\n");
+        #ifdef UNIXES
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = on_stop_signal;
+        sigaction(SIGINT, &sa, NULL);
+        sigaction(SIGTERM, &sa, NULL);
+        // a client hanging up early must not end the server
+        sa.sa_handler = SIG_IGN;
+        sigaction(SIGPIPE, &sa, NULL);
+        #endif
+        relm3u_ctx *ctx = relm3u_open(cstr, (serious ? RELM3U_PERSIST_INDEX : 0) | flags);
+        if (ctx == NULL) { puts("CANNOT OPEN LIBRARY. BYE."); return(1); }
+        relm3u_set_radius(ctx, radius);
+        for (a = 0; a < nsnapshots; a++) { relm3u_add_snapshot(ctx, snapshots[a]); }
+        int done = relm3u_serve(ctx, sockpath, jobsgiven ? jobs : SERVEJOBS, stdout, &stopwatch);
+        if (statsjson)
             {
-                //printf("M3U: <%s>\n", cstr);
-
-                if (convert_playlist_to_relative(cstr, serious))
-                    { puts("SUCCESS."); j++; }
-                else
-                    { puts("FAILED."); }
-                puts("");
+                struct relm3u_stats st;
+                relm3u_get_stats(ctx, &st);
+                print_stats_json(stderr, NULL, 0, &st, 0, clock_ns() - started);
             }
+        relm3u_close(ctx);
+        puts(done ? "\nFINISHED.\n" : "\nFAILED.\n");
+        return(done ? 0 : 1);
+    }
+if (generate)
+    {
+        if (recurse)    { puts("PLAYLIST FOR EACH FOLDER IN SUBMITTED DIRECTORY\n"); }
+        else            { puts("PLAYLIST FOR SUBMITTED FOLDER\n"); }
+        relm3u_ctx *ctx = relm3u_open(NULL, serious ? RELM3U_PERSIST_INDEX : 0);
+        if (ctx == NULL) { puts("OUT OF MEMORY. BYE."); return(1); }
+        relm3u_set_radius(ctx, radius);
+        relm3u_set_library(ctx, cstr);
+        struct relm3u_stats st;
+        j = relm3u_generate(ctx, cstr, recurse, serious, stdout, &st);
+        if (statsjson) { fflush(stdout); print_stats_json(stderr, NULL, 0, &st, 0, clock_ns() - started); }
+        relm3u_close(ctx);
+        if (j <= 0) { puts("NO PLAYLIST GENERATED.\n"); return(1); }
+        printf("%d PLAYLIST FILE%s GENERATED.\n", j, (j > 1) ? "S" : "");
+        puts("\nFINISHED.\n");
+        return(0);
+    }
+if (recurse)    { puts("M3U SEARCH IN SUBMITTED DIRECTORY AND SUBDIRECTORIES\n"); }
+else            { puts("M3U SEARCH IN SUBMITTED DIRECTORY ONLY\n");  }
+
+// an exact single playlist gets its lines resolved in parallel instead
+char *filenameonly = strrchr(cstr, '/') + 1;
+int single = ( !recurse &&
+               (endswith(cstr, ".m3u") || endswith(cstr, ".m3u8")) &&
+               (strpbrk(filenameonly, "*?[") == NULL) );
+
+// filename index files are only written when playlists may be written too
+relm3u_ctx *ctx = relm3u_open(NULL, (serious ? RELM3U_PERSIST_INDEX : 0) | flags);
+if (ctx == NULL) { puts("OUT OF MEMORY. BYE."); return(1); }
+relm3u_set_radius(ctx, radius);
+for (a = 0; a < nsnapshots; a++) { relm3u_add_snapshot(ctx, snapshots[a]); }
+
+// the index files and the state file sit in the folder searched
+char libpath[PATHMAX];
+sprintf(libpath, "%s", cstr);
+*(strrchr(libpath, '/') + 1) = 0;
+relm3u_set_library(ctx, libpath);
+char statepath[PATHMAX + 16] = "";
+if (incremental)
+    {
+        sprintf(statepath, "%s.relm3u.state", libpath);
+        if (!relm3u_state_open(ctx, statepath))
+            {   relm3u_close(ctx); puts("CANNOT READ STATE FILE. BYE."); return(1);  }
     }
 
+relm3u_iter *it = relm3u_find_open(cstr, recurse);
+if (it == NULL) { relm3u_close(ctx); puts("OUT OF MEMORY. BYE."); return(1); }
+puts("");
+
+int pooled = 0;
+#ifdef UNIXES
+if ((jobs > 1) && !single)  { j = convert_playlists_parallel(ctx, it, serious, jobs, statsjson, &discovery_ns); pooled = 1; }
+#endif
+long long t0 = clock_ns();
+while (!pooled && relm3u_find_next(it, cstr, PATHMAX))
+    {
+        //printf("M3U: <%s>\n", cstr);
+        discovery_ns += clock_ns() - t0;
+
+        struct relm3u_stats st;
+        int done = relm3u_convert_stats(ctx, cstr, serious, single ? jobs : 1, stdout, &st);
+        if (done)
+            { puts("SUCCESS."); j++; }
+        else
+            { puts("FAILED."); }
+        puts("");
+        if (statsjson) { fflush(stdout); print_stats_json(stderr, cstr, done, &st, 0, 0); }
+        t0 = clock_ns();
+    }
+if (!pooled) { discovery_ns += clock_ns() - t0; }
+relm3u_find_close(it);
+
+// the state is only kept when playlists may be written too
+if (incremental && serious && !relm3u_state_save(ctx))   { puts("CANNOT WRITE STATE FILE."); }
+struct relm3u_stats st;
+relm3u_get_stats(ctx, &st);
+if (statsjson) { print_stats_json(stderr, NULL, 0, &st, discovery_ns, clock_ns() - started); }
+relm3u_close(ctx);
+
 
 // concluding a little statistics
 puts("");
 if (j == 0) { printf("NO FILE PROCESSED.\n");   return(1);  }
 if (j <  2) { printf("%d PLAYLIST FILE PROCESSED.\n",j);    }
 else        { printf("%d PLAYLIST FILES PROCESSED.\n",j);   }
+if (flags & RELM3U_DUPES)
+    {
+        printf("%lld DUPLICATE ENTRIES WITHIN PLAYLISTS, %lld ACROSS PLAYLISTS.\n", st.duplicates, st.duplicates_across);
+        if (flags & RELM3U_DEDUPE) { printf("%lld OF THEM LEFT OUT.\n", st.duplicates_dropped); }
+    }
 
 puts("\nFINISHED.\n");
 
@@ -0,0 +1,267 @@
+import argparse
+import os
+import shutil
+import signal
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+import unicodedata
+
+# Regression checks of relm3u on small playlists made up on the spot.
+#
+# Each case writes a playlist and its music files into a fresh folder, runs
+# relm3u in serious mode with the given options and compares the rewritten
+# playlist with the one expected; no file may be written above the folder.
+# A case may also name lines the report must show, in that order. Checks of
+# the other modes get such a folder and compare what relm3u answers there.
+# Exit code 1 when any case fails.
+
+BATCH = 32      # lines resolved at once (PROBEBATCH in librelm3u.c)
+
+def long_comment_case():
+    # a '#' line too long for a path is dropped; the line slot it leaves
+    # behind must not bring back a '#' line of an earlier batch
+    files = ["f%02d.mp3" % i for i in range(BATCH)]
+    lines = ["#EXTINF:1,first"] + files[:-1] + ["#" + "c" * 5000, files[-1]]
+    expected = ["#EXTINF:1,first"] + ["./" + f for f in files]
+    return files, lines, expected
+
+def moved_case():
+    # a file moved into another folder is found by search, which indexes the
+    # playlist folder and, in memory only, the folders above it
+    files = ["A/x.mp3", "A/y.mp3"]
+    lines = ["B/x.mp3", "y.mp3"]
+    expected = ["./A/x.mp3", "./A/y.mp3"]
+    return files, lines, expected
+
+def long_entry_case():
+    # a relative line one byte short of a path fills its line slot; the '/'
+    # put in front of it for the probe must not run into the next slot
+    files = ["f%02d.mp3" % i for i in range(4)]
+    lines = files[:2] + ["a/" * 2046 + "xyz"] + files[2:]
+    expected = ["./" + f for f in files]
+    return files, lines, expected
+
+def unikey_case():
+    # names differing in Unicode form, case or separators share a key, the
+    # file found is delivered with its name as on disk
+    files = ["A/Caf\u00e9.mp3", "A/\u00dcber Song.mp3"]
+    lines = [unicodedata.normalize("NFD", "B/Caf\u00e9.mp3"), "B/\u00dcBER_SONG.mp3"]
+    expected = ["./A/Caf\u00e9.mp3", "./A/\u00dcber Song.mp3"]
+    return files, lines, expected
+
+def rank_case():
+    # of several files of the name, search takes the one sharing most folders
+    # with the entry (case folded); equal ones go to the nearest search folder
+    # and the entry is reported ambiguous
+    files = ["Artist A/Album/CD1/01 - Intro.mp3", "Artist B/Album/CD1/01 - Intro.mp3",
+             "Far/x.mp3", "../other/x.mp3"]
+    lines = ["Music/Artist B/Album/cd1/01 - Intro.mp3",
+             "Music/Artist A/album/cd1/01 - Intro.mp3", "zzz/x.mp3"]
+    expected = ["./Artist B/Album/CD1/01 - Intro.mp3",
+                "./Artist A/Album/CD1/01 - Intro.mp3", "./Far/x.mp3"]
+    report = ["2: ./Artist B/Album/CD1/01 - Intro.mp3",
+              "2: ./Artist A/Album/CD1/01 - Intro.mp3",
+              "2: ./Far/x.mp3", "?: AMBIGUOUS, OTHER FILES MATCH AS WELL"]
+    return files, lines, expected, report
+
+DUPES_FILES = ["A/a.mp3", "A/b.mp3"]
+DUPES_LINES = ["#EXTM3U", "#EXTINF:1,a", "A/a.mp3", "A/b.mp3", "#EXTINF:1,a again", "x/A/a.mp3"]
+
+def dupes_case():
+    # an entry of a file met before in the playlist is reported and kept
+    expected = ["#EXTM3U", "#EXTINF:1,a", "./A/a.mp3", "./A/b.mp3", "#EXTINF:1,a again", "./A/a.mp3"]
+    report = ["D: DUPLICATE OF LINE 3", "DUPLICATES: 1 WITHIN, 0 ACROSS PLAYLISTS"]
+    return DUPES_FILES, DUPES_LINES, expected, report
+
+def dedupe_case():
+    # with '--dedupe' the repeat is left out, along with its #EXTINF line
+    expected = ["#EXTM3U", "#EXTINF:1,a", "./A/a.mp3", "./A/b.mp3"]
+    report = ["D: DUPLICATE OF LINE 3, LEFT OUT", "DUPLICATES: 1 WITHIN, 0 ACROSS PLAYLISTS",
+              "1 OF THEM LEFT OUT."]
+    return DUPES_FILES, DUPES_LINES, expected, report
+
+def id3v1(title, artist, album):
+    # a file of no audio with an ID3v1.1 tag, fields padded as taggers do
+    return (b"\0" * 500 + b"TAG" + title.ljust(30, b"\0") + artist.ljust(30, b" ") +
+            album.ljust(30, b"\0") + b"1999" + b"\0" * 29 + b"\x03\xff")
+
+def extinf_case():
+    # with '--extinf' an entry without #EXTINF line gets one from its tag, an
+    # untagged one none, and one kept from the playlist stays as it is
+    files = [("a.mp3", id3v1(b"My Title", b"The Band", b"Album")),
+             ("d 01.mp3", id3v1(b"", b"", b"Album")), "b.mp3", "c.mp3"]
+    lines = ["#EXTM3U", "a.mp3", "d 01.mp3", "#EXTINF:5,kept", "b.mp3", "c.mp3"]
+    expected = ["#EXTM3U", "#EXTINF:-1,The Band - My Title", "./a.mp3",
+                "#EXTINF:-1,d 01", "./d 01.mp3", "#EXTINF:5,kept", "./b.mp3", "./c.mp3"]
+    return files, lines, expected
+
+CASES = [
+    # name, options, case
+    ("long comment", [], long_comment_case),
+    ("long comment -j", ["-j", "3"], long_comment_case),
+    ("long comment incremental", ["--incremental"], long_comment_case),
+    ("long entry", [], long_entry_case),
+    ("moved", [], moved_case),
+    ("moved fingerprint", ["--fingerprint"], moved_case),
+    ("unikey", [], unikey_case),
+    ("rank", [], rank_case),
+    ("dupes", ["--dupes"], dupes_case),
+    ("dedupe", ["--dedupe"], dedupe_case),
+    ("extinf", ["--extinf"], extinf_case),
+    ]
+
+def make_files(folder, files):
+    for f in files:
+        # a file is a name, empty then, or a name with its content
+        f, data = (f, b"") if isinstance(f, str) else f
+        os.makedirs(os.path.dirname(os.path.join(folder, f)), exist_ok=True)
+        with open(os.path.join(folder, f), "wb") as out:
+            out.write(data)
+
+def serve_check(relm3u, folder):
+    # RESOLVE answers the reported method and whether the match is ambiguous,
+    # CONVERT the counts and the converted playlist, nothing is written
+    make_files(folder, ["A/sx.mp3", "Far/sz.mp3", "../other/sz.mp3"])
+    playlist = os.path.join(folder, "p.m3u")
+    data = b"B/sx.mp3\nzzz/sz.mp3\nnone.mp3\n"
+    with open(playlist, "wb") as f:
+        f.write(data)
+    sock = os.path.join(os.path.dirname(folder), "s")
+    server = subprocess.Popen([relm3u, folder + "/", "--serve=" + sock],
+                              stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    got = []
+    try:
+        c = socket.socket(socket.AF_UNIX)
+        for i in range(100):
+            try:
+                c.connect(sock)
+                break
+            except OSError:
+                time.sleep(0.1)
+        else:
+            return ["server did not come up"]
+        f = c.makefile("rb")
+        for request in ["RESOLVE\t%s\tB/sx.mp3" % playlist, "RESOLVE\t%s\tzzz/sz.mp3" % playlist,
+                        "RESOLVE\t%s" % playlist]:
+            c.sendall(request.encode() + b"\n")
+            got.append(f.readline())
+        c.sendall(b"CONVERT\t%s\t%d\n" % (playlist.encode(), len(data)) + data)
+        got.append(f.readline())
+        got.append(f.read(int(got[-1].split(b"\t")[-1])) if got[-1].startswith(b"OK") else b"")
+        c.close()
+    finally:
+        server.send_signal(signal.SIGINT)
+        try:
+            server.wait(timeout=10)
+        except subprocess.TimeoutExpired:
+            server.kill()
+            server.wait()
+    expected = [b"OK\t2\t0\t./A/sx.mp3\n", b"OK\t2\t1\t./Far/sz.mp3\n", b"ERR\tBAD RESOLVE\n",
+                b"OK\t2\t3\t24\n", b"./A/sx.mp3\n./Far/sz.mp3\n"]
+    problems = ["reply %d: %r, expected %r" % (i + 1, g, e)
+                for i, (g, e) in enumerate(zip(got, expected)) if g != e]
+    if(len(got) != len(expected)):
+        problems.append("%d replies, expected %d" % (len(got), len(expected)))
+    with open(playlist, "rb") as f:
+        if(f.read() != data):
+            problems.append("playlist written")
+    return problems
+
+def batch_check(relm3u, folder):
+    # '--batch', given after another option, reads playlist paths from stdin
+    # and prints one JSON line per playlist; exit code 1 as one failed
+    make_files(folder, ["A/bx.mp3", "A/by.mp3"])
+    with open(os.path.join(folder, "p.m3u"), "w") as f:
+        f.write("B/bx.mp3\nnone.mp3\nA/bx.mp3\n")
+    with open(os.path.join(folder, "q.m3u"), "w") as f:
+        f.write("by.mp3\n")
+    run = subprocess.run([relm3u, "--dupes", "--batch"], cwd=folder, input="p.m3u\nq.m3u\nmissing.m3u\n",
+                         stdout=subprocess.PIPE, stderr=subprocess.PIPE, universal_newlines=True)
+    expected = [
+        '{"playlist":"p.m3u","ok":true,"found":2,"total":3,"entries":['
+        '{"line":1,"method":2,"path":"./A/bx.mp3"},{"line":2,"method":0,"path":"/none.mp3"},'
+        '{"line":3,"method":1,"duplicate_of":1,"path":"./A/bx.mp3"}],"missing":["/none.mp3"]}',
+        '{"playlist":"q.m3u","ok":true,"found":1,"total":1,"entries":['
+        '{"line":1,"method":2,"path":"./A/by.mp3"}],"missing":[]}',
+        '{"playlist":"missing.m3u","ok":false,"found":0,"total":0,"entries":[],"missing":[]}']
+    got = run.stdout.splitlines()
+    problems = ["line %d: %r, expected %r" % (i + 1, g, e)
+                for i, (g, e) in enumerate(zip(got, expected)) if g != e]
+    if(len(got) != len(expected)):
+        problems.append("%d lines, expected %d" % (len(got), len(expected)))
+    if(run.returncode != 1):
+        problems.append("exit code %d, expected 1" % run.returncode)
+    return problems
+
+CHECKS = [
+    # name, check
+    ("serve", serve_check),
+    ("batch", batch_check),
+    ]
+
+def run_check(relm3u, workdir, name, check):
+    folder = os.path.join(workdir, name.replace(" ", "_"), "lib")
+    os.makedirs(folder)
+    problems = check(relm3u, folder)
+    if(problems):
+        print("FAIL  %s" % name)
+        for p in problems:
+            print("      %s" % p)
+        return False
+    print("ok    %s" % name)
+    return True
+
+def run_case(relm3u, workdir, name, options, case):
+    # two folders deep, so the folders searched above it lie in workdir
+    folder = os.path.join(workdir, name.replace(" ", "_"), "lib")
+    os.makedirs(folder)
+    files, lines, expected, *report = case()
+    make_files(folder, files)
+    playlist = os.path.join(folder, "p.m3u")
+    with open(playlist, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+    run = subprocess.run([relm3u, playlist, "-s"] + options, stdout=subprocess.PIPE,
+                         stderr=subprocess.STDOUT, encoding="utf-8", errors="replace")
+    with open(playlist, encoding="utf-8") as f:
+        got = f.read().splitlines()
+    # index files are written in the folder submitted, never above it
+    above = [f for d in (os.path.dirname(folder), workdir)
+             for f in os.listdir(d) if f.startswith(".relm3u.")]
+    if(above):
+        print("FAIL  %s, written above the playlist folder: %s" % (name, " ".join(above)))
+        return False
+    shown = [l for l in run.stdout.splitlines() if l in report[0]] if report else []
+    if(report and shown != report[0]):
+        print("FAIL  %s, report shows %r, expected %r" % (name, shown, report[0]))
+        return False
+    if(run.returncode != 0 or got != expected):
+        print("FAIL  %s (exit code %d)" % (name, run.returncode))
+        for i in range(max(len(got), len(expected))):
+            g = got[i] if i < len(got) else "<none>"
+            e = expected[i] if i < len(expected) else "<none>"
+            if(g != e):
+                print("      line %d: %r, expected %r" % (i + 1, g[:60], e[:60]))
+        return False
+    print("ok    %s" % name)
+    return True
+
+def main():
+    parser = argparse.ArgumentParser(description="regression checks of relm3u")
+    parser.add_argument("--relm3u", required=True, help="relm3u executable")
+    args = parser.parse_args()
+    relm3u = os.path.abspath(args.relm3u)
+    workdir = tempfile.mkdtemp(prefix="relm3u-regress-")
+    try:
+        results = [run_case(relm3u, workdir, *c) for c in CASES]
+        results += [run_check(relm3u, workdir, *c) for c in CHECKS]
+    finally:
+        shutil.rmtree(workdir)
+    failed = results.count(False)
+    print("%d of %d cases failed" % (failed, len(results)))
+    return 1 if failed else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
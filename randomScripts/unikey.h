@@ -0,0 +1,1441 @@
+// generated by mkunikey.py from Unicode 14.0.0, do not edit
+// normalised filename keys: case folding, canonical decomposition, separators
+
+#define UNIKEY_UNICODE  "14.0.0"
+#define UNIKEY_MAXSEQ   4     // longest mapping of one code point
+
+// ASCII: folded character, ' ' for separators, 0 to drop
+static const unsigned char unikey_ascii[128] =
+{
+      0,   1,   2,   3,   4,   5,   6,   7,   8,  32,  32,  32,  32,  32,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+     32,  33,  34,  35,  36,  37,  38,   0,  32,  32,  42,  43,  32,  32,  32,  47,
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  32,  32,  60,  61,  62,  63,
+     64,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  32,  92,  32,  94,  32,
+      0,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,  32, 124,  32, 126, 127,
+};
+
+// code points with a mapping, ascending; mapping i is unikey_seq[unikey_ofs[i] .. unikey_ofs[i+1]]
+static const uint32_t unikey_cps[3317] =
+{
+    0x00A0, 0x00B4, 0x00B5, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4,
+    0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC,
+    0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4,
+    0x00D5, 0x00D6, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD,
+    0x00DE, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5,
+    0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE,
+    0x00EF, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F9,
+    0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FF, 0x0100, 0x0101, 0x0102,
+    0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A,
+    0x010B, 0x010C, 0x010D, 0x010E, 0x010F, 0x0110, 0x0112, 0x0113,
+    0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B,
+    0x011C, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123,
+    0x0124, 0x0125, 0x0126, 0x0128, 0x0129, 0x012A, 0x012B, 0x012C,
+    0x012D, 0x012E, 0x012F, 0x0130, 0x0132, 0x0134, 0x0135, 0x0136,
+    0x0137, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F,
+    0x0141, 0x0143, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149,
+    0x014A, 0x014C, 0x014D, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152,
+    0x0154, 0x0155, 0x0156, 0x0157, 0x0158, 0x0159, 0x015A, 0x015B,
+    0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0161, 0x0162, 0x0163,
+    0x0164, 0x0165, 0x0166, 0x0168, 0x0169, 0x016A, 0x016B, 0x016C,
+    0x016D, 0x016E, 0x016F, 0x0170, 0x0171, 0x0172, 0x0173, 0x0174,
+    0x0175, 0x0176, 0x0177, 0x0178, 0x0179, 0x017A, 0x017B, 0x017C,
+    0x017D, 0x017E, 0x017F, 0x0181, 0x0182, 0x0184, 0x0186, 0x0187,
+    0x0189, 0x018A, 0x018B, 0x018E, 0x018F, 0x0190, 0x0191, 0x0193,
+    0x0194, 0x0196, 0x0197, 0x0198, 0x019C, 0x019D, 0x019F, 0x01A0,
+    0x01A1, 0x01A2, 0x01A4, 0x01A6, 0x01A7, 0x01A9, 0x01AC, 0x01AE,
+    0x01AF, 0x01B0, 0x01B1, 0x01B2, 0x01B3, 0x01B5, 0x01B7, 0x01B8,
+    0x01BC, 0x01C4, 0x01C5, 0x01C7, 0x01C8, 0x01CA, 0x01CB, 0x01CD,
+    0x01CE, 0x01CF, 0x01D0, 0x01D1, 0x01D2, 0x01D3, 0x01D4, 0x01D5,
+    0x01D6, 0x01D7, 0x01D8, 0x01D9, 0x01DA, 0x01DB, 0x01DC, 0x01DE,
+    0x01DF, 0x01E0, 0x01E1, 0x01E2, 0x01E3, 0x01E4, 0x01E6, 0x01E7,
+    0x01E8, 0x01E9, 0x01EA, 0x01EB, 0x01EC, 0x01ED, 0x01EE, 0x01EF,
+    0x01F0, 0x01F1, 0x01F2, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x01F8,
+    0x01F9, 0x01FA, 0x01FB, 0x01FC, 0x01FD, 0x01FE, 0x01FF, 0x0200,
+    0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207, 0x0208,
+    0x0209, 0x020A, 0x020B, 0x020C, 0x020D, 0x020E, 0x020F, 0x0210,
+    0x0211, 0x0212, 0x0213, 0x0214, 0x0215, 0x0216, 0x0217, 0x0218,
+    0x0219, 0x021A, 0x021B, 0x021C, 0x021E, 0x021F, 0x0220, 0x0222,
+    0x0224, 0x0226, 0x0227, 0x0228, 0x0229, 0x022A, 0x022B, 0x022C,
+    0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0233, 0x023A,
+    0x023B, 0x023D, 0x023E, 0x0241, 0x0243, 0x0244, 0x0245, 0x0246,
+    0x0248, 0x024A, 0x024C, 0x024E, 0x02BC, 0x0340, 0x0341, 0x0343,
+    0x0344, 0x0345, 0x0370, 0x0372, 0x0374, 0x0376, 0x037E, 0x037F,
+    0x0385, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038C, 0x038E,
+    0x038F, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396,
+    0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E,
+    0x039F, 0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7,
+    0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+    0x03B0, 0x03C2, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03CF,
+    0x03D0, 0x03D1, 0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D8, 0x03DA,
+    0x03DC, 0x03DE, 0x03E0, 0x03E2, 0x03E4, 0x03E6, 0x03E8, 0x03EA,
+    0x03EC, 0x03EE, 0x03F0, 0x03F1, 0x03F4, 0x03F5, 0x03F7, 0x03F9,
+    0x03FA, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403,
+    0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B,
+    0x040C, 0x040D, 0x040E, 0x040F, 0x0410, 0x0411, 0x0412, 0x0413,
+    0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B,
+    0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422, 0x0423,
+    0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B,
+    0x042C, 0x042D, 0x042E, 0x042F, 0x0439, 0x0450, 0x0451, 0x0453,
+    0x0457, 0x045C, 0x045D, 0x045E, 0x0460, 0x0462, 0x0464, 0x0466,
+    0x0468, 0x046A, 0x046C, 0x046E, 0x0470, 0x0472, 0x0474, 0x0476,
+    0x0477, 0x0478, 0x047A, 0x047C, 0x047E, 0x0480, 0x048A, 0x048C,
+    0x048E, 0x0490, 0x0492, 0x0494, 0x0496, 0x0498, 0x049A, 0x049C,
+    0x049E, 0x04A0, 0x04A2, 0x04A4, 0x04A6, 0x04A8, 0x04AA, 0x04AC,
+    0x04AE, 0x04B0, 0x04B2, 0x04B4, 0x04B6, 0x04B8, 0x04BA, 0x04BC,
+    0x04BE, 0x04C0, 0x04C1, 0x04C2, 0x04C3, 0x04C5, 0x04C7, 0x04C9,
+    0x04CB, 0x04CD, 0x04D0, 0x04D1, 0x04D2, 0x04D3, 0x04D4, 0x04D6,
+    0x04D7, 0x04D8, 0x04DA, 0x04DB, 0x04DC, 0x04DD, 0x04DE, 0x04DF,
+    0x04E0, 0x04E2, 0x04E3, 0x04E4, 0x04E5, 0x04E6, 0x04E7, 0x04E8,
+    0x04EA, 0x04EB, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1,
+    0x04F2, 0x04F3, 0x04F4, 0x04F5, 0x04F6, 0x04F8, 0x04F9, 0x04FA,
+    0x04FC, 0x04FE, 0x0500, 0x0502, 0x0504, 0x0506, 0x0508, 0x050A,
+    0x050C, 0x050E, 0x0510, 0x0512, 0x0514, 0x0516, 0x0518, 0x051A,
+    0x051C, 0x051E, 0x0520, 0x0522, 0x0524, 0x0526, 0x0528, 0x052A,
+    0x052C, 0x052E, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0536,
+    0x0537, 0x0538, 0x0539, 0x053A, 0x053B, 0x053C, 0x053D, 0x053E,
+    0x053F, 0x0540, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546,
+    0x0547, 0x0548, 0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E,
+    0x054F, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554, 0x0555, 0x0556,
+    0x0587, 0x058A, 0x05BE, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626,
+    0x06C0, 0x06C2, 0x06D3, 0x0929, 0x0931, 0x0934, 0x0958, 0x0959,
+    0x095A, 0x095B, 0x095C, 0x095D, 0x095E, 0x095F, 0x09CB, 0x09CC,
+    0x09DC, 0x09DD, 0x09DF, 0x0A33, 0x0A36, 0x0A59, 0x0A5A, 0x0A5B,
+    0x0A5E, 0x0B48, 0x0B4B, 0x0B4C, 0x0B5C, 0x0B5D, 0x0B94, 0x0BCA,
+    0x0BCB, 0x0BCC, 0x0C48, 0x0CC0, 0x0CC7, 0x0CC8, 0x0CCA, 0x0CCB,
+    0x0D4A, 0x0D4B, 0x0D4C, 0x0DDA, 0x0DDC, 0x0DDD, 0x0DDE, 0x0F3A,
+    0x0F3B, 0x0F3C, 0x0F3D, 0x0F43, 0x0F4D, 0x0F52, 0x0F57, 0x0F5C,
+    0x0F69, 0x0F73, 0x0F75, 0x0F76, 0x0F78, 0x0F81, 0x0F93, 0x0F9D,
+    0x0FA2, 0x0FA7, 0x0FAC, 0x0FB9, 0x1026, 0x10A0, 0x10A1, 0x10A2,
+    0x10A3, 0x10A4, 0x10A5, 0x10A6, 0x10A7, 0x10A8, 0x10A9, 0x10AA,
+    0x10AB, 0x10AC, 0x10AD, 0x10AE, 0x10AF, 0x10B0, 0x10B1, 0x10B2,
+    0x10B3, 0x10B4, 0x10B5, 0x10B6, 0x10B7, 0x10B8, 0x10B9, 0x10BA,
+    0x10BB, 0x10BC, 0x10BD, 0x10BE, 0x10BF, 0x10C0, 0x10C1, 0x10C2,
+    0x10C3, 0x10C4, 0x10C5, 0x10C7, 0x10CD, 0x13F8, 0x13F9, 0x13FA,
+    0x13FB, 0x13FC, 0x13FD, 0x1400, 0x1680, 0x169B, 0x169C, 0x1806,
+    0x1B06, 0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D,
+    0x1B40, 0x1B41, 0x1B43, 0x1C80, 0x1C81, 0x1C82, 0x1C83, 0x1C84,
+    0x1C85, 0x1C86, 0x1C87, 0x1C88, 0x1C90, 0x1C91, 0x1C92, 0x1C93,
+    0x1C94, 0x1C95, 0x1C96, 0x1C97, 0x1C98, 0x1C99, 0x1C9A, 0x1C9B,
+    0x1C9C, 0x1C9D, 0x1C9E, 0x1C9F, 0x1CA0, 0x1CA1, 0x1CA2, 0x1CA3,
+    0x1CA4, 0x1CA5, 0x1CA6, 0x1CA7, 0x1CA8, 0x1CA9, 0x1CAA, 0x1CAB,
+    0x1CAC, 0x1CAD, 0x1CAE, 0x1CAF, 0x1CB0, 0x1CB1, 0x1CB2, 0x1CB3,
+    0x1CB4, 0x1CB5, 0x1CB6, 0x1CB7, 0x1CB8, 0x1CB9, 0x1CBA, 0x1CBD,
+    0x1CBE, 0x1CBF, 0x1E00, 0x1E01, 0x1E02, 0x1E03, 0x1E04, 0x1E05,
+    0x1E06, 0x1E07, 0x1E08, 0x1E09, 0x1E0A, 0x1E0B, 0x1E0C, 0x1E0D,
+    0x1E0E, 0x1E0F, 0x1E10, 0x1E11, 0x1E12, 0x1E13, 0x1E14, 0x1E15,
+    0x1E16, 0x1E17, 0x1E18, 0x1E19, 0x1E1A, 0x1E1B, 0x1E1C, 0x1E1D,
+    0x1E1E, 0x1E1F, 0x1E20, 0x1E21, 0x1E22, 0x1E23, 0x1E24, 0x1E25,
+    0x1E26, 0x1E27, 0x1E28, 0x1E29, 0x1E2A, 0x1E2B, 0x1E2C, 0x1E2D,
+    0x1E2E, 0x1E2F, 0x1E30, 0x1E31, 0x1E32, 0x1E33, 0x1E34, 0x1E35,
+    0x1E36, 0x1E37, 0x1E38, 0x1E39, 0x1E3A, 0x1E3B, 0x1E3C, 0x1E3D,
+    0x1E3E, 0x1E3F, 0x1E40, 0x1E41, 0x1E42, 0x1E43, 0x1E44, 0x1E45,
+    0x1E46, 0x1E47, 0x1E48, 0x1E49, 0x1E4A, 0x1E4B, 0x1E4C, 0x1E4D,
+    0x1E4E, 0x1E4F, 0x1E50, 0x1E51, 0x1E52, 0x1E53, 0x1E54, 0x1E55,
+    0x1E56, 0x1E57, 0x1E58, 0x1E59, 0x1E5A, 0x1E5B, 0x1E5C, 0x1E5D,
+    0x1E5E, 0x1E5F, 0x1E60, 0x1E61, 0x1E62, 0x1E63, 0x1E64, 0x1E65,
+    0x1E66, 0x1E67, 0x1E68, 0x1E69, 0x1E6A, 0x1E6B, 0x1E6C, 0x1E6D,
+    0x1E6E, 0x1E6F, 0x1E70, 0x1E71, 0x1E72, 0x1E73, 0x1E74, 0x1E75,
+    0x1E76, 0x1E77, 0x1E78, 0x1E79, 0x1E7A, 0x1E7B, 0x1E7C, 0x1E7D,
+    0x1E7E, 0x1E7F, 0x1E80, 0x1E81, 0x1E82, 0x1E83, 0x1E84, 0x1E85,
+    0x1E86, 0x1E87, 0x1E88, 0x1E89, 0x1E8A, 0x1E8B, 0x1E8C, 0x1E8D,
+    0x1E8E, 0x1E8F, 0x1E90, 0x1E91, 0x1E92, 0x1E93, 0x1E94, 0x1E95,
+    0x1E96, 0x1E97, 0x1E98, 0x1E99, 0x1E9A, 0x1E9B, 0x1E9E, 0x1EA0,
+    0x1EA1, 0x1EA2, 0x1EA3, 0x1EA4, 0x1EA5, 0x1EA6, 0x1EA7, 0x1EA8,
+    0x1EA9, 0x1EAA, 0x1EAB, 0x1EAC, 0x1EAD, 0x1EAE, 0x1EAF, 0x1EB0,
+    0x1EB1, 0x1EB2, 0x1EB3, 0x1EB4, 0x1EB5, 0x1EB6, 0x1EB7, 0x1EB8,
+    0x1EB9, 0x1EBA, 0x1EBB, 0x1EBC, 0x1EBD, 0x1EBE, 0x1EBF, 0x1EC0,
+    0x1EC1, 0x1EC2, 0x1EC3, 0x1EC4, 0x1EC5, 0x1EC6, 0x1EC7, 0x1EC8,
+    0x1EC9, 0x1ECA, 0x1ECB, 0x1ECC, 0x1ECD, 0x1ECE, 0x1ECF, 0x1ED0,
+    0x1ED1, 0x1ED2, 0x1ED3, 0x1ED4, 0x1ED5, 0x1ED6, 0x1ED7, 0x1ED8,
+    0x1ED9, 0x1EDA, 0x1EDB, 0x1EDC, 0x1EDD, 0x1EDE, 0x1EDF, 0x1EE0,
+    0x1EE1, 0x1EE2, 0x1EE3, 0x1EE4, 0x1EE5, 0x1EE6, 0x1EE7, 0x1EE8,
+    0x1EE9, 0x1EEA, 0x1EEB, 0x1EEC, 0x1EED, 0x1EEE, 0x1EEF, 0x1EF0,
+    0x1EF1, 0x1EF2, 0x1EF3, 0x1EF4, 0x1EF5, 0x1EF6, 0x1EF7, 0x1EF8,
+    0x1EF9, 0x1EFA, 0x1EFC, 0x1EFE, 0x1F00, 0x1F01, 0x1F02, 0x1F03,
+    0x1F04, 0x1F05, 0x1F06, 0x1F07, 0x1F08, 0x1F09, 0x1F0A, 0x1F0B,
+    0x1F0C, 0x1F0D, 0x1F0E, 0x1F0F, 0x1F10, 0x1F11, 0x1F12, 0x1F13,
+    0x1F14, 0x1F15, 0x1F18, 0x1F19, 0x1F1A, 0x1F1B, 0x1F1C, 0x1F1D,
+    0x1F20, 0x1F21, 0x1F22, 0x1F23, 0x1F24, 0x1F25, 0x1F26, 0x1F27,
+    0x1F28, 0x1F29, 0x1F2A, 0x1F2B, 0x1F2C, 0x1F2D, 0x1F2E, 0x1F2F,
+    0x1F30, 0x1F31, 0x1F32, 0x1F33, 0x1F34, 0x1F35, 0x1F36, 0x1F37,
+    0x1F38, 0x1F39, 0x1F3A, 0x1F3B, 0x1F3C, 0x1F3D, 0x1F3E, 0x1F3F,
+    0x1F40, 0x1F41, 0x1F42, 0x1F43, 0x1F44, 0x1F45, 0x1F48, 0x1F49,
+    0x1F4A, 0x1F4B, 0x1F4C, 0x1F4D, 0x1F50, 0x1F51, 0x1F52, 0x1F53,
+    0x1F54, 0x1F55, 0x1F56, 0x1F57, 0x1F59, 0x1F5B, 0x1F5D, 0x1F5F,
+    0x1F60, 0x1F61, 0x1F62, 0x1F63, 0x1F64, 0x1F65, 0x1F66, 0x1F67,
+    0x1F68, 0x1F69, 0x1F6A, 0x1F6B, 0x1F6C, 0x1F6D, 0x1F6E, 0x1F6F,
+    0x1F70, 0x1F71, 0x1F72, 0x1F73, 0x1F74, 0x1F75, 0x1F76, 0x1F77,
+    0x1F78, 0x1F79, 0x1F7A, 0x1F7B, 0x1F7C, 0x1F7D, 0x1F80, 0x1F81,
+    0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F88, 0x1F89,
+    0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F90, 0x1F91,
+    0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97, 0x1F98, 0x1F99,
+    0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1FA0, 0x1FA1,
+    0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7, 0x1FA8, 0x1FA9,
+    0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FB0, 0x1FB1,
+    0x1FB2, 0x1FB3, 0x1FB4, 0x1FB6, 0x1FB7, 0x1FB8, 0x1FB9, 0x1FBA,
+    0x1FBB, 0x1FBC, 0x1FBE, 0x1FC1, 0x1FC2, 0x1FC3, 0x1FC4, 0x1FC6,
+    0x1FC7, 0x1FC8, 0x1FC9, 0x1FCA, 0x1FCB, 0x1FCC, 0x1FCD, 0x1FCE,
+    0x1FCF, 0x1FD0, 0x1FD1, 0x1FD2, 0x1FD3, 0x1FD6, 0x1FD7, 0x1FD8,
+    0x1FD9, 0x1FDA, 0x1FDB, 0x1FDD, 0x1FDE, 0x1FDF, 0x1FE0, 0x1FE1,
+    0x1FE2, 0x1FE3, 0x1FE4, 0x1FE5, 0x1FE6, 0x1FE7, 0x1FE8, 0x1FE9,
+    0x1FEA, 0x1FEB, 0x1FEC, 0x1FED, 0x1FEE, 0x1FEF, 0x1FF2, 0x1FF3,
+    0x1FF4, 0x1FF6, 0x1FF7, 0x1FF8, 0x1FF9, 0x1FFA, 0x1FFB, 0x1FFC,
+    0x1FFD, 0x2000, 0x2001, 0x2002, 0x2003, 0x2004, 0x2005, 0x2006,
+    0x2007, 0x2008, 0x2009, 0x200A, 0x2010, 0x2011, 0x2012, 0x2013,
+    0x2014, 0x2015, 0x2018, 0x2019, 0x201A, 0x201E, 0x2028, 0x2029,
+    0x202F, 0x2045, 0x2046, 0x205F, 0x207D, 0x207E, 0x208D, 0x208E,
+    0x2126, 0x212A, 0x212B, 0x2132, 0x2160, 0x2161, 0x2162, 0x2163,
+    0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x216A, 0x216B,
+    0x216C, 0x216D, 0x216E, 0x216F, 0x2183, 0x219A, 0x219B, 0x21AE,
+    0x21CD, 0x21CE, 0x21CF, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226,
+    0x2241, 0x2244, 0x2247, 0x2249, 0x2260, 0x2262, 0x226D, 0x226E,
+    0x226F, 0x2270, 0x2271, 0x2274, 0x2275, 0x2278, 0x2279, 0x2280,
+    0x2281, 0x2284, 0x2285, 0x2288, 0x2289, 0x22AC, 0x22AD, 0x22AE,
+    0x22AF, 0x22E0, 0x22E1, 0x22E2, 0x22E3, 0x22EA, 0x22EB, 0x22EC,
+    0x22ED, 0x2308, 0x2309, 0x230A, 0x230B, 0x2329, 0x232A, 0x24B6,
+    0x24B7, 0x24B8, 0x24B9, 0x24BA, 0x24BB, 0x24BC, 0x24BD, 0x24BE,
+    0x24BF, 0x24C0, 0x24C1, 0x24C2, 0x24C3, 0x24C4, 0x24C5, 0x24C6,
+    0x24C7, 0x24C8, 0x24C9, 0x24CA, 0x24CB, 0x24CC, 0x24CD, 0x24CE,
+    0x24CF, 0x2768, 0x2769, 0x276A, 0x276B, 0x276C, 0x276D, 0x276E,
+    0x276F, 0x2770, 0x2771, 0x2772, 0x2773, 0x2774, 0x2775, 0x27C5,
+    0x27C6, 0x27E6, 0x27E7, 0x27E8, 0x27E9, 0x27EA, 0x27EB, 0x27EC,
+    0x27ED, 0x27EE, 0x27EF, 0x2983, 0x2984, 0x2985, 0x2986, 0x2987,
+    0x2988, 0x2989, 0x298A, 0x298B, 0x298C, 0x298D, 0x298E, 0x298F,
+    0x2990, 0x2991, 0x2992, 0x2993, 0x2994, 0x2995, 0x2996, 0x2997,
+    0x2998, 0x29D8, 0x29D9, 0x29DA, 0x29DB, 0x29FC, 0x29FD, 0x2ADC,
+    0x2C00, 0x2C01, 0x2C02, 0x2C03, 0x2C04, 0x2C05, 0x2C06, 0x2C07,
+    0x2C08, 0x2C09, 0x2C0A, 0x2C0B, 0x2C0C, 0x2C0D, 0x2C0E, 0x2C0F,
+    0x2C10, 0x2C11, 0x2C12, 0x2C13, 0x2C14, 0x2C15, 0x2C16, 0x2C17,
+    0x2C18, 0x2C19, 0x2C1A, 0x2C1B, 0x2C1C, 0x2C1D, 0x2C1E, 0x2C1F,
+    0x2C20, 0x2C21, 0x2C22, 0x2C23, 0x2C24, 0x2C25, 0x2C26, 0x2C27,
+    0x2C28, 0x2C29, 0x2C2A, 0x2C2B, 0x2C2C, 0x2C2D, 0x2C2E, 0x2C2F,
+    0x2C60, 0x2C62, 0x2C63, 0x2C64, 0x2C67, 0x2C69, 0x2C6B, 0x2C6D,
+    0x2C6E, 0x2C6F, 0x2C70, 0x2C72, 0x2C75, 0x2C7E, 0x2C7F, 0x2C80,
+    0x2C82, 0x2C84, 0x2C86, 0x2C88, 0x2C8A, 0x2C8C, 0x2C8E, 0x2C90,
+    0x2C92, 0x2C94, 0x2C96, 0x2C98, 0x2C9A, 0x2C9C, 0x2C9E, 0x2CA0,
+    0x2CA2, 0x2CA4, 0x2CA6, 0x2CA8, 0x2CAA, 0x2CAC, 0x2CAE, 0x2CB0,
+    0x2CB2, 0x2CB4, 0x2CB6, 0x2CB8, 0x2CBA, 0x2CBC, 0x2CBE, 0x2CC0,
+    0x2CC2, 0x2CC4, 0x2CC6, 0x2CC8, 0x2CCA, 0x2CCC, 0x2CCE, 0x2CD0,
+    0x2CD2, 0x2CD4, 0x2CD6, 0x2CD8, 0x2CDA, 0x2CDC, 0x2CDE, 0x2CE0,
+    0x2CE2, 0x2CEB, 0x2CED, 0x2CF2, 0x2E17, 0x2E1A, 0x2E22, 0x2E23,
+    0x2E24, 0x2E25, 0x2E26, 0x2E27, 0x2E28, 0x2E29, 0x2E3A, 0x2E3B,
+    0x2E40, 0x2E42, 0x2E55, 0x2E56, 0x2E57, 0x2E58, 0x2E59, 0x2E5A,
+    0x2E5B, 0x2E5C, 0x2E5D, 0x3000, 0x3008, 0x3009, 0x300A, 0x300B,
+    0x300C, 0x300D, 0x300E, 0x300F, 0x3010, 0x3011, 0x3014, 0x3015,
+    0x3016, 0x3017, 0x3018, 0x3019, 0x301A, 0x301B, 0x301C, 0x301D,
+    0x301E, 0x301F, 0x3030, 0x304C, 0x304E, 0x3050, 0x3052, 0x3054,
+    0x3056, 0x3058, 0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3065,
+    0x3067, 0x3069, 0x3070, 0x3071, 0x3073, 0x3074, 0x3076, 0x3077,
+    0x3079, 0x307A, 0x307C, 0x307D, 0x3094, 0x309E, 0x30A0, 0x30AC,
+    0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC,
+    0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7, 0x30C9, 0x30D0, 0x30D1,
+    0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9, 0x30DA, 0x30DC, 0x30DD,
+    0x30F4, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE, 0xA640, 0xA642,
+    0xA644, 0xA646, 0xA648, 0xA64A, 0xA64C, 0xA64E, 0xA650, 0xA652,
+    0xA654, 0xA656, 0xA658, 0xA65A, 0xA65C, 0xA65E, 0xA660, 0xA662,
+    0xA664, 0xA666, 0xA668, 0xA66A, 0xA66C, 0xA680, 0xA682, 0xA684,
+    0xA686, 0xA688, 0xA68A, 0xA68C, 0xA68E, 0xA690, 0xA692, 0xA694,
+    0xA696, 0xA698, 0xA69A, 0xA722, 0xA724, 0xA726, 0xA728, 0xA72A,
+    0xA72C, 0xA72E, 0xA732, 0xA734, 0xA736, 0xA738, 0xA73A, 0xA73C,
+    0xA73E, 0xA740, 0xA742, 0xA744, 0xA746, 0xA748, 0xA74A, 0xA74C,
+    0xA74E, 0xA750, 0xA752, 0xA754, 0xA756, 0xA758, 0xA75A, 0xA75C,
+    0xA75E, 0xA760, 0xA762, 0xA764, 0xA766, 0xA768, 0xA76A, 0xA76C,
+    0xA76E, 0xA779, 0xA77B, 0xA77D, 0xA77E, 0xA780, 0xA782, 0xA784,
+    0xA786, 0xA78B, 0xA78D, 0xA790, 0xA792, 0xA796, 0xA798, 0xA79A,
+    0xA79C, 0xA79E, 0xA7A0, 0xA7A2, 0xA7A4, 0xA7A6, 0xA7A8, 0xA7AA,
+    0xA7AB, 0xA7AC, 0xA7AD, 0xA7AE, 0xA7B0, 0xA7B1, 0xA7B2, 0xA7B3,
+    0xA7B4, 0xA7B6, 0xA7B8, 0xA7BA, 0xA7BC, 0xA7BE, 0xA7C0, 0xA7C2,
+    0xA7C4, 0xA7C5, 0xA7C6, 0xA7C7, 0xA7C9, 0xA7D0, 0xA7D6, 0xA7D8,
+    0xA7F5, 0xAB70, 0xAB71, 0xAB72, 0xAB73, 0xAB74, 0xAB75, 0xAB76,
+    0xAB77, 0xAB78, 0xAB79, 0xAB7A, 0xAB7B, 0xAB7C, 0xAB7D, 0xAB7E,
+    0xAB7F, 0xAB80, 0xAB81, 0xAB82, 0xAB83, 0xAB84, 0xAB85, 0xAB86,
+    0xAB87, 0xAB88, 0xAB89, 0xAB8A, 0xAB8B, 0xAB8C, 0xAB8D, 0xAB8E,
+    0xAB8F, 0xAB90, 0xAB91, 0xAB92, 0xAB93, 0xAB94, 0xAB95, 0xAB96,
+    0xAB97, 0xAB98, 0xAB99, 0xAB9A, 0xAB9B, 0xAB9C, 0xAB9D, 0xAB9E,
+    0xAB9F, 0xABA0, 0xABA1, 0xABA2, 0xABA3, 0xABA4, 0xABA5, 0xABA6,
+    0xABA7, 0xABA8, 0xABA9, 0xABAA, 0xABAB, 0xABAC, 0xABAD, 0xABAE,
+    0xABAF, 0xABB0, 0xABB1, 0xABB2, 0xABB3, 0xABB4, 0xABB5, 0xABB6,
+    0xABB7, 0xABB8, 0xABB9, 0xABBA, 0xABBB, 0xABBC, 0xABBD, 0xABBE,
+    0xABBF, 0xF900, 0xF901, 0xF902, 0xF903, 0xF904, 0xF905, 0xF906,
+    0xF907, 0xF908, 0xF909, 0xF90A, 0xF90B, 0xF90C, 0xF90D, 0xF90E,
+    0xF90F, 0xF910, 0xF911, 0xF912, 0xF913, 0xF914, 0xF915, 0xF916,
+    0xF917, 0xF918, 0xF919, 0xF91A, 0xF91B, 0xF91C, 0xF91D, 0xF91E,
+    0xF91F, 0xF920, 0xF921, 0xF922, 0xF923, 0xF924, 0xF925, 0xF926,
+    0xF927, 0xF928, 0xF929, 0xF92A, 0xF92B, 0xF92C, 0xF92D, 0xF92E,
+    0xF92F, 0xF930, 0xF931, 0xF932, 0xF933, 0xF934, 0xF935, 0xF936,
+    0xF937, 0xF938, 0xF939, 0xF93A, 0xF93B, 0xF93C, 0xF93D, 0xF93E,
+    0xF93F, 0xF940, 0xF941, 0xF942, 0xF943, 0xF944, 0xF945, 0xF946,
+    0xF947, 0xF948, 0xF949, 0xF94A, 0xF94B, 0xF94C, 0xF94D, 0xF94E,
+    0xF94F, 0xF950, 0xF951, 0xF952, 0xF953, 0xF954, 0xF955, 0xF956,
+    0xF957, 0xF958, 0xF959, 0xF95A, 0xF95B, 0xF95C, 0xF95D, 0xF95E,
+    0xF95F, 0xF960, 0xF961, 0xF962, 0xF963, 0xF964, 0xF965, 0xF966,
+    0xF967, 0xF968, 0xF969, 0xF96A, 0xF96B, 0xF96C, 0xF96D, 0xF96E,
+    0xF96F, 0xF970, 0xF971, 0xF972, 0xF973, 0xF974, 0xF975, 0xF976,
+    0xF977, 0xF978, 0xF979, 0xF97A, 0xF97B, 0xF97C, 0xF97D, 0xF97E,
+    0xF97F, 0xF980, 0xF981, 0xF982, 0xF983, 0xF984, 0xF985, 0xF986,
+    0xF987, 0xF988, 0xF989, 0xF98A, 0xF98B, 0xF98C, 0xF98D, 0xF98E,
+    0xF98F, 0xF990, 0xF991, 0xF992, 0xF993, 0xF994, 0xF995, 0xF996,
+    0xF997, 0xF998, 0xF999, 0xF99A, 0xF99B, 0xF99C, 0xF99D, 0xF99E,
+    0xF99F, 0xF9A0, 0xF9A1, 0xF9A2, 0xF9A3, 0xF9A4, 0xF9A5, 0xF9A6,
+    0xF9A7, 0xF9A8, 0xF9A9, 0xF9AA, 0xF9AB, 0xF9AC, 0xF9AD, 0xF9AE,
+    0xF9AF, 0xF9B0, 0xF9B1, 0xF9B2, 0xF9B3, 0xF9B4, 0xF9B5, 0xF9B6,
+    0xF9B7, 0xF9B8, 0xF9B9, 0xF9BA, 0xF9BB, 0xF9BC, 0xF9BD, 0xF9BE,
+    0xF9BF, 0xF9C0, 0xF9C1, 0xF9C2, 0xF9C3, 0xF9C4, 0xF9C5, 0xF9C6,
+    0xF9C7, 0xF9C8, 0xF9C9, 0xF9CA, 0xF9CB, 0xF9CC, 0xF9CD, 0xF9CE,
+    0xF9CF, 0xF9D0, 0xF9D1, 0xF9D2, 0xF9D3, 0xF9D4, 0xF9D5, 0xF9D6,
+    0xF9D7, 0xF9D8, 0xF9D9, 0xF9DA, 0xF9DB, 0xF9DC, 0xF9DD, 0xF9DE,
+    0xF9DF, 0xF9E0, 0xF9E1, 0xF9E2, 0xF9E3, 0xF9E4, 0xF9E5, 0xF9E6,
+    0xF9E7, 0xF9E8, 0xF9E9, 0xF9EA, 0xF9EB, 0xF9EC, 0xF9ED, 0xF9EE,
+    0xF9EF, 0xF9F0, 0xF9F1, 0xF9F2, 0xF9F3, 0xF9F4, 0xF9F5, 0xF9F6,
+    0xF9F7, 0xF9F8, 0xF9F9, 0xF9FA, 0xF9FB, 0xF9FC, 0xF9FD, 0xF9FE,
+    0xF9FF, 0xFA00, 0xFA01, 0xFA02, 0xFA03, 0xFA04, 0xFA05, 0xFA06,
+    0xFA07, 0xFA08, 0xFA09, 0xFA0A, 0xFA0B, 0xFA0C, 0xFA0D, 0xFA10,
+    0xFA12, 0xFA15, 0xFA16, 0xFA17, 0xFA18, 0xFA19, 0xFA1A, 0xFA1B,
+    0xFA1C, 0xFA1D, 0xFA1E, 0xFA20, 0xFA22, 0xFA25, 0xFA26, 0xFA2A,
+    0xFA2B, 0xFA2C, 0xFA2D, 0xFA2E, 0xFA2F, 0xFA30, 0xFA31, 0xFA32,
+    0xFA33, 0xFA34, 0xFA35, 0xFA36, 0xFA37, 0xFA38, 0xFA39, 0xFA3A,
+    0xFA3B, 0xFA3C, 0xFA3D, 0xFA3E, 0xFA3F, 0xFA40, 0xFA41, 0xFA42,
+    0xFA43, 0xFA44, 0xFA45, 0xFA46, 0xFA47, 0xFA48, 0xFA49, 0xFA4A,
+    0xFA4B, 0xFA4C, 0xFA4D, 0xFA4E, 0xFA4F, 0xFA50, 0xFA51, 0xFA52,
+    0xFA53, 0xFA54, 0xFA55, 0xFA56, 0xFA57, 0xFA58, 0xFA59, 0xFA5A,
+    0xFA5B, 0xFA5C, 0xFA5D, 0xFA5E, 0xFA5F, 0xFA60, 0xFA61, 0xFA62,
+    0xFA63, 0xFA64, 0xFA65, 0xFA66, 0xFA67, 0xFA68, 0xFA69, 0xFA6A,
+    0xFA6B, 0xFA6C, 0xFA6D, 0xFA70, 0xFA71, 0xFA72, 0xFA73, 0xFA74,
+    0xFA75, 0xFA76, 0xFA77, 0xFA78, 0xFA79, 0xFA7A, 0xFA7B, 0xFA7C,
+    0xFA7D, 0xFA7E, 0xFA7F, 0xFA80, 0xFA81, 0xFA82, 0xFA83, 0xFA84,
+    0xFA85, 0xFA86, 0xFA87, 0xFA88, 0xFA89, 0xFA8A, 0xFA8B, 0xFA8C,
+    0xFA8D, 0xFA8E, 0xFA8F, 0xFA90, 0xFA91, 0xFA92, 0xFA93, 0xFA94,
+    0xFA95, 0xFA96, 0xFA97, 0xFA98, 0xFA99, 0xFA9A, 0xFA9B, 0xFA9C,
+    0xFA9D, 0xFA9E, 0xFA9F, 0xFAA0, 0xFAA1, 0xFAA2, 0xFAA3, 0xFAA4,
+    0xFAA5, 0xFAA6, 0xFAA7, 0xFAA8, 0xFAA9, 0xFAAA, 0xFAAB, 0xFAAC,
+    0xFAAD, 0xFAAE, 0xFAAF, 0xFAB0, 0xFAB1, 0xFAB2, 0xFAB3, 0xFAB4,
+    0xFAB5, 0xFAB6, 0xFAB7, 0xFAB8, 0xFAB9, 0xFABA, 0xFABB, 0xFABC,
+    0xFABD, 0xFABE, 0xFABF, 0xFAC0, 0xFAC1, 0xFAC2, 0xFAC3, 0xFAC4,
+    0xFAC5, 0xFAC6, 0xFAC7, 0xFAC8, 0xFAC9, 0xFACA, 0xFACB, 0xFACC,
+    0xFACD, 0xFACE, 0xFACF, 0xFAD0, 0xFAD1, 0xFAD2, 0xFAD3, 0xFAD4,
+    0xFAD5, 0xFAD6, 0xFAD7, 0xFAD8, 0xFAD9, 0xFB00, 0xFB01, 0xFB02,
+    0xFB03, 0xFB04, 0xFB05, 0xFB06, 0xFB13, 0xFB14, 0xFB15, 0xFB16,
+    0xFB17, 0xFB1D, 0xFB1F, 0xFB2A, 0xFB2B, 0xFB2C, 0xFB2D, 0xFB2E,
+    0xFB2F, 0xFB30, 0xFB31, 0xFB32, 0xFB33, 0xFB34, 0xFB35, 0xFB36,
+    0xFB38, 0xFB39, 0xFB3A, 0xFB3B, 0xFB3C, 0xFB3E, 0xFB40, 0xFB41,
+    0xFB43, 0xFB44, 0xFB46, 0xFB47, 0xFB48, 0xFB49, 0xFB4A, 0xFB4B,
+    0xFB4C, 0xFB4D, 0xFB4E, 0xFD3E, 0xFD3F, 0xFE17, 0xFE18, 0xFE31,
+    0xFE32, 0xFE35, 0xFE36, 0xFE37, 0xFE38, 0xFE39, 0xFE3A, 0xFE3B,
+    0xFE3C, 0xFE3D, 0xFE3E, 0xFE3F, 0xFE40, 0xFE41, 0xFE42, 0xFE43,
+    0xFE44, 0xFE47, 0xFE48, 0xFE58, 0xFE59, 0xFE5A, 0xFE5B, 0xFE5C,
+    0xFE5D, 0xFE5E, 0xFE63, 0xFF08, 0xFF09, 0xFF0D, 0xFF21, 0xFF22,
+    0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A,
+    0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30, 0xFF31, 0xFF32,
+    0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A,
+    0xFF3B, 0xFF3D, 0xFF5B, 0xFF5D, 0xFF5F, 0xFF60, 0xFF62, 0xFF63,
+    0x10400, 0x10401, 0x10402, 0x10403, 0x10404, 0x10405, 0x10406, 0x10407,
+    0x10408, 0x10409, 0x1040A, 0x1040B, 0x1040C, 0x1040D, 0x1040E, 0x1040F,
+    0x10410, 0x10411, 0x10412, 0x10413, 0x10414, 0x10415, 0x10416, 0x10417,
+    0x10418, 0x10419, 0x1041A, 0x1041B, 0x1041C, 0x1041D, 0x1041E, 0x1041F,
+    0x10420, 0x10421, 0x10422, 0x10423, 0x10424, 0x10425, 0x10426, 0x10427,
+    0x104B0, 0x104B1, 0x104B2, 0x104B3, 0x104B4, 0x104B5, 0x104B6, 0x104B7,
+    0x104B8, 0x104B9, 0x104BA, 0x104BB, 0x104BC, 0x104BD, 0x104BE, 0x104BF,
+    0x104C0, 0x104C1, 0x104C2, 0x104C3, 0x104C4, 0x104C5, 0x104C6, 0x104C7,
+    0x104C8, 0x104C9, 0x104CA, 0x104CB, 0x104CC, 0x104CD, 0x104CE, 0x104CF,
+    0x104D0, 0x104D1, 0x104D2, 0x104D3, 0x10570, 0x10571, 0x10572, 0x10573,
+    0x10574, 0x10575, 0x10576, 0x10577, 0x10578, 0x10579, 0x1057A, 0x1057C,
+    0x1057D, 0x1057E, 0x1057F, 0x10580, 0x10581, 0x10582, 0x10583, 0x10584,
+    0x10585, 0x10586, 0x10587, 0x10588, 0x10589, 0x1058A, 0x1058C, 0x1058D,
+    0x1058E, 0x1058F, 0x10590, 0x10591, 0x10592, 0x10594, 0x10595, 0x10C80,
+    0x10C81, 0x10C82, 0x10C83, 0x10C84, 0x10C85, 0x10C86, 0x10C87, 0x10C88,
+    0x10C89, 0x10C8A, 0x10C8B, 0x10C8C, 0x10C8D, 0x10C8E, 0x10C8F, 0x10C90,
+    0x10C91, 0x10C92, 0x10C93, 0x10C94, 0x10C95, 0x10C96, 0x10C97, 0x10C98,
+    0x10C99, 0x10C9A, 0x10C9B, 0x10C9C, 0x10C9D, 0x10C9E, 0x10C9F, 0x10CA0,
+    0x10CA1, 0x10CA2, 0x10CA3, 0x10CA4, 0x10CA5, 0x10CA6, 0x10CA7, 0x10CA8,
+    0x10CA9, 0x10CAA, 0x10CAB, 0x10CAC, 0x10CAD, 0x10CAE, 0x10CAF, 0x10CB0,
+    0x10CB1, 0x10CB2, 0x10EAD, 0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F,
+    0x1134B, 0x1134C, 0x114BB, 0x114BC, 0x114BE, 0x115BA, 0x115BB, 0x118A0,
+    0x118A1, 0x118A2, 0x118A3, 0x118A4, 0x118A5, 0x118A6, 0x118A7, 0x118A8,
+    0x118A9, 0x118AA, 0x118AB, 0x118AC, 0x118AD, 0x118AE, 0x118AF, 0x118B0,
+    0x118B1, 0x118B2, 0x118B3, 0x118B4, 0x118B5, 0x118B6, 0x118B7, 0x118B8,
+    0x118B9, 0x118BA, 0x118BB, 0x118BC, 0x118BD, 0x118BE, 0x118BF, 0x11938,
+    0x16E40, 0x16E41, 0x16E42, 0x16E43, 0x16E44, 0x16E45, 0x16E46, 0x16E47,
+    0x16E48, 0x16E49, 0x16E4A, 0x16E4B, 0x16E4C, 0x16E4D, 0x16E4E, 0x16E4F,
+    0x16E50, 0x16E51, 0x16E52, 0x16E53, 0x16E54, 0x16E55, 0x16E56, 0x16E57,
+    0x16E58, 0x16E59, 0x16E5A, 0x16E5B, 0x16E5C, 0x16E5D, 0x16E5E, 0x16E5F,
+    0x1D15E, 0x1D15F, 0x1D160, 0x1D161, 0x1D162, 0x1D163, 0x1D164, 0x1D1BB,
+    0x1D1BC, 0x1D1BD, 0x1D1BE, 0x1D1BF, 0x1D1C0, 0x1E900, 0x1E901, 0x1E902,
+    0x1E903, 0x1E904, 0x1E905, 0x1E906, 0x1E907, 0x1E908, 0x1E909, 0x1E90A,
+    0x1E90B, 0x1E90C, 0x1E90D, 0x1E90E, 0x1E90F, 0x1E910, 0x1E911, 0x1E912,
+    0x1E913, 0x1E914, 0x1E915, 0x1E916, 0x1E917, 0x1E918, 0x1E919, 0x1E91A,
+    0x1E91B, 0x1E91C, 0x1E91D, 0x1E91E, 0x1E91F, 0x1E920, 0x1E921, 0x2F800,
+    0x2F801, 0x2F802, 0x2F803, 0x2F804, 0x2F805, 0x2F806, 0x2F807, 0x2F808,
+    0x2F809, 0x2F80A, 0x2F80B, 0x2F80C, 0x2F80D, 0x2F80E, 0x2F80F, 0x2F810,
+    0x2F811, 0x2F812, 0x2F813, 0x2F814, 0x2F815, 0x2F816, 0x2F817, 0x2F818,
+    0x2F819, 0x2F81A, 0x2F81B, 0x2F81C, 0x2F81D, 0x2F81E, 0x2F81F, 0x2F820,
+    0x2F821, 0x2F822, 0x2F823, 0x2F824, 0x2F825, 0x2F826, 0x2F827, 0x2F828,
+    0x2F829, 0x2F82A, 0x2F82B, 0x2F82C, 0x2F82D, 0x2F82E, 0x2F82F, 0x2F830,
+    0x2F831, 0x2F832, 0x2F833, 0x2F834, 0x2F835, 0x2F836, 0x2F837, 0x2F838,
+    0x2F839, 0x2F83A, 0x2F83B, 0x2F83C, 0x2F83D, 0x2F83E, 0x2F83F, 0x2F840,
+    0x2F841, 0x2F842, 0x2F843, 0x2F844, 0x2F845, 0x2F846, 0x2F847, 0x2F848,
+    0x2F849, 0x2F84A, 0x2F84B, 0x2F84C, 0x2F84D, 0x2F84E, 0x2F84F, 0x2F850,
+    0x2F851, 0x2F852, 0x2F853, 0x2F854, 0x2F855, 0x2F856, 0x2F857, 0x2F858,
+    0x2F859, 0x2F85A, 0x2F85B, 0x2F85C, 0x2F85D, 0x2F85E, 0x2F85F, 0x2F860,
+    0x2F861, 0x2F862, 0x2F863, 0x2F864, 0x2F865, 0x2F866, 0x2F867, 0x2F868,
+    0x2F869, 0x2F86A, 0x2F86B, 0x2F86C, 0x2F86D, 0x2F86E, 0x2F86F, 0x2F870,
+    0x2F871, 0x2F872, 0x2F873, 0x2F874, 0x2F875, 0x2F876, 0x2F877, 0x2F878,
+    0x2F879, 0x2F87A, 0x2F87B, 0x2F87C, 0x2F87D, 0x2F87E, 0x2F87F, 0x2F880,
+    0x2F881, 0x2F882, 0x2F883, 0x2F884, 0x2F885, 0x2F886, 0x2F887, 0x2F888,
+    0x2F889, 0x2F88A, 0x2F88B, 0x2F88C, 0x2F88D, 0x2F88E, 0x2F88F, 0x2F890,
+    0x2F891, 0x2F892, 0x2F893, 0x2F894, 0x2F895, 0x2F896, 0x2F897, 0x2F898,
+    0x2F899, 0x2F89A, 0x2F89B, 0x2F89C, 0x2F89D, 0x2F89E, 0x2F89F, 0x2F8A0,
+    0x2F8A1, 0x2F8A2, 0x2F8A3, 0x2F8A4, 0x2F8A5, 0x2F8A6, 0x2F8A7, 0x2F8A8,
+    0x2F8A9, 0x2F8AA, 0x2F8AB, 0x2F8AC, 0x2F8AD, 0x2F8AE, 0x2F8AF, 0x2F8B0,
+    0x2F8B1, 0x2F8B2, 0x2F8B3, 0x2F8B4, 0x2F8B5, 0x2F8B6, 0x2F8B7, 0x2F8B8,
+    0x2F8B9, 0x2F8BA, 0x2F8BB, 0x2F8BC, 0x2F8BD, 0x2F8BE, 0x2F8BF, 0x2F8C0,
+    0x2F8C1, 0x2F8C2, 0x2F8C3, 0x2F8C4, 0x2F8C5, 0x2F8C6, 0x2F8C7, 0x2F8C8,
+    0x2F8C9, 0x2F8CA, 0x2F8CB, 0x2F8CC, 0x2F8CD, 0x2F8CE, 0x2F8CF, 0x2F8D0,
+    0x2F8D1, 0x2F8D2, 0x2F8D3, 0x2F8D4, 0x2F8D5, 0x2F8D6, 0x2F8D7, 0x2F8D8,
+    0x2F8D9, 0x2F8DA, 0x2F8DB, 0x2F8DC, 0x2F8DD, 0x2F8DE, 0x2F8DF, 0x2F8E0,
+    0x2F8E1, 0x2F8E2, 0x2F8E3, 0x2F8E4, 0x2F8E5, 0x2F8E6, 0x2F8E7, 0x2F8E8,
+    0x2F8E9, 0x2F8EA, 0x2F8EB, 0x2F8EC, 0x2F8ED, 0x2F8EE, 0x2F8EF, 0x2F8F0,
+    0x2F8F1, 0x2F8F2, 0x2F8F3, 0x2F8F4, 0x2F8F5, 0x2F8F6, 0x2F8F7, 0x2F8F8,
+    0x2F8F9, 0x2F8FA, 0x2F8FB, 0x2F8FC, 0x2F8FD, 0x2F8FE, 0x2F8FF, 0x2F900,
+    0x2F901, 0x2F902, 0x2F903, 0x2F904, 0x2F905, 0x2F906, 0x2F907, 0x2F908,
+    0x2F909, 0x2F90A, 0x2F90B, 0x2F90C, 0x2F90D, 0x2F90E, 0x2F90F, 0x2F910,
+    0x2F911, 0x2F912, 0x2F913, 0x2F914, 0x2F915, 0x2F916, 0x2F917, 0x2F918,
+    0x2F919, 0x2F91A, 0x2F91B, 0x2F91C, 0x2F91D, 0x2F91E, 0x2F91F, 0x2F920,
+    0x2F921, 0x2F922, 0x2F923, 0x2F924, 0x2F925, 0x2F926, 0x2F927, 0x2F928,
+    0x2F929, 0x2F92A, 0x2F92B, 0x2F92C, 0x2F92D, 0x2F92E, 0x2F92F, 0x2F930,
+    0x2F931, 0x2F932, 0x2F933, 0x2F934, 0x2F935, 0x2F936, 0x2F937, 0x2F938,
+    0x2F939, 0x2F93A, 0x2F93B, 0x2F93C, 0x2F93D, 0x2F93E, 0x2F93F, 0x2F940,
+    0x2F941, 0x2F942, 0x2F943, 0x2F944, 0x2F945, 0x2F946, 0x2F947, 0x2F948,
+    0x2F949, 0x2F94A, 0x2F94B, 0x2F94C, 0x2F94D, 0x2F94E, 0x2F94F, 0x2F950,
+    0x2F951, 0x2F952, 0x2F953, 0x2F954, 0x2F955, 0x2F956, 0x2F957, 0x2F958,
+    0x2F959, 0x2F95A, 0x2F95B, 0x2F95C, 0x2F95D, 0x2F95E, 0x2F95F, 0x2F960,
+    0x2F961, 0x2F962, 0x2F963, 0x2F964, 0x2F965, 0x2F966, 0x2F967, 0x2F968,
+    0x2F969, 0x2F96A, 0x2F96B, 0x2F96C, 0x2F96D, 0x2F96E, 0x2F96F, 0x2F970,
+    0x2F971, 0x2F972, 0x2F973, 0x2F974, 0x2F975, 0x2F976, 0x2F977, 0x2F978,
+    0x2F979, 0x2F97A, 0x2F97B, 0x2F97C, 0x2F97D, 0x2F97E, 0x2F97F, 0x2F980,
+    0x2F981, 0x2F982, 0x2F983, 0x2F984, 0x2F985, 0x2F986, 0x2F987, 0x2F988,
+    0x2F989, 0x2F98A, 0x2F98B, 0x2F98C, 0x2F98D, 0x2F98E, 0x2F98F, 0x2F990,
+    0x2F991, 0x2F992, 0x2F993, 0x2F994, 0x2F995, 0x2F996, 0x2F997, 0x2F998,
+    0x2F999, 0x2F99A, 0x2F99B, 0x2F99C, 0x2F99D, 0x2F99E, 0x2F99F, 0x2F9A0,
+    0x2F9A1, 0x2F9A2, 0x2F9A3, 0x2F9A4, 0x2F9A5, 0x2F9A6, 0x2F9A7, 0x2F9A8,
+    0x2F9A9, 0x2F9AA, 0x2F9AB, 0x2F9AC, 0x2F9AD, 0x2F9AE, 0x2F9AF, 0x2F9B0,
+    0x2F9B1, 0x2F9B2, 0x2F9B3, 0x2F9B4, 0x2F9B5, 0x2F9B6, 0x2F9B7, 0x2F9B8,
+    0x2F9B9, 0x2F9BA, 0x2F9BB, 0x2F9BC, 0x2F9BD, 0x2F9BE, 0x2F9BF, 0x2F9C0,
+    0x2F9C1, 0x2F9C2, 0x2F9C3, 0x2F9C4, 0x2F9C5, 0x2F9C6, 0x2F9C7, 0x2F9C8,
+    0x2F9C9, 0x2F9CA, 0x2F9CB, 0x2F9CC, 0x2F9CD, 0x2F9CE, 0x2F9CF, 0x2F9D0,
+    0x2F9D1, 0x2F9D2, 0x2F9D3, 0x2F9D4, 0x2F9D5, 0x2F9D6, 0x2F9D7, 0x2F9D8,
+    0x2F9D9, 0x2F9DA, 0x2F9DB, 0x2F9DC, 0x2F9DD, 0x2F9DE, 0x2F9DF, 0x2F9E0,
+    0x2F9E1, 0x2F9E2, 0x2F9E3, 0x2F9E4, 0x2F9E5, 0x2F9E6, 0x2F9E7, 0x2F9E8,
+    0x2F9E9, 0x2F9EA, 0x2F9EB, 0x2F9EC, 0x2F9ED, 0x2F9EE, 0x2F9EF, 0x2F9F0,
+    0x2F9F1, 0x2F9F2, 0x2F9F3, 0x2F9F4, 0x2F9F5, 0x2F9F6, 0x2F9F7, 0x2F9F8,
+    0x2F9F9, 0x2F9FA, 0x2F9FB, 0x2F9FC, 0x2F9FD, 0x2F9FE, 0x2F9FF, 0x2FA00,
+    0x2FA01, 0x2FA02, 0x2FA03, 0x2FA04, 0x2FA05, 0x2FA06, 0x2FA07, 0x2FA08,
+    0x2FA09, 0x2FA0A, 0x2FA0B, 0x2FA0C, 0x2FA0D, 0x2FA0E, 0x2FA0F, 0x2FA10,
+    0x2FA11, 0x2FA12, 0x2FA13, 0x2FA14, 0x2FA15, 0x2FA16, 0x2FA17, 0x2FA18,
+    0x2FA19, 0x2FA1A, 0x2FA1B, 0x2FA1C, 0x2FA1D,
+};
+
+static const uint16_t unikey_ofs[3318] =
+{
+        0,     1,     1,     2,     4,     6,     8,    10,    12,    14,    15,    17,
+       19,    21,    23,    25,    27,    29,    31,    33,    34,    36,    38,    40,
+       42,    44,    46,    47,    49,    51,    53,    55,    57,    58,    60,    62,
+       64,    66,    68,    70,    72,    74,    76,    78,    80,    82,    84,    86,
+       88,    90,    92,    94,    96,    98,   100,   102,   104,   106,   108,   110,
+      112,   114,   116,   118,   120,   122,   124,   126,   128,   130,   132,   134,
+      136,   138,   140,   142,   144,   146,   147,   149,   151,   153,   155,   157,
+      159,   161,   163,   165,   167,   169,   171,   173,   175,   177,   179,   181,
+      183,   185,   187,   188,   190,   192,   194,   196,   198,   200,   202,   204,
+      206,   207,   209,   211,   213,   215,   217,   219,   221,   223,   225,   227,
+      228,   229,   231,   233,   235,   237,   239,   241,   242,   243,   245,   247,
+      249,   251,   253,   255,   256,   258,   260,   262,   264,   266,   268,   270,
+      272,   274,   276,   278,   280,   282,   284,   286,   288,   290,   292,   293,
+      295,   297,   299,   301,   303,   305,   307,   309,   311,   313,   315,   317,
+      319,   321,   323,   325,   327,   329,   331,   333,   335,   337,   339,   340,
+      341,   342,   343,   344,   345,   346,   347,   348,   349,   350,   351,   352,
+      353,   354,   355,   356,   357,   358,   359,   360,   362,   364,   365,   366,
+      367,   368,   369,   370,   371,   373,   375,   376,   377,   378,   379,   380,
+      381,   382,   383,   384,   385,   386,   387,   388,   390,   392,   394,   396,
+      398,   400,   402,   404,   407,   410,   413,   416,   419,   422,   425,   428,
+      431,   434,   437,   440,   442,   444,   445,   447,   449,   451,   453,   455,
+      457,   460,   463,   465,   467,   469,   470,   471,   473,   475,   476,   477,
+      479,   481,   484,   487,   489,   491,   493,   495,   497,   499,   501,   503,
+      505,   507,   509,   511,   513,   515,   517,   519,   521,   523,   525,   527,
+      529,   531,   533,   535,   537,   539,   541,   543,   545,   547,   549,   551,
+      552,   554,   556,   557,   558,   559,   561,   563,   565,   567,   570,   573,
+      576,   579,   581,   583,   586,   589,   591,   593,   594,   595,   596,   597,
+      598,   599,   600,   601,   602,   603,   604,   605,   606,   606,   607,   608,
+      609,   611,   612,   613,   614,   615,   616,   617,   618,   620,   622,   623,
+      625,   627,   629,   631,   633,   635,   638,   639,   640,   641,   642,   643,
+      644,   645,   646,   647,   648,   649,   650,   651,   652,   653,   654,   655,
+      656,   657,   658,   659,   660,   661,   662,   664,   666,   668,   670,   672,
+      674,   677,   678,   680,   682,   684,   686,   688,   689,   690,   691,   693,
+      695,   696,   697,   698,   699,   700,   701,   702,   703,   704,   705,   706,
+      707,   708,   709,   710,   711,   712,   713,   714,   715,   716,   717,   718,
+      719,   721,   723,   724,   726,   727,   728,   729,   731,   732,   733,   734,
+      735,   737,   739,   741,   742,   743,   744,   745,   746,   747,   748,   749,
+      750,   751,   753,   754,   755,   756,   757,   758,   759,   760,   761,   762,
+      763,   764,   765,   766,   767,   768,   769,   770,   771,   772,   773,   774,
+      775,   777,   779,   781,   783,   785,   787,   789,   791,   792,   793,   794,
+      795,   796,   797,   798,   799,   800,   801,   802,   804,   806,   807,   808,
+      809,   810,   811,   812,   813,   814,   815,   816,   817,   818,   819,   820,
+      821,   822,   823,   824,   825,   826,   827,   828,   829,   830,   831,   832,
+      833,   834,   835,   836,   837,   838,   839,   841,   843,   844,   845,   846,
+      847,   848,   849,   851,   853,   855,   857,   858,   860,   862,   863,   865,
+      867,   869,   871,   873,   875,   876,   878,   880,   882,   884,   886,   888,
+      889,   891,   893,   895,   897,   899,   901,   903,   905,   907,   909,   911,
+      913,   914,   916,   918,   919,   920,   921,   922,   923,   924,   925,   926,
+      927,   928,   929,   930,   931,   932,   933,   934,   935,   936,   937,   938,
+      939,   940,   941,   942,   943,   944,   945,   946,   947,   948,   949,   950,
+      951,   952,   953,   954,   955,   956,   957,   958,   959,   960,   961,   962,
+      963,   964,   965,   966,   967,   968,   969,   970,   971,   972,   973,   974,
+      975,   976,   977,   978,   979,   980,   981,   982,   983,   985,   986,   987,
+      989,   991,   993,   995,   997,   999,  1001,  1003,  1005,  1007,  1009,  1011,
+     1013,  1015,  1017,  1019,  1021,  1023,  1025,  1027,  1029,  1031,  1033,  1035,
+     1037,  1039,  1041,  1043,  1045,  1047,  1049,  1051,  1053,  1055,  1057,  1059,
+     1061,  1063,  1065,  1067,  1069,  1071,  1073,  1075,  1078,  1080,  1082,  1084,
+     1086,  1088,  1091,  1093,  1094,  1095,  1096,  1097,  1099,  1101,  1103,  1105,
+     1107,  1109,  1111,  1113,  1115,  1117,  1119,  1121,  1123,  1125,  1127,  1129,
+     1131,  1133,  1134,  1135,  1136,  1137,  1138,  1139,  1140,  1141,  1142,  1143,
+     1144,  1145,  1146,  1147,  1148,  1149,  1150,  1151,  1152,  1153,  1154,  1155,
+     1156,  1157,  1158,  1159,  1160,  1161,  1162,  1163,  1164,  1165,  1166,  1167,
+     1168,  1169,  1170,  1171,  1172,  1173,  1174,  1175,  1176,  1177,  1178,  1179,
+     1180,  1181,  1182,  1183,  1184,  1186,  1188,  1190,  1192,  1194,  1196,  1198,
+     1200,  1202,  1204,  1206,  1207,  1208,  1209,  1210,  1211,  1212,  1213,  1214,
+     1215,  1216,  1217,  1218,  1219,  1220,  1221,  1222,  1223,  1224,  1225,  1226,
+     1227,  1228,  1229,  1230,  1231,  1232,  1233,  1234,  1235,  1236,  1237,  1238,
+     1239,  1240,  1241,  1242,  1243,  1244,  1245,  1246,  1247,  1248,  1249,  1250,
+     1251,  1252,  1253,  1254,  1255,  1256,  1257,  1258,  1259,  1260,  1261,  1263,
+     1265,  1267,  1269,  1271,  1273,  1275,  1277,  1280,  1283,  1285,  1287,  1289,
+     1291,  1293,  1295,  1297,  1299,  1301,  1303,  1306,  1309,  1312,  1315,  1317,
+     1319,  1321,  1323,  1326,  1329,  1331,  1333,  1335,  1337,  1339,  1341,  1343,
+     1345,  1347,  1349,  1351,  1353,  1355,  1357,  1359,  1361,  1364,  1367,  1369,
+     1371,  1373,  1375,  1377,  1379,  1381,  1383,  1386,  1389,  1391,  1393,  1395,
+     1397,  1399,  1401,  1403,  1405,  1407,  1409,  1411,  1413,  1415,  1417,  1419,
+     1421,  1423,  1425,  1428,  1431,  1434,  1437,  1440,  1443,  1446,  1449,  1451,
+     1453,  1455,  1457,  1459,  1461,  1463,  1465,  1468,  1471,  1473,  1475,  1477,
+     1479,  1481,  1483,  1486,  1489,  1492,  1495,  1498,  1501,  1503,  1505,  1507,
+     1509,  1511,  1513,  1515,  1517,  1519,  1521,  1523,  1525,  1527,  1529,  1532,
+     1535,  1538,  1541,  1543,  1545,  1547,  1549,  1551,  1553,  1555,  1557,  1559,
+     1561,  1563,  1565,  1567,  1569,  1571,  1573,  1575,  1577,  1579,  1581,  1583,
+     1585,  1587,  1589,  1591,  1593,  1595,  1597,  1599,  1601,  1603,  1605,  1607,
+     1609,  1611,  1613,  1615,  1618,  1621,  1624,  1627,  1630,  1633,  1636,  1639,
+     1642,  1645,  1648,  1651,  1654,  1657,  1660,  1663,  1666,  1669,  1672,  1675,
+     1677,  1679,  1681,  1683,  1685,  1687,  1690,  1693,  1696,  1699,  1702,  1705,
+     1708,  1711,  1714,  1717,  1719,  1721,  1723,  1725,  1727,  1729,  1731,  1733,
+     1736,  1739,  1742,  1745,  1748,  1751,  1754,  1757,  1760,  1763,  1766,  1769,
+     1772,  1775,  1778,  1781,  1784,  1787,  1790,  1793,  1795,  1797,  1799,  1801,
+     1804,  1807,  1810,  1813,  1816,  1819,  1822,  1825,  1828,  1831,  1833,  1835,
+     1837,  1839,  1841,  1843,  1845,  1847,  1848,  1849,  1850,  1852,  1854,  1857,
+     1860,  1863,  1866,  1869,  1872,  1874,  1876,  1879,  1882,  1885,  1888,  1891,
+     1894,  1896,  1898,  1901,  1904,  1907,  1910,  1912,  1914,  1917,  1920,  1923,
+     1926,  1928,  1930,  1933,  1936,  1939,  1942,  1945,  1948,  1950,  1952,  1955,
+     1958,  1961,  1964,  1967,  1970,  1972,  1974,  1977,  1980,  1983,  1986,  1989,
+     1992,  1994,  1996,  1999,  2002,  2005,  2008,  2011,  2014,  2016,  2018,  2021,
+     2024,  2027,  2030,  2032,  2034,  2037,  2040,  2043,  2046,  2048,  2050,  2053,
+     2056,  2059,  2062,  2065,  2068,  2070,  2073,  2076,  2079,  2081,  2083,  2086,
+     2089,  2092,  2095,  2098,  2101,  2103,  2105,  2108,  2111,  2114,  2117,  2120,
+     2123,  2125,  2127,  2129,  2131,  2133,  2135,  2137,  2139,  2141,  2143,  2145,
+     2147,  2149,  2151,  2154,  2157,  2161,  2165,  2169,  2173,  2177,  2181,  2184,
+     2187,  2191,  2195,  2199,  2203,  2207,  2211,  2214,  2217,  2221,  2225,  2229,
+     2233,  2237,  2241,  2244,  2247,  2251,  2255,  2259,  2263,  2267,  2271,  2274,
+     2277,  2281,  2285,  2289,  2293,  2297,  2301,  2304,  2307,  2311,  2315,  2319,
+     2323,  2327,  2331,  2333,  2335,  2338,  2340,  2343,  2345,  2348,  2350,  2352,
+     2354,  2356,  2358,  2359,  2361,  2364,  2366,  2369,  2371,  2374,  2376,  2378,
+     2380,  2382,  2384,  2386,  2388,  2390,  2392,  2394,  2397,  2400,  2402,  2405,
+     2407,  2409,  2411,  2413,  2415,  2417,  2419,  2421,  2423,  2426,  2429,  2431,
+     2433,  2435,  2438,  2440,  2442,  2444,  2446,  2448,  2450,  2452,  2452,  2455,
+     2457,  2460,  2462,  2465,  2467,  2469,  2471,  2473,  2475,  2475,  2476,  2477,
+     2478,  2479,  2480,  2481,  2482,  2483,  2484,  2485,  2486,  2487,  2488,  2489,
+     2490,  2491,  2492,  2492,  2492,  2493,  2494,  2495,  2496,  2497,  2498,  2499,
+     2500,  2501,  2502,  2503,  2504,  2505,  2506,  2508,  2509,  2510,  2511,  2512,
+     2513,  2514,  2515,  2516,  2517,  2518,  2519,  2520,  2521,  2522,  2523,  2524,
+     2525,  2526,  2528,  2530,  2532,  2534,  2536,  2538,  2540,  2542,  2544,  2546,
+     2548,  2550,  2552,  2554,  2556,  2558,  2560,  2562,  2564,  2566,  2568,  2570,
+     2572,  2574,  2576,  2578,  2580,  2582,  2584,  2586,  2588,  2590,  2592,  2594,
+     2596,  2598,  2600,  2602,  2604,  2606,  2608,  2610,  2612,  2614,  2615,  2616,
+     2617,  2618,  2619,  2620,  2621,  2622,  2623,  2624,  2625,  2626,  2627,  2628,
+     2629,  2630,  2631,  2632,  2633,  2634,  2635,  2636,  2637,  2638,  2639,  2640,
+     2641,  2642,  2643,  2644,  2645,  2646,  2647,  2648,  2649,  2650,  2651,  2652,
+     2653,  2654,  2655,  2656,  2657,  2658,  2659,  2660,  2661,  2662,  2663,  2664,
+     2665,  2666,  2667,  2668,  2669,  2670,  2671,  2672,  2673,  2674,  2675,  2676,
+     2677,  2678,  2679,  2680,  2681,  2682,  2683,  2684,  2685,  2686,  2687,  2688,
+     2689,  2690,  2691,  2692,  2693,  2694,  2695,  2696,  2697,  2698,  2699,  2700,
+     2702,  2703,  2704,  2705,  2706,  2707,  2708,  2709,  2710,  2711,  2712,  2713,
+     2714,  2715,  2716,  2717,  2718,  2719,  2720,  2721,  2722,  2723,  2724,  2725,
+     2726,  2727,  2728,  2729,  2730,  2731,  2732,  2733,  2734,  2735,  2736,  2737,
+     2738,  2739,  2740,  2741,  2742,  2743,  2744,  2745,  2746,  2747,  2748,  2749,
+     2750,  2751,  2752,  2753,  2754,  2755,  2756,  2757,  2758,  2759,  2760,  2761,
+     2762,  2763,  2764,  2765,  2766,  2767,  2768,  2769,  2770,  2771,  2772,  2773,
+     2774,  2775,  2776,  2777,  2778,  2779,  2780,  2781,  2782,  2783,  2784,  2785,
+     2786,  2787,  2788,  2789,  2790,  2791,  2792,  2793,  2794,  2795,  2796,  2797,
+     2798,  2799,  2800,  2801,  2802,  2803,  2804,  2805,  2806,  2807,  2808,  2809,
+     2810,  2811,  2812,  2813,  2814,  2815,  2816,  2817,  2818,  2819,  2820,  2821,
+     2822,  2823,  2824,  2825,  2826,  2827,  2828,  2829,  2830,  2831,  2832,  2833,
+     2834,  2835,  2836,  2837,  2838,  2839,  2840,  2841,  2842,  2843,  2844,  2845,
+     2846,  2847,  2848,  2849,  2850,  2851,  2852,  2853,  2854,  2855,  2856,  2857,
+     2858,  2859,  2860,  2861,  2862,  2863,  2864,  2865,  2867,  2869,  2871,  2873,
+     2875,  2877,  2879,  2881,  2883,  2885,  2887,  2889,  2891,  2893,  2895,  2897,
+     2899,  2901,  2903,  2905,  2907,  2909,  2911,  2913,  2915,  2917,  2919,  2920,
+     2922,  2924,  2926,  2928,  2930,  2932,  2934,  2936,  2938,  2940,  2942,  2944,
+     2946,  2948,  2950,  2952,  2954,  2956,  2958,  2960,  2962,  2964,  2966,  2968,
+     2970,  2972,  2974,  2976,  2978,  2980,  2982,  2983,  2984,  2985,  2986,  2987,
+     2988,  2989,  2990,  2991,  2992,  2993,  2994,  2995,  2996,  2997,  2998,  2999,
+     3000,  3001,  3002,  3003,  3004,  3005,  3006,  3007,  3008,  3009,  3010,  3011,
+     3012,  3013,  3014,  3015,  3016,  3017,  3018,  3019,  3020,  3021,  3022,  3023,
+     3024,  3025,  3026,  3027,  3028,  3029,  3030,  3031,  3032,  3033,  3034,  3035,
+     3036,  3037,  3038,  3039,  3040,  3041,  3042,  3043,  3044,  3045,  3046,  3047,
+     3048,  3049,  3050,  3051,  3052,  3053,  3054,  3055,  3056,  3057,  3058,  3059,
+     3060,  3061,  3062,  3063,  3064,  3065,  3066,  3067,  3068,  3069,  3070,  3071,
+     3072,  3073,  3074,  3075,  3076,  3077,  3078,  3079,  3080,  3081,  3082,  3083,
+     3084,  3085,  3086,  3087,  3088,  3089,  3090,  3091,  3092,  3093,  3094,  3095,
+     3096,  3097,  3098,  3099,  3100,  3101,  3102,  3103,  3104,  3105,  3106,  3107,
+     3108,  3109,  3110,  3111,  3112,  3113,  3114,  3115,  3116,  3117,  3118,  3119,
+     3120,  3121,  3122,  3123,  3124,  3125,  3126,  3127,  3128,  3129,  3130,  3131,
+     3132,  3133,  3134,  3135,  3136,  3137,  3138,  3139,  3140,  3141,  3142,  3143,
+     3144,  3145,  3146,  3147,  3148,  3149,  3150,  3151,  3152,  3153,  3154,  3155,
+     3156,  3157,  3158,  3159,  3160,  3161,  3162,  3163,  3164,  3165,  3166,  3167,
+     3168,  3169,  3170,  3171,  3172,  3173,  3174,  3175,  3176,  3177,  3178,  3179,
+     3180,  3181,  3182,  3183,  3184,  3185,  3186,  3187,  3188,  3189,  3190,  3191,
+     3192,  3193,  3194,  3195,  3196,  3197,  3198,  3199,  3200,  3201,  3202,  3203,
+     3204,  3205,  3206,  3207,  3208,  3209,  3210,  3211,  3212,  3213,  3214,  3215,
+     3216,  3217,  3218,  3219,  3220,  3221,  3222,  3223,  3224,  3225,  3226,  3227,
+     3228,  3229,  3230,  3231,  3232,  3233,  3234,  3235,  3236,  3237,  3238,  3239,
+     3240,  3241,  3242,  3243,  3244,  3245,  3246,  3247,  3248,  3249,  3250,  3251,
+     3252,  3253,  3254,  3255,  3256,  3257,  3258,  3259,  3260,  3261,  3262,  3263,
+     3264,  3265,  3266,  3267,  3268,  3269,  3270,  3271,  3272,  3273,  3274,  3275,
+     3276,  3277,  3278,  3279,  3280,  3281,  3282,  3283,  3284,  3285,  3286,  3287,
+     3288,  3289,  3290,  3291,  3292,  3293,  3294,  3295,  3296,  3297,  3298,  3299,
+     3300,  3301,  3302,  3303,  3304,  3305,  3306,  3307,  3308,  3309,  3310,  3311,
+     3312,  3313,  3314,  3315,  3316,  3317,  3318,  3319,  3320,  3321,  3322,  3323,
+     3324,  3325,  3326,  3327,  3328,  3329,  3330,  3331,  3332,  3333,  3334,  3335,
+     3336,  3337,  3338,  3339,  3340,  3341,  3342,  3343,  3344,  3345,  3346,  3347,
+     3348,  3349,  3350,  3351,  3352,  3353,  3354,  3355,  3356,  3357,  3358,  3359,
+     3360,  3361,  3362,  3363,  3364,  3365,  3366,  3367,  3368,  3369,  3370,  3371,
+     3372,  3373,  3374,  3375,  3376,  3377,  3378,  3379,  3380,  3381,  3382,  3383,
+     3384,  3385,  3386,  3387,  3388,  3389,  3390,  3391,  3392,  3393,  3394,  3395,
+     3396,  3397,  3398,  3399,  3400,  3401,  3402,  3403,  3404,  3405,  3406,  3407,
+     3408,  3409,  3410,  3411,  3412,  3413,  3414,  3415,  3416,  3417,  3418,  3419,
+     3420,  3421,  3422,  3423,  3424,  3425,  3426,  3427,  3428,  3429,  3430,  3431,
+     3432,  3433,  3434,  3435,  3436,  3437,  3438,  3439,  3440,  3441,  3442,  3443,
+     3444,  3445,  3446,  3447,  3448,  3449,  3450,  3451,  3452,  3453,  3454,  3455,
+     3456,  3457,  3458,  3459,  3460,  3461,  3462,  3463,  3464,  3465,  3466,  3467,
+     3468,  3469,  3470,  3471,  3472,  3473,  3474,  3475,  3476,  3477,  3478,  3479,
+     3480,  3481,  3482,  3483,  3484,  3485,  3486,  3487,  3488,  3489,  3490,  3491,
+     3492,  3493,  3494,  3495,  3496,  3497,  3498,  3499,  3500,  3501,  3502,  3503,
+     3504,  3505,  3506,  3507,  3508,  3509,  3510,  3511,  3512,  3513,  3514,  3515,
+     3516,  3517,  3518,  3519,  3520,  3521,  3522,  3523,  3524,  3525,  3526,  3527,
+     3528,  3529,  3530,  3531,  3532,  3533,  3534,  3535,  3536,  3537,  3538,  3539,
+     3540,  3541,  3542,  3543,  3544,  3545,  3546,  3547,  3548,  3549,  3550,  3551,
+     3552,  3553,  3554,  3555,  3556,  3557,  3558,  3559,  3560,  3561,  3562,  3563,
+     3564,  3565,  3566,  3567,  3568,  3569,  3570,  3571,  3572,  3573,  3574,  3575,
+     3576,  3577,  3578,  3579,  3580,  3581,  3582,  3583,  3584,  3585,  3586,  3587,
+     3588,  3589,  3590,  3591,  3592,  3593,  3594,  3595,  3596,  3597,  3598,  3599,
+     3600,  3601,  3602,  3603,  3604,  3605,  3606,  3607,  3608,  3609,  3610,  3611,
+     3612,  3613,  3614,  3615,  3616,  3617,  3618,  3619,  3620,  3621,  3622,  3623,
+     3624,  3625,  3626,  3627,  3628,  3629,  3630,  3631,  3632,  3633,  3634,  3635,
+     3636,  3637,  3638,  3639,  3640,  3641,  3642,  3643,  3644,  3645,  3647,  3649,
+     3651,  3654,  3657,  3659,  3661,  3663,  3665,  3667,  3669,  3671,  3673,  3675,
+     3677,  3679,  3682,  3685,  3687,  3689,  3691,  3693,  3695,  3697,  3699,  3701,
+     3703,  3705,  3707,  3709,  3711,  3713,  3715,  3717,  3719,  3721,  3723,  3725,
+     3727,  3729,  3731,  3733,  3735,  3737,  3739,  3741,  3742,  3743,  3744,  3745,
+     3746,  3747,  3748,  3749,  3750,  3751,  3752,  3753,  3754,  3755,  3756,  3757,
+     3758,  3759,  3760,  3761,  3762,  3763,  3764,  3765,  3766,  3767,  3768,  3769,
+     3770,  3771,  3772,  3773,  3774,  3775,  3776,  3777,  3778,  3779,  3780,  3781,
+     3782,  3783,  3784,  3785,  3786,  3787,  3788,  3789,  3790,  3791,  3792,  3793,
+     3794,  3795,  3796,  3797,  3798,  3799,  3800,  3801,  3802,  3803,  3804,  3805,
+     3806,  3807,  3808,  3809,  3810,  3811,  3812,  3813,  3814,  3815,  3816,  3817,
+     3818,  3819,  3820,  3821,  3822,  3823,  3824,  3825,  3826,  3827,  3828,  3829,
+     3830,  3831,  3832,  3833,  3834,  3835,  3836,  3837,  3838,  3839,  3840,  3841,
+     3842,  3843,  3844,  3845,  3846,  3847,  3848,  3849,  3850,  3851,  3852,  3853,
+     3854,  3855,  3856,  3857,  3858,  3859,  3860,  3861,  3862,  3863,  3864,  3865,
+     3866,  3867,  3868,  3869,  3870,  3871,  3872,  3873,  3874,  3875,  3876,  3877,
+     3878,  3879,  3880,  3881,  3882,  3883,  3884,  3885,  3886,  3887,  3888,  3889,
+     3890,  3891,  3892,  3893,  3894,  3895,  3896,  3897,  3898,  3899,  3900,  3901,
+     3902,  3903,  3904,  3905,  3906,  3907,  3908,  3909,  3910,  3911,  3912,  3913,
+     3914,  3915,  3916,  3917,  3918,  3919,  3920,  3921,  3922,  3923,  3924,  3925,
+     3926,  3927,  3928,  3929,  3930,  3931,  3932,  3933,  3934,  3935,  3936,  3937,
+     3938,  3939,  3940,  3941,  3942,  3943,  3944,  3945,  3946,  3947,  3948,  3949,
+     3950,  3951,  3952,  3953,  3954,  3955,  3956,  3957,  3958,  3959,  3960,  3961,
+     3962,  3963,  3964,  3965,  3966,  3967,  3968,  3969,  3970,  3971,  3972,  3973,
+     3975,  3977,  3979,  3981,  3983,  3985,  3987,  3989,  3991,  3993,  3995,  3997,
+     3998,  3999,  4000,  4001,  4002,  4003,  4004,  4005,  4006,  4007,  4008,  4009,
+     4010,  4011,  4012,  4013,  4014,  4015,  4016,  4017,  4018,  4019,  4020,  4021,
+     4022,  4023,  4024,  4025,  4026,  4027,  4028,  4029,  4031,  4032,  4033,  4034,
+     4035,  4036,  4037,  4038,  4039,  4040,  4041,  4042,  4043,  4044,  4045,  4046,
+     4047,  4048,  4049,  4050,  4051,  4052,  4053,  4054,  4055,  4056,  4057,  4058,
+     4059,  4060,  4061,  4062,  4063,  4065,  4067,  4070,  4073,  4076,  4079,  4082,
+     4084,  4086,  4089,  4092,  4095,  4098,  4099,  4100,  4101,  4102,  4103,  4104,
+     4105,  4106,  4107,  4108,  4109,  4110,  4111,  4112,  4113,  4114,  4115,  4116,
+     4117,  4118,  4119,  4120,  4121,  4122,  4123,  4124,  4125,  4126,  4127,  4128,
+     4129,  4130,  4131,  4132,  4133,  4134,  4135,  4136,  4137,  4138,  4139,  4140,
+     4141,  4142,  4143,  4144,  4145,  4146,  4147,  4148,  4149,  4150,  4151,  4152,
+     4153,  4154,  4155,  4156,  4157,  4158,  4159,  4160,  4161,  4162,  4163,  4164,
+     4165,  4166,  4167,  4168,  4169,  4170,  4171,  4172,  4173,  4174,  4175,  4176,
+     4177,  4178,  4179,  4180,  4181,  4182,  4183,  4184,  4185,  4186,  4187,  4188,
+     4189,  4190,  4191,  4192,  4193,  4194,  4195,  4196,  4197,  4198,  4199,  4200,
+     4201,  4202,  4203,  4204,  4205,  4206,  4207,  4208,  4209,  4210,  4211,  4212,
+     4213,  4214,  4215,  4216,  4217,  4218,  4219,  4220,  4221,  4222,  4223,  4224,
+     4225,  4226,  4227,  4228,  4229,  4230,  4231,  4232,  4233,  4234,  4235,  4236,
+     4237,  4238,  4239,  4240,  4241,  4242,  4243,  4244,  4245,  4246,  4247,  4248,
+     4249,  4250,  4251,  4252,  4253,  4254,  4255,  4256,  4257,  4258,  4259,  4260,
+     4261,  4262,  4263,  4264,  4265,  4266,  4267,  4268,  4269,  4270,  4271,  4272,
+     4273,  4274,  4275,  4276,  4277,  4278,  4279,  4280,  4281,  4282,  4283,  4284,
+     4285,  4286,  4287,  4288,  4289,  4290,  4291,  4292,  4293,  4294,  4295,  4296,
+     4297,  4298,  4299,  4300,  4301,  4302,  4303,  4304,  4305,  4306,  4307,  4308,
+     4309,  4310,  4311,  4312,  4313,  4314,  4315,  4316,  4317,  4318,  4319,  4320,
+     4321,  4322,  4323,  4324,  4325,  4326,  4327,  4328,  4329,  4330,  4331,  4332,
+     4333,  4334,  4335,  4336,  4337,  4338,  4339,  4340,  4341,  4342,  4343,  4344,
+     4345,  4346,  4347,  4348,  4349,  4350,  4351,  4352,  4353,  4354,  4355,  4356,
+     4357,  4358,  4359,  4360,  4361,  4362,  4363,  4364,  4365,  4366,  4367,  4368,
+     4369,  4370,  4371,  4372,  4373,  4374,  4375,  4376,  4377,  4378,  4379,  4380,
+     4381,  4382,  4383,  4384,  4385,  4386,  4387,  4388,  4389,  4390,  4391,  4392,
+     4393,  4394,  4395,  4396,  4397,  4398,  4399,  4400,  4401,  4402,  4403,  4404,
+     4405,  4406,  4407,  4408,  4409,  4410,  4411,  4412,  4413,  4414,  4415,  4416,
+     4417,  4418,  4419,  4420,  4421,  4422,  4423,  4424,  4425,  4426,  4427,  4428,
+     4429,  4430,  4431,  4432,  4433,  4434,  4435,  4436,  4437,  4438,  4439,  4440,
+     4441,  4442,  4443,  4444,  4445,  4446,  4447,  4448,  4449,  4450,  4451,  4452,
+     4453,  4454,  4455,  4456,  4457,  4458,  4459,  4460,  4461,  4462,  4463,  4464,
+     4465,  4466,  4467,  4468,  4469,  4470,  4471,  4472,  4473,  4474,  4475,  4476,
+     4477,  4478,  4479,  4480,  4481,  4482,  4483,  4484,  4485,  4486,  4487,  4488,
+     4489,  4490,  4491,  4492,  4493,  4494,  4495,  4496,  4497,  4498,  4499,  4500,
+     4501,  4502,  4503,  4504,  4505,  4506,  4507,  4508,  4509,  4510,  4511,  4512,
+     4513,  4514,  4515,  4516,  4517,  4518,  4519,  4520,  4521,  4522,  4523,  4524,
+     4525,  4526,  4527,  4528,  4529,  4530,  4531,  4532,  4533,  4534,  4535,  4536,
+     4537,  4538,  4539,  4540,  4541,  4542,  4543,  4544,  4545,  4546,  4547,  4548,
+     4549,  4550,  4551,  4552,  4553,  4554,  4555,  4556,  4557,  4558,  4559,  4560,
+     4561,  4562,  4563,  4564,  4565,  4566,  4567,  4568,  4569,  4570,  4571,  4572,
+     4573,  4574,  4575,  4576,  4577,  4578,  4579,  4580,  4581,  4582,  4583,  4584,
+     4585,  4586,  4587,  4588,  4589,  4590,  4591,  4592,  4593,  4594,  4595,  4596,
+     4597,  4598,  4599,  4600,  4601,  4602,  4603,  4604,  4605,  4606,  4607,  4608,
+     4609,  4610,  4611,  4612,  4613,  4614,  4615,  4616,  4617,  4618,  4619,  4620,
+     4621,  4622,  4623,  4624,  4625,  4626,  4627,  4628,  4629,  4630,  4631,  4632,
+     4633,  4634,  4635,  4636,  4637,  4638,  4639,  4640,  4641,  4642,  4643,  4644,
+     4645,  4646,  4647,  4648,  4649,  4650,  4651,  4652,  4653,  4654,  4655,  4656,
+     4657,  4658,  4659,  4660,  4661,  4662,  4663,  4664,  4665,  4666,  4667,  4668,
+     4669,  4670,  4671,  4672,  4673,  4674,
+};
+
+static const uint32_t unikey_seq[4674] =
+{
+    0x0020, 0x03BC, 0x0061, 0x0300, 0x0061, 0x0301, 0x0061, 0x0302,
+    0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A, 0x00E6, 0x0063,
+    0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302, 0x0065,
+    0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069,
+    0x0308, 0x00F0, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+    0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x00F8, 0x0075,
+    0x0300, 0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079,
+    0x0301, 0x00FE, 0x0073, 0x0073, 0x0061, 0x0300, 0x0061, 0x0301,
+    0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A,
+    0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+    0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+    0x0069, 0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301,
+    0x006F, 0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300,
+    0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+    0x0079, 0x0308, 0x0061, 0x0304, 0x0061, 0x0304, 0x0061, 0x0306,
+    0x0061, 0x0306, 0x0061, 0x0328, 0x0061, 0x0328, 0x0063, 0x0301,
+    0x0063, 0x0301, 0x0063, 0x0302, 0x0063, 0x0302, 0x0063, 0x0307,
+    0x0063, 0x0307, 0x0063, 0x030C, 0x0063, 0x030C, 0x0064, 0x030C,
+    0x0064, 0x030C, 0x0111, 0x0065, 0x0304, 0x0065, 0x0304, 0x0065,
+    0x0306, 0x0065, 0x0306, 0x0065, 0x0307, 0x0065, 0x0307, 0x0065,
+    0x0328, 0x0065, 0x0328, 0x0065, 0x030C, 0x0065, 0x030C, 0x0067,
+    0x0302, 0x0067, 0x0302, 0x0067, 0x0306, 0x0067, 0x0306, 0x0067,
+    0x0307, 0x0067, 0x0307, 0x0067, 0x0327, 0x0067, 0x0327, 0x0068,
+    0x0302, 0x0068, 0x0302, 0x0127, 0x0069, 0x0303, 0x0069, 0x0303,
+    0x0069, 0x0304, 0x0069, 0x0304, 0x0069, 0x0306, 0x0069, 0x0306,
+    0x0069, 0x0328, 0x0069, 0x0328, 0x0069, 0x0307, 0x0133, 0x006A,
+    0x0302, 0x006A, 0x0302, 0x006B, 0x0327, 0x006B, 0x0327, 0x006C,
+    0x0301, 0x006C, 0x0301, 0x006C, 0x0327, 0x006C, 0x0327, 0x006C,
+    0x030C, 0x006C, 0x030C, 0x0140, 0x0142, 0x006E, 0x0301, 0x006E,
+    0x0301, 0x006E, 0x0327, 0x006E, 0x0327, 0x006E, 0x030C, 0x006E,
+    0x030C, 0x006E, 0x014B, 0x006F, 0x0304, 0x006F, 0x0304, 0x006F,
+    0x0306, 0x006F, 0x0306, 0x006F, 0x030B, 0x006F, 0x030B, 0x0153,
+    0x0072, 0x0301, 0x0072, 0x0301, 0x0072, 0x0327, 0x0072, 0x0327,
+    0x0072, 0x030C, 0x0072, 0x030C, 0x0073, 0x0301, 0x0073, 0x0301,
+    0x0073, 0x0302, 0x0073, 0x0302, 0x0073, 0x0327, 0x0073, 0x0327,
+    0x0073, 0x030C, 0x0073, 0x030C, 0x0074, 0x0327, 0x0074, 0x0327,
+    0x0074, 0x030C, 0x0074, 0x030C, 0x0167, 0x0075, 0x0303, 0x0075,
+    0x0303, 0x0075, 0x0304, 0x0075, 0x0304, 0x0075, 0x0306, 0x0075,
+    0x0306, 0x0075, 0x030A, 0x0075, 0x030A, 0x0075, 0x030B, 0x0075,
+    0x030B, 0x0075, 0x0328, 0x0075, 0x0328, 0x0077, 0x0302, 0x0077,
+    0x0302, 0x0079, 0x0302, 0x0079, 0x0302, 0x0079, 0x0308, 0x007A,
+    0x0301, 0x007A, 0x0301, 0x007A, 0x0307, 0x007A, 0x0307, 0x007A,
+    0x030C, 0x007A, 0x030C, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254,
+    0x0188, 0x0256, 0x0257, 0x018C, 0x01DD, 0x0259, 0x025B, 0x0192,
+    0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026F, 0x0272, 0x0275,
+    0x006F, 0x031B, 0x006F, 0x031B, 0x01A3, 0x01A5, 0x0280, 0x01A8,
+    0x0283, 0x01AD, 0x0288, 0x0075, 0x031B, 0x0075, 0x031B, 0x028A,
+    0x028B, 0x01B4, 0x01B6, 0x0292, 0x01B9, 0x01BD, 0x01C6, 0x01C6,
+    0x01C9, 0x01C9, 0x01CC, 0x01CC, 0x0061, 0x030C, 0x0061, 0x030C,
+    0x0069, 0x030C, 0x0069, 0x030C, 0x006F, 0x030C, 0x006F, 0x030C,
+    0x0075, 0x030C, 0x0075, 0x030C, 0x0075, 0x0308, 0x0304, 0x0075,
+    0x0308, 0x0304, 0x0075, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301,
+    0x0075, 0x0308, 0x030C, 0x0075, 0x0308, 0x030C, 0x0075, 0x0308,
+    0x0300, 0x0075, 0x0308, 0x0300, 0x0061, 0x0308, 0x0304, 0x0061,
+    0x0308, 0x0304, 0x0061, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304,
+    0x00E6, 0x0304, 0x00E6, 0x0304, 0x01E5, 0x0067, 0x030C, 0x0067,
+    0x030C, 0x006B, 0x030C, 0x006B, 0x030C, 0x006F, 0x0328, 0x006F,
+    0x0328, 0x006F, 0x0328, 0x0304, 0x006F, 0x0328, 0x0304, 0x0292,
+    0x030C, 0x0292, 0x030C, 0x006A, 0x030C, 0x01F3, 0x01F3, 0x0067,
+    0x0301, 0x0067, 0x0301, 0x0195, 0x01BF, 0x006E, 0x0300, 0x006E,
+    0x0300, 0x0061, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301, 0x00E6,
+    0x0301, 0x00E6, 0x0301, 0x00F8, 0x0301, 0x00F8, 0x0301, 0x0061,
+    0x030F, 0x0061, 0x030F, 0x0061, 0x0311, 0x0061, 0x0311, 0x0065,
+    0x030F, 0x0065, 0x030F, 0x0065, 0x0311, 0x0065, 0x0311, 0x0069,
+    0x030F, 0x0069, 0x030F, 0x0069, 0x0311, 0x0069, 0x0311, 0x006F,
+    0x030F, 0x006F, 0x030F, 0x006F, 0x0311, 0x006F, 0x0311, 0x0072,
+    0x030F, 0x0072, 0x030F, 0x0072, 0x0311, 0x0072, 0x0311, 0x0075,
+    0x030F, 0x0075, 0x030F, 0x0075, 0x0311, 0x0075, 0x0311, 0x0073,
+    0x0326, 0x0073, 0x0326, 0x0074, 0x0326, 0x0074, 0x0326, 0x021D,
+    0x0068, 0x030C, 0x0068, 0x030C, 0x019E, 0x0223, 0x0225, 0x0061,
+    0x0307, 0x0061, 0x0307, 0x0065, 0x0327, 0x0065, 0x0327, 0x006F,
+    0x0308, 0x0304, 0x006F, 0x0308, 0x0304, 0x006F, 0x0303, 0x0304,
+    0x006F, 0x0303, 0x0304, 0x006F, 0x0307, 0x006F, 0x0307, 0x006F,
+    0x0307, 0x0304, 0x006F, 0x0307, 0x0304, 0x0079, 0x0304, 0x0079,
+    0x0304, 0x2C65, 0x023C, 0x019A, 0x2C66, 0x0242, 0x0180, 0x0289,
+    0x028C, 0x0247, 0x0249, 0x024B, 0x024D, 0x024F, 0x0300, 0x0301,
+    0x0313, 0x0308, 0x0301, 0x03B9, 0x0371, 0x0373, 0x02B9, 0x0377,
+    0x0020, 0x03F3, 0x00A8, 0x0301, 0x03B1, 0x0301, 0x00B7, 0x03B5,
+    0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03BF, 0x0301, 0x03C5,
+    0x0301, 0x03C9, 0x0301, 0x03B9, 0x0308, 0x0301, 0x03B1, 0x03B2,
+    0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA,
+    0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3,
+    0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03B9, 0x0308,
+    0x03C5, 0x0308, 0x03B1, 0x0301, 0x03B5, 0x0301, 0x03B7, 0x0301,
+    0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301, 0x03C3, 0x03B9, 0x0308,
+    0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301, 0x03C9, 0x0301,
+    0x03D7, 0x03B2, 0x03B8, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x03C6,
+    0x03C0, 0x03D9, 0x03DB, 0x03DD, 0x03DF, 0x03E1, 0x03E3, 0x03E5,
+    0x03E7, 0x03E9, 0x03EB, 0x03ED, 0x03EF, 0x03BA, 0x03C1, 0x03B8,
+    0x03B5, 0x03F8, 0x03F2, 0x03FB, 0x037B, 0x037C, 0x037D, 0x0435,
+    0x0300, 0x0435, 0x0308, 0x0452, 0x0433, 0x0301, 0x0454, 0x0455,
+    0x0456, 0x0456, 0x0308, 0x0458, 0x0459, 0x045A, 0x045B, 0x043A,
+    0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x045F, 0x0430, 0x0431,
+    0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0438,
+    0x0306, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440,
+    0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448,
+    0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0438,
+    0x0306, 0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456,
+    0x0308, 0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0461,
+    0x0463, 0x0465, 0x0467, 0x0469, 0x046B, 0x046D, 0x046F, 0x0471,
+    0x0473, 0x0475, 0x0475, 0x030F, 0x0475, 0x030F, 0x0479, 0x047B,
+    0x047D, 0x047F, 0x0481, 0x048B, 0x048D, 0x048F, 0x0491, 0x0493,
+    0x0495, 0x0497, 0x0499, 0x049B, 0x049D, 0x049F, 0x04A1, 0x04A3,
+    0x04A5, 0x04A7, 0x04A9, 0x04AB, 0x04AD, 0x04AF, 0x04B1, 0x04B3,
+    0x04B5, 0x04B7, 0x04B9, 0x04BB, 0x04BD, 0x04BF, 0x04CF, 0x0436,
+    0x0306, 0x0436, 0x0306, 0x04C4, 0x04C6, 0x04C8, 0x04CA, 0x04CC,
+    0x04CE, 0x0430, 0x0306, 0x0430, 0x0306, 0x0430, 0x0308, 0x0430,
+    0x0308, 0x04D5, 0x0435, 0x0306, 0x0435, 0x0306, 0x04D9, 0x04D9,
+    0x0308, 0x04D9, 0x0308, 0x0436, 0x0308, 0x0436, 0x0308, 0x0437,
+    0x0308, 0x0437, 0x0308, 0x04E1, 0x0438, 0x0304, 0x0438, 0x0304,
+    0x0438, 0x0308, 0x0438, 0x0308, 0x043E, 0x0308, 0x043E, 0x0308,
+    0x04E9, 0x04E9, 0x0308, 0x04E9, 0x0308, 0x044D, 0x0308, 0x044D,
+    0x0308, 0x0443, 0x0304, 0x0443, 0x0304, 0x0443, 0x0308, 0x0443,
+    0x0308, 0x0443, 0x030B, 0x0443, 0x030B, 0x0447, 0x0308, 0x0447,
+    0x0308, 0x04F7, 0x044B, 0x0308, 0x044B, 0x0308, 0x04FB, 0x04FD,
+    0x04FF, 0x0501, 0x0503, 0x0505, 0x0507, 0x0509, 0x050B, 0x050D,
+    0x050F, 0x0511, 0x0513, 0x0515, 0x0517, 0x0519, 0x051B, 0x051D,
+    0x051F, 0x0521, 0x0523, 0x0525, 0x0527, 0x0529, 0x052B, 0x052D,
+    0x052F, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+    0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F,
+    0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+    0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
+    0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0565,
+    0x0582, 0x0020, 0x0020, 0x0627, 0x0653, 0x0627, 0x0654, 0x0648,
+    0x0654, 0x0627, 0x0655, 0x064A, 0x0654, 0x06D5, 0x0654, 0x06C1,
+    0x0654, 0x06D2, 0x0654, 0x0928, 0x093C, 0x0930, 0x093C, 0x0933,
+    0x093C, 0x0915, 0x093C, 0x0916, 0x093C, 0x0917, 0x093C, 0x091C,
+    0x093C, 0x0921, 0x093C, 0x0922, 0x093C, 0x092B, 0x093C, 0x092F,
+    0x093C, 0x09C7, 0x09BE, 0x09C7, 0x09D7, 0x09A1, 0x09BC, 0x09A2,
+    0x09BC, 0x09AF, 0x09BC, 0x0A32, 0x0A3C, 0x0A38, 0x0A3C, 0x0A16,
+    0x0A3C, 0x0A17, 0x0A3C, 0x0A1C, 0x0A3C, 0x0A2B, 0x0A3C, 0x0B47,
+    0x0B56, 0x0B47, 0x0B3E, 0x0B47, 0x0B57, 0x0B21, 0x0B3C, 0x0B22,
+    0x0B3C, 0x0B92, 0x0BD7, 0x0BC6, 0x0BBE, 0x0BC7, 0x0BBE, 0x0BC6,
+    0x0BD7, 0x0C46, 0x0C56, 0x0CBF, 0x0CD5, 0x0CC6, 0x0CD5, 0x0CC6,
+    0x0CD6, 0x0CC6, 0x0CC2, 0x0CC6, 0x0CC2, 0x0CD5, 0x0D46, 0x0D3E,
+    0x0D47, 0x0D3E, 0x0D46, 0x0D57, 0x0DD9, 0x0DCA, 0x0DD9, 0x0DCF,
+    0x0DD9, 0x0DCF, 0x0DCA, 0x0DD9, 0x0DDF, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51, 0x0FB7, 0x0F56,
+    0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71, 0x0F72, 0x0F71,
+    0x0F74, 0x0FB2, 0x0F80, 0x0FB3, 0x0F80, 0x0F71, 0x0F80, 0x0F92,
+    0x0FB7, 0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6, 0x0FB7, 0x0FAB,
+    0x0FB7, 0x0F90, 0x0FB5, 0x1025, 0x102E, 0x2D00, 0x2D01, 0x2D02,
+    0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08, 0x2D09, 0x2D0A,
+    0x2D0B, 0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F, 0x2D10, 0x2D11, 0x2D12,
+    0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18, 0x2D19, 0x2D1A,
+    0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F, 0x2D20, 0x2D21, 0x2D22,
+    0x2D23, 0x2D24, 0x2D25, 0x2D27, 0x2D2D, 0x13F0, 0x13F1, 0x13F2,
+    0x13F3, 0x13F4, 0x13F5, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x1B05, 0x1B35, 0x1B07, 0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35,
+    0x1B0D, 0x1B35, 0x1B11, 0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35,
+    0x1B3E, 0x1B35, 0x1B3F, 0x1B35, 0x1B42, 0x1B35, 0x0432, 0x0434,
+    0x043E, 0x0441, 0x0442, 0x0442, 0x044A, 0x0463, 0xA64B, 0x10D0,
+    0x10D1, 0x10D2, 0x10D3, 0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8,
+    0x10D9, 0x10DA, 0x10DB, 0x10DC, 0x10DD, 0x10DE, 0x10DF, 0x10E0,
+    0x10E1, 0x10E2, 0x10E3, 0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8,
+    0x10E9, 0x10EA, 0x10EB, 0x10EC, 0x10ED, 0x10EE, 0x10EF, 0x10F0,
+    0x10F1, 0x10F2, 0x10F3, 0x10F4, 0x10F5, 0x10F6, 0x10F7, 0x10F8,
+    0x10F9, 0x10FA, 0x10FD, 0x10FE, 0x10FF, 0x0061, 0x0325, 0x0061,
+    0x0325, 0x0062, 0x0307, 0x0062, 0x0307, 0x0062, 0x0323, 0x0062,
+    0x0323, 0x0062, 0x0331, 0x0062, 0x0331, 0x0063, 0x0327, 0x0301,
+    0x0063, 0x0327, 0x0301, 0x0064, 0x0307, 0x0064, 0x0307, 0x0064,
+    0x0323, 0x0064, 0x0323, 0x0064, 0x0331, 0x0064, 0x0331, 0x0064,
+    0x0327, 0x0064, 0x0327, 0x0064, 0x032D, 0x0064, 0x032D, 0x0065,
+    0x0304, 0x0300, 0x0065, 0x0304, 0x0300, 0x0065, 0x0304, 0x0301,
+    0x0065, 0x0304, 0x0301, 0x0065, 0x032D, 0x0065, 0x032D, 0x0065,
+    0x0330, 0x0065, 0x0330, 0x0065, 0x0327, 0x0306, 0x0065, 0x0327,
+    0x0306, 0x0066, 0x0307, 0x0066, 0x0307, 0x0067, 0x0304, 0x0067,
+    0x0304, 0x0068, 0x0307, 0x0068, 0x0307, 0x0068, 0x0323, 0x0068,
+    0x0323, 0x0068, 0x0308, 0x0068, 0x0308, 0x0068, 0x0327, 0x0068,
+    0x0327, 0x0068, 0x032E, 0x0068, 0x032E, 0x0069, 0x0330, 0x0069,
+    0x0330, 0x0069, 0x0308, 0x0301, 0x0069, 0x0308, 0x0301, 0x006B,
+    0x0301, 0x006B, 0x0301, 0x006B, 0x0323, 0x006B, 0x0323, 0x006B,
+    0x0331, 0x006B, 0x0331, 0x006C, 0x0323, 0x006C, 0x0323, 0x006C,
+    0x0323, 0x0304, 0x006C, 0x0323, 0x0304, 0x006C, 0x0331, 0x006C,
+    0x0331, 0x006C, 0x032D, 0x006C, 0x032D, 0x006D, 0x0301, 0x006D,
+    0x0301, 0x006D, 0x0307, 0x006D, 0x0307, 0x006D, 0x0323, 0x006D,
+    0x0323, 0x006E, 0x0307, 0x006E, 0x0307, 0x006E, 0x0323, 0x006E,
+    0x0323, 0x006E, 0x0331, 0x006E, 0x0331, 0x006E, 0x032D, 0x006E,
+    0x032D, 0x006F, 0x0303, 0x0301, 0x006F, 0x0303, 0x0301, 0x006F,
+    0x0303, 0x0308, 0x006F, 0x0303, 0x0308, 0x006F, 0x0304, 0x0300,
+    0x006F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0301, 0x006F, 0x0304,
+    0x0301, 0x0070, 0x0301, 0x0070, 0x0301, 0x0070, 0x0307, 0x0070,
+    0x0307, 0x0072, 0x0307, 0x0072, 0x0307, 0x0072, 0x0323, 0x0072,
+    0x0323, 0x0072, 0x0323, 0x0304, 0x0072, 0x0323, 0x0304, 0x0072,
+    0x0331, 0x0072, 0x0331, 0x0073, 0x0307, 0x0073, 0x0307, 0x0073,
+    0x0323, 0x0073, 0x0323, 0x0073, 0x0301, 0x0307, 0x0073, 0x0301,
+    0x0307, 0x0073, 0x030C, 0x0307, 0x0073, 0x030C, 0x0307, 0x0073,
+    0x0323, 0x0307, 0x0073, 0x0323, 0x0307, 0x0074, 0x0307, 0x0074,
+    0x0307, 0x0074, 0x0323, 0x0074, 0x0323, 0x0074, 0x0331, 0x0074,
+    0x0331, 0x0074, 0x032D, 0x0074, 0x032D, 0x0075, 0x0324, 0x0075,
+    0x0324, 0x0075, 0x0330, 0x0075, 0x0330, 0x0075, 0x032D, 0x0075,
+    0x032D, 0x0075, 0x0303, 0x0301, 0x0075, 0x0303, 0x0301, 0x0075,
+    0x0304, 0x0308, 0x0075, 0x0304, 0x0308, 0x0076, 0x0303, 0x0076,
+    0x0303, 0x0076, 0x0323, 0x0076, 0x0323, 0x0077, 0x0300, 0x0077,
+    0x0300, 0x0077, 0x0301, 0x0077, 0x0301, 0x0077, 0x0308, 0x0077,
+    0x0308, 0x0077, 0x0307, 0x0077, 0x0307, 0x0077, 0x0323, 0x0077,
+    0x0323, 0x0078, 0x0307, 0x0078, 0x0307, 0x0078, 0x0308, 0x0078,
+    0x0308, 0x0079, 0x0307, 0x0079, 0x0307, 0x007A, 0x0302, 0x007A,
+    0x0302, 0x007A, 0x0323, 0x007A, 0x0323, 0x007A, 0x0331, 0x007A,
+    0x0331, 0x0068, 0x0331, 0x0074, 0x0308, 0x0077, 0x030A, 0x0079,
+    0x030A, 0x0061, 0x02BE, 0x0073, 0x0307, 0x0073, 0x0073, 0x0061,
+    0x0323, 0x0061, 0x0323, 0x0061, 0x0309, 0x0061, 0x0309, 0x0061,
+    0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0061, 0x0302, 0x0300,
+    0x0061, 0x0302, 0x0300, 0x0061, 0x0302, 0x0309, 0x0061, 0x0302,
+    0x0309, 0x0061, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303, 0x0061,
+    0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0061, 0x0306, 0x0301,
+    0x0061, 0x0306, 0x0301, 0x0061, 0x0306, 0x0300, 0x0061, 0x0306,
+    0x0300, 0x0061, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309, 0x0061,
+    0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0061, 0x0323, 0x0306,
+    0x0061, 0x0323, 0x0306, 0x0065, 0x0323, 0x0065, 0x0323, 0x0065,
+    0x0309, 0x0065, 0x0309, 0x0065, 0x0303, 0x0065, 0x0303, 0x0065,
+    0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0065, 0x0302, 0x0300,
+    0x0065, 0x0302, 0x0300, 0x0065, 0x0302, 0x0309, 0x0065, 0x0302,
+    0x0309, 0x0065, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303, 0x0065,
+    0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0069, 0x0309, 0x0069,
+    0x0309, 0x0069, 0x0323, 0x0069, 0x0323, 0x006F, 0x0323, 0x006F,
+    0x0323, 0x006F, 0x0309, 0x006F, 0x0309, 0x006F, 0x0302, 0x0301,
+    0x006F, 0x0302, 0x0301, 0x006F, 0x0302, 0x0300, 0x006F, 0x0302,
+    0x0300, 0x006F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0309, 0x006F,
+    0x0302, 0x0303, 0x006F, 0x0302, 0x0303, 0x006F, 0x0323, 0x0302,
+    0x006F, 0x0323, 0x0302, 0x006F, 0x031B, 0x0301, 0x006F, 0x031B,
+    0x0301, 0x006F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0300, 0x006F,
+    0x031B, 0x0309, 0x006F, 0x031B, 0x0309, 0x006F, 0x031B, 0x0303,
+    0x006F, 0x031B, 0x0303, 0x006F, 0x031B, 0x0323, 0x006F, 0x031B,
+    0x0323, 0x0075, 0x0323, 0x0075, 0x0323, 0x0075, 0x0309, 0x0075,
+    0x0309, 0x0075, 0x031B, 0x0301, 0x0075, 0x031B, 0x0301, 0x0075,
+    0x031B, 0x0300, 0x0075, 0x031B, 0x0300, 0x0075, 0x031B, 0x0309,
+    0x0075, 0x031B, 0x0309, 0x0075, 0x031B, 0x0303, 0x0075, 0x031B,
+    0x0303, 0x0075, 0x031B, 0x0323, 0x0075, 0x031B, 0x0323, 0x0079,
+    0x0300, 0x0079, 0x0300, 0x0079, 0x0323, 0x0079, 0x0323, 0x0079,
+    0x0309, 0x0079, 0x0309, 0x0079, 0x0303, 0x0079, 0x0303, 0x1EFB,
+    0x1EFD, 0x1EFF, 0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313,
+    0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1,
+    0x0314, 0x0301, 0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342,
+    0x03B1, 0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1,
+    0x0314, 0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301,
+    0x03B1, 0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x03B5, 0x0313,
+    0x03B5, 0x0314, 0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300,
+    0x03B5, 0x0313, 0x0301, 0x03B5, 0x0314, 0x0301, 0x03B5, 0x0313,
+    0x03B5, 0x0314, 0x03B5, 0x0313, 0x0300, 0x03B5, 0x0314, 0x0300,
+    0x03B5, 0x0313, 0x0301, 0x03B5, 0x0314, 0x0301, 0x03B7, 0x0313,
+    0x03B7, 0x0314, 0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300,
+    0x03B7, 0x0313, 0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313,
+    0x0342, 0x03B7, 0x0314, 0x0342, 0x03B7, 0x0313, 0x03B7, 0x0314,
+    0x03B7, 0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313,
+    0x0301, 0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7,
+    0x0314, 0x0342, 0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313,
+    0x0300, 0x03B9, 0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9,
+    0x0314, 0x0301, 0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342,
+    0x03B9, 0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9,
+    0x0314, 0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301,
+    0x03B9, 0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x03BF, 0x0313,
+    0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300,
+    0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301, 0x03BF, 0x0313,
+    0x03BF, 0x0314, 0x03BF, 0x0313, 0x0300, 0x03BF, 0x0314, 0x0300,
+    0x03BF, 0x0313, 0x0301, 0x03BF, 0x0314, 0x0301, 0x03C5, 0x0313,
+    0x03C5, 0x0314, 0x03C5, 0x0313, 0x0300, 0x03C5, 0x0314, 0x0300,
+    0x03C5, 0x0313, 0x0301, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313,
+    0x0342, 0x03C5, 0x0314, 0x0342, 0x03C5, 0x0314, 0x03C5, 0x0314,
+    0x0300, 0x03C5, 0x0314, 0x0301, 0x03C5, 0x0314, 0x0342, 0x03C9,
+    0x0313, 0x03C9, 0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314,
+    0x0300, 0x03C9, 0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9,
+    0x0313, 0x0342, 0x03C9, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9,
+    0x0314, 0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9,
+    0x0313, 0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342,
+    0x03C9, 0x0314, 0x0342, 0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5,
+    0x0300, 0x03B5, 0x0301, 0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9,
+    0x0300, 0x03B9, 0x0301, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5,
+    0x0300, 0x03C5, 0x0301, 0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1,
+    0x0313, 0x03B9, 0x03B1, 0x0314, 0x03B9, 0x03B1, 0x0313, 0x0300,
+    0x03B9, 0x03B1, 0x0314, 0x0300, 0x03B9, 0x03B1, 0x0313, 0x0301,
+    0x03B9, 0x03B1, 0x0314, 0x0301, 0x03B9, 0x03B1, 0x0313, 0x0342,
+    0x03B9, 0x03B1, 0x0314, 0x0342, 0x03B9, 0x03B1, 0x0313, 0x03B9,
+    0x03B1, 0x0314, 0x03B9, 0x03B1, 0x0313, 0x0300, 0x03B9, 0x03B1,
+    0x0314, 0x0300, 0x03B9, 0x03B1, 0x0313, 0x0301, 0x03B9, 0x03B1,
+    0x0314, 0x0301, 0x03B9, 0x03B1, 0x0313, 0x0342, 0x03B9, 0x03B1,
+    0x0314, 0x0342, 0x03B9, 0x03B7, 0x0313, 0x03B9, 0x03B7, 0x0314,
+    0x03B9, 0x03B7, 0x0313, 0x0300, 0x03B9, 0x03B7, 0x0314, 0x0300,
+    0x03B9, 0x03B7, 0x0313, 0x0301, 0x03B9, 0x03B7, 0x0314, 0x0301,
+    0x03B9, 0x03B7, 0x0313, 0x0342, 0x03B9, 0x03B7, 0x0314, 0x0342,
+    0x03B9, 0x03B7, 0x0313, 0x03B9, 0x03B7, 0x0314, 0x03B9, 0x03B7,
+    0x0313, 0x0300, 0x03B9, 0x03B7, 0x0314, 0x0300, 0x03B9, 0x03B7,
+    0x0313, 0x0301, 0x03B9, 0x03B7, 0x0314, 0x0301, 0x03B9, 0x03B7,
+    0x0313, 0x0342, 0x03B9, 0x03B7, 0x0314, 0x0342, 0x03B9, 0x03C9,
+    0x0313, 0x03B9, 0x03C9, 0x0314, 0x03B9, 0x03C9, 0x0313, 0x0300,
+    0x03B9, 0x03C9, 0x0314, 0x0300, 0x03B9, 0x03C9, 0x0313, 0x0301,
+    0x03B9, 0x03C9, 0x0314, 0x0301, 0x03B9, 0x03C9, 0x0313, 0x0342,
+    0x03B9, 0x03C9, 0x0314, 0x0342, 0x03B9, 0x03C9, 0x0313, 0x03B9,
+    0x03C9, 0x0314, 0x03B9, 0x03C9, 0x0313, 0x0300, 0x03B9, 0x03C9,
+    0x0314, 0x0300, 0x03B9, 0x03C9, 0x0313, 0x0301, 0x03B9, 0x03C9,
+    0x0314, 0x0301, 0x03B9, 0x03C9, 0x0313, 0x0342, 0x03B9, 0x03C9,
+    0x0314, 0x0342, 0x03B9, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1,
+    0x0300, 0x03B9, 0x03B1, 0x03B9, 0x03B1, 0x0301, 0x03B9, 0x03B1,
+    0x0342, 0x03B1, 0x0342, 0x03B9, 0x03B1, 0x0306, 0x03B1, 0x0304,
+    0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B1, 0x03B9, 0x03B9, 0x00A8,
+    0x0342, 0x03B7, 0x0300, 0x03B9, 0x03B7, 0x03B9, 0x03B7, 0x0301,
+    0x03B9, 0x03B7, 0x0342, 0x03B7, 0x0342, 0x03B9, 0x03B5, 0x0300,
+    0x03B5, 0x0301, 0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B7, 0x03B9,
+    0x1FBF, 0x0300, 0x1FBF, 0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306,
+    0x03B9, 0x0304, 0x03B9, 0x0308, 0x0300, 0x03B9, 0x0308, 0x0301,
+    0x03B9, 0x0342, 0x03B9, 0x0308, 0x0342, 0x03B9, 0x0306, 0x03B9,
+    0x0304, 0x03B9, 0x0300, 0x03B9, 0x0301, 0x1FFE, 0x0300, 0x1FFE,
+    0x0301, 0x1FFE, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5,
+    0x0308, 0x0300, 0x03C5, 0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1,
+    0x0314, 0x03C5, 0x0342, 0x03C5, 0x0308, 0x0342, 0x03C5, 0x0306,
+    0x03C5, 0x0304, 0x03C5, 0x0300, 0x03C5, 0x0301, 0x03C1, 0x0314,
+    0x00A8, 0x0300, 0x00A8, 0x0301, 0x03C9, 0x0300, 0x03B9, 0x03C9,
+    0x03B9, 0x03C9, 0x0301, 0x03B9, 0x03C9, 0x0342, 0x03C9, 0x0342,
+    0x03B9, 0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C9, 0x0300, 0x03C9,
+    0x0301, 0x03C9, 0x03B9, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x03C9, 0x006B, 0x0061, 0x030A, 0x214E, 0x2170, 0x2171, 0x2172,
+    0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x217A,
+    0x217B, 0x217C, 0x217D, 0x217E, 0x217F, 0x2184, 0x2190, 0x0338,
+    0x2192, 0x0338, 0x2194, 0x0338, 0x21D0, 0x0338, 0x21D4, 0x0338,
+    0x21D2, 0x0338, 0x2203, 0x0338, 0x2208, 0x0338, 0x220B, 0x0338,
+    0x2223, 0x0338, 0x2225, 0x0338, 0x223C, 0x0338, 0x2243, 0x0338,
+    0x2245, 0x0338, 0x2248, 0x0338, 0x003D, 0x0338, 0x2261, 0x0338,
+    0x224D, 0x0338, 0x003C, 0x0338, 0x003E, 0x0338, 0x2264, 0x0338,
+    0x2265, 0x0338, 0x2272, 0x0338, 0x2273, 0x0338, 0x2276, 0x0338,
+    0x2277, 0x0338, 0x227A, 0x0338, 0x227B, 0x0338, 0x2282, 0x0338,
+    0x2283, 0x0338, 0x2286, 0x0338, 0x2287, 0x0338, 0x22A2, 0x0338,
+    0x22A8, 0x0338, 0x22A9, 0x0338, 0x22AB, 0x0338, 0x227C, 0x0338,
+    0x227D, 0x0338, 0x2291, 0x0338, 0x2292, 0x0338, 0x22B2, 0x0338,
+    0x22B3, 0x0338, 0x22B4, 0x0338, 0x22B5, 0x0338, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x24D0, 0x24D1, 0x24D2, 0x24D3,
+    0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB,
+    0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3,
+    0x24E4, 0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x2ADD, 0x0338, 0x2C30, 0x2C31,
+    0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37, 0x2C38, 0x2C39,
+    0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F, 0x2C40, 0x2C41,
+    0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47, 0x2C48, 0x2C49,
+    0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F, 0x2C50, 0x2C51,
+    0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57, 0x2C58, 0x2C59,
+    0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x2C5F, 0x2C61, 0x026B,
+    0x1D7D, 0x027D, 0x2C68, 0x2C6A, 0x2C6C, 0x0251, 0x0271, 0x0250,
+    0x0252, 0x2C73, 0x2C76, 0x023F, 0x0240, 0x2C81, 0x2C83, 0x2C85,
+    0x2C87, 0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91, 0x2C93, 0x2C95,
+    0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F, 0x2CA1, 0x2CA3, 0x2CA5,
+    0x2CA7, 0x2CA9, 0x2CAB, 0x2CAD, 0x2CAF, 0x2CB1, 0x2CB3, 0x2CB5,
+    0x2CB7, 0x2CB9, 0x2CBB, 0x2CBD, 0x2CBF, 0x2CC1, 0x2CC3, 0x2CC5,
+    0x2CC7, 0x2CC9, 0x2CCB, 0x2CCD, 0x2CCF, 0x2CD1, 0x2CD3, 0x2CD5,
+    0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1, 0x2CE3, 0x2CEC,
+    0x2CEE, 0x2CF3, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x304B, 0x3099, 0x304D, 0x3099, 0x304F, 0x3099, 0x3051,
+    0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057, 0x3099, 0x3059,
+    0x3099, 0x305B, 0x3099, 0x305D, 0x3099, 0x305F, 0x3099, 0x3061,
+    0x3099, 0x3064, 0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306F,
+    0x3099, 0x306F, 0x309A, 0x3072, 0x3099, 0x3072, 0x309A, 0x3075,
+    0x3099, 0x3075, 0x309A, 0x3078, 0x3099, 0x3078, 0x309A, 0x307B,
+    0x3099, 0x307B, 0x309A, 0x3046, 0x3099, 0x309D, 0x3099, 0x0020,
+    0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099, 0x30B1, 0x3099,
+    0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099, 0x30B9, 0x3099,
+    0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099, 0x30C1, 0x3099,
+    0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099, 0x30CF, 0x3099,
+    0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A, 0x30D5, 0x3099,
+    0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A, 0x30DB, 0x3099,
+    0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099, 0x30F0, 0x3099,
+    0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099, 0xA641, 0xA643,
+    0xA645, 0xA647, 0xA649, 0xA64B, 0xA64D, 0xA64F, 0xA651, 0xA653,
+    0xA655, 0xA657, 0xA659, 0xA65B, 0xA65D, 0xA65F, 0xA661, 0xA663,
+    0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681, 0xA683, 0xA685,
+    0xA687, 0xA689, 0xA68B, 0xA68D, 0xA68F, 0xA691, 0xA693, 0xA695,
+    0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727, 0xA729, 0xA72B,
+    0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739, 0xA73B, 0xA73D,
+    0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749, 0xA74B, 0xA74D,
+    0xA74F, 0xA751, 0xA753, 0xA755, 0xA757, 0xA759, 0xA75B, 0xA75D,
+    0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769, 0xA76B, 0xA76D,
+    0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781, 0xA783, 0xA785,
+    0xA787, 0xA78C, 0x0265, 0xA791, 0xA793, 0xA797, 0xA799, 0xA79B,
+    0xA79D, 0xA79F, 0xA7A1, 0xA7A3, 0xA7A5, 0xA7A7, 0xA7A9, 0x0266,
+    0x025C, 0x0261, 0x026C, 0x026A, 0x029E, 0x0287, 0x029D, 0xAB53,
+    0xA7B5, 0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF, 0xA7C1, 0xA7C3,
+    0xA794, 0x0282, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1, 0xA7D7, 0xA7D9,
+    0xA7F6, 0x13A0, 0x13A1, 0x13A2, 0x13A3, 0x13A4, 0x13A5, 0x13A6,
+    0x13A7, 0x13A8, 0x13A9, 0x13AA, 0x13AB, 0x13AC, 0x13AD, 0x13AE,
+    0x13AF, 0x13B0, 0x13B1, 0x13B2, 0x13B3, 0x13B4, 0x13B5, 0x13B6,
+    0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC, 0x13BD, 0x13BE,
+    0x13BF, 0x13C0, 0x13C1, 0x13C2, 0x13C3, 0x13C4, 0x13C5, 0x13C6,
+    0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC, 0x13CD, 0x13CE,
+    0x13CF, 0x13D0, 0x13D1, 0x13D2, 0x13D3, 0x13D4, 0x13D5, 0x13D6,
+    0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x13DB, 0x13DC, 0x13DD, 0x13DE,
+    0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x13E3, 0x13E4, 0x13E5, 0x13E6,
+    0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC, 0x13ED, 0x13EE,
+    0x13EF, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1, 0x4E32, 0x53E5,
+    0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948, 0x61F6, 0x7669,
+    0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02, 0x6D1B, 0x70D9,
+    0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375, 0x6B04, 0x721B,
+    0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964, 0x62C9, 0x81D8,
+    0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE, 0x4F86, 0x51B7,
+    0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001, 0x8606, 0x865C,
+    0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F, 0x7DA0, 0x83C9,
+    0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60, 0x807E, 0x7262,
+    0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13, 0x6DDA, 0x6F0F,
+    0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC, 0x51CC, 0x7A1C,
+    0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02, 0x8AFE, 0x4E39,
+    0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB, 0x4FBF, 0x5FA9,
+    0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E, 0x7701, 0x8449,
+    0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5, 0x63A0, 0x7565,
+    0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F, 0x8AD2, 0x91CF,
+    0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE, 0x792A, 0x95AD,
+    0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77, 0x8F62, 0x5E74,
+    0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489, 0x79CA, 0x7DF4,
+    0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217, 0x52A3, 0x54BD,
+    0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B, 0x6BAE, 0x7C3E,
+    0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C, 0x73B2, 0x7469,
+    0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818, 0x4F8B, 0x79AE,
+    0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE, 0x5C3F, 0x6599,
+    0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D, 0x6688, 0x962E,
+    0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+    0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B, 0x5D19, 0x6DEA,
+    0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540F,
+    0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406, 0x75E2, 0x7F79,
+    0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA, 0x541D, 0x71D0,
+    0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797, 0x6DCB, 0x81E8,
+    0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58, 0x4EC0, 0x8336,
+    0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85, 0x6D1E, 0x66B4,
+    0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140, 0x55C0, 0x585A,
+    0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E, 0x7965, 0x798F,
+    0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038, 0x90FD, 0x98EF,
+    0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE, 0x50E7, 0x514D,
+    0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668, 0x5840, 0x58A8,
+    0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2, 0x654F, 0x65E2,
+    0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E, 0x722B, 0x7422,
+    0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956, 0x795D, 0x798D,
+    0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09, 0x7E41, 0x7F72,
+    0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8B01,
+    0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3, 0x97FF, 0x983B,
+    0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168, 0x4F80, 0x5145,
+    0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599, 0x55E2, 0x585A,
+    0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2, 0x5ED9, 0x5F69,
+    0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160, 0x61F2, 0x6234,
+    0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717, 0x671B, 0x6756,
+    0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22, 0x701E, 0x716E,
+    0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506, 0x753B, 0x761D,
+    0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740, 0x78CC, 0x7AB1,
+    0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005, 0x8352, 0x83EF,
+    0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8, 0x8ACB, 0x8B01,
+    0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38, 0x9072, 0x9199,
+    0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF, 0x980B, 0x983B,
+    0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D, 0x4018, 0x4039,
+    0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x0066, 0x0066, 0x0066,
+    0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066,
+    0x006C, 0x0073, 0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574,
+    0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574, 0x056D, 0x05D9,
+    0x05B4, 0x05F2, 0x05B7, 0x05E9, 0x05C1, 0x05E9, 0x05C2, 0x05E9,
+    0x05BC, 0x05C1, 0x05E9, 0x05BC, 0x05C2, 0x05D0, 0x05B7, 0x05D0,
+    0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2, 0x05BC, 0x05D3,
+    0x05BC, 0x05D4, 0x05BC, 0x05D5, 0x05BC, 0x05D6, 0x05BC, 0x05D8,
+    0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB, 0x05BC, 0x05DC,
+    0x05BC, 0x05DE, 0x05BC, 0x05E0, 0x05BC, 0x05E1, 0x05BC, 0x05E3,
+    0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7, 0x05BC, 0x05E8,
+    0x05BC, 0x05E9, 0x05BC, 0x05EA, 0x05BC, 0x05D5, 0x05B9, 0x05D1,
+    0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48,
+    0xFF49, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50,
+    0xFF51, 0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58,
+    0xFF59, 0xFF5A, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D,
+    0x1042E, 0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435,
+    0x10436, 0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D,
+    0x1043E, 0x1043F, 0x10440, 0x10441, 0x10442, 0x10443, 0x10444, 0x10445,
+    0x10446, 0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D,
+    0x1044E, 0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD,
+    0x104DE, 0x104DF, 0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5,
+    0x104E6, 0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED,
+    0x104EE, 0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5,
+    0x104F6, 0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x10597, 0x10598,
+    0x10599, 0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0,
+    0x105A1, 0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7, 0x105A8, 0x105A9,
+    0x105AA, 0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF, 0x105B0, 0x105B1,
+    0x105B3, 0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8, 0x105B9, 0x105BB,
+    0x105BC, 0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6,
+    0x10CC7, 0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE,
+    0x10CCF, 0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6,
+    0x10CD7, 0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE,
+    0x10CDF, 0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6,
+    0x10CE7, 0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE,
+    0x10CEF, 0x10CF0, 0x10CF1, 0x10CF2, 0x0020, 0x11099, 0x110BA, 0x1109B,
+    0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347,
+    0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9,
+    0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x118C0, 0x118C1, 0x118C2,
+    0x118C3, 0x118C4, 0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9, 0x118CA,
+    0x118CB, 0x118CC, 0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2,
+    0x118D3, 0x118D4, 0x118D5, 0x118D6, 0x118D7, 0x118D8, 0x118D9, 0x118DA,
+    0x118DB, 0x118DC, 0x118DD, 0x118DE, 0x118DF, 0x11935, 0x11930, 0x16E60,
+    0x16E61, 0x16E62, 0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67, 0x16E68,
+    0x16E69, 0x16E6A, 0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70,
+    0x16E71, 0x16E72, 0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78,
+    0x16E79, 0x16E7A, 0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F, 0x1D157,
+    0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165,
+    0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158,
+    0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165,
+    0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA,
+    0x1D165, 0x1D16F, 0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927,
+    0x1E928, 0x1E929, 0x1E92A, 0x1E92B, 0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F,
+    0x1E930, 0x1E931, 0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937,
+    0x1E938, 0x1E939, 0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F,
+    0x1E940, 0x1E941, 0x1E942, 0x1E943, 0x4E3D, 0x4E38, 0x4E41, 0x20122,
+    0x4F60, 0x4FAE, 0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF,
+    0x349E, 0x2063A, 0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9,
+    0x5167, 0x518D, 0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5,
+    0x291DF, 0x51F5, 0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277,
+    0x3515, 0x52C7, 0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317,
+    0x5349, 0x5351, 0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F,
+    0x20A2C, 0x7070, 0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406,
+    0x549E, 0x5438, 0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553,
+    0x5563, 0x5584, 0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716,
+    0x5606, 0x5717, 0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4,
+    0x580D, 0x578B, 0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7,
+    0x5906, 0x591A, 0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B,
+    0x5A27, 0x59D8, 0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E,
+    0x219C8, 0x5BC3, 0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06,
+    0x5F53, 0x5C22, 0x3781, 0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4,
+    0x5D43, 0x21DE6, 0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F,
+    0x5DFD, 0x5E28, 0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0,
+    0x5EB3, 0x5EB6, 0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201,
+    0x5F22, 0x5F22, 0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3,
+    0x5F9A, 0x5FCD, 0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094,
+    0x226D4, 0x60C7, 0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E,
+    0x61B2, 0x61A4, 0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B,
+    0x625D, 0x62B1, 0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368,
+    0x6383, 0x63E4, 0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469,
+    0x647E, 0x649D, 0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3,
+    0x66F8, 0x6649, 0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195,
+    0x6700, 0x669C, 0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E,
+    0x6753, 0x233C3, 0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D,
+    0x688E, 0x681F, 0x6914, 0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8,
+    0x236A3, 0x6ADB, 0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72,
+    0x6B9F, 0x6BBA, 0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC,
+    0x6CBF, 0x6CCD, 0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69,
+    0x6D78, 0x6D85, 0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB,
+    0x6EC7, 0x23ED1, 0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039,
+    0x701E, 0x701B, 0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525,
+    0x7145, 0x24263, 0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608,
+    0x7280, 0x7295, 0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5,
+    0x3EB8, 0x3EB8, 0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B,
+    0x7524, 0x24C36, 0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1,
+    0x24FB8, 0x25044, 0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119,
+    0x25133, 0x771E, 0x771F, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046,
+    0x4096, 0x2541D, 0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956,
+    0x2569A, 0x256C5, 0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F,
+    0x2597C, 0x25AA7, 0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9,
+    0x4227, 0x25C80, 0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86,
+    0x7D63, 0x4301, 0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247,
+    0x4359, 0x262D9, 0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA,
+    0x26523, 0x8060, 0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103,
+    0x440B, 0x813E, 0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201,
+    0x8204, 0x8F9E, 0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1,
+    0x82B3, 0x82BD, 0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD,
+    0x8323, 0x83BD, 0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC,
+    0x26C36, 0x26D6B, 0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA,
+    0x8564, 0x26F2C, 0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650,
+    0x865C, 0x8667, 0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779,
+    0x8728, 0x876B, 0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860,
+    0x8863, 0x27667, 0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE,
+    0x27966, 0x46BE, 0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8,
+    0x8CAB, 0x8CC1, 0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC,
+    0x8DF0, 0x208DE, 0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1,
+    0x9111, 0x2872E, 0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9,
+    0x9415, 0x28BFA, 0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3,
+    0x5DB2, 0x9723, 0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A,
+    0x4AB2, 0x29496, 0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33,
+    0x9929, 0x99A7, 0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40,
+    0x9CFD, 0x4CCE, 0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E,
+    0x2A291, 0x9EBB, 0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16,
+    0x9F3B, 0x2A600,
+};
+
+// canonical combining classes other than 0: first, last code point, class
+static const uint32_t unikey_ccc[1146] =
+{
+    0x00300, 0x00314, 0x000E6, 0x00315, 0x00315, 0x000E8, 0x00316, 0x00319, 0x000DC,
+    0x0031A, 0x0031A, 0x000E8, 0x0031B, 0x0031B, 0x000D8, 0x0031C, 0x00320, 0x000DC,
+    0x00321, 0x00322, 0x000CA, 0x00323, 0x00326, 0x000DC, 0x00327, 0x00328, 0x000CA,
+    0x00329, 0x00333, 0x000DC, 0x00334, 0x00338, 0x00001, 0x00339, 0x0033C, 0x000DC,
+    0x0033D, 0x00344, 0x000E6, 0x00345, 0x00345, 0x000F0, 0x00346, 0x00346, 0x000E6,
+    0x00347, 0x00349, 0x000DC, 0x0034A, 0x0034C, 0x000E6, 0x0034D, 0x0034E, 0x000DC,
+    0x00350, 0x00352, 0x000E6, 0x00353, 0x00356, 0x000DC, 0x00357, 0x00357, 0x000E6,
+    0x00358, 0x00358, 0x000E8, 0x00359, 0x0035A, 0x000DC, 0x0035B, 0x0035B, 0x000E6,
+    0x0035C, 0x0035C, 0x000E9, 0x0035D, 0x0035E, 0x000EA, 0x0035F, 0x0035F, 0x000E9,
+    0x00360, 0x00361, 0x000EA, 0x00362, 0x00362, 0x000E9, 0x00363, 0x0036F, 0x000E6,
+    0x00483, 0x00487, 0x000E6, 0x00591, 0x00591, 0x000DC, 0x00592, 0x00595, 0x000E6,
+    0x00596, 0x00596, 0x000DC, 0x00597, 0x00599, 0x000E6, 0x0059A, 0x0059A, 0x000DE,
+    0x0059B, 0x0059B, 0x000DC, 0x0059C, 0x005A1, 0x000E6, 0x005A2, 0x005A7, 0x000DC,
+    0x005A8, 0x005A9, 0x000E6, 0x005AA, 0x005AA, 0x000DC, 0x005AB, 0x005AC, 0x000E6,
+    0x005AD, 0x005AD, 0x000DE, 0x005AE, 0x005AE, 0x000E4, 0x005AF, 0x005AF, 0x000E6,
+    0x005B0, 0x005B0, 0x0000A, 0x005B1, 0x005B1, 0x0000B, 0x005B2, 0x005B2, 0x0000C,
+    0x005B3, 0x005B3, 0x0000D, 0x005B4, 0x005B4, 0x0000E, 0x005B5, 0x005B5, 0x0000F,
+    0x005B6, 0x005B6, 0x00010, 0x005B7, 0x005B7, 0x00011, 0x005B8, 0x005B8, 0x00012,
+    0x005B9, 0x005BA, 0x00013, 0x005BB, 0x005BB, 0x00014, 0x005BC, 0x005BC, 0x00015,
+    0x005BD, 0x005BD, 0x00016, 0x005BF, 0x005BF, 0x00017, 0x005C1, 0x005C1, 0x00018,
+    0x005C2, 0x005C2, 0x00019, 0x005C4, 0x005C4, 0x000E6, 0x005C5, 0x005C5, 0x000DC,
+    0x005C7, 0x005C7, 0x00012, 0x00610, 0x00617, 0x000E6, 0x00618, 0x00618, 0x0001E,
+    0x00619, 0x00619, 0x0001F, 0x0061A, 0x0061A, 0x00020, 0x0064B, 0x0064B, 0x0001B,
+    0x0064C, 0x0064C, 0x0001C, 0x0064D, 0x0064D, 0x0001D, 0x0064E, 0x0064E, 0x0001E,
+    0x0064F, 0x0064F, 0x0001F, 0x00650, 0x00650, 0x00020, 0x00651, 0x00651, 0x00021,
+    0x00652, 0x00652, 0x00022, 0x00653, 0x00654, 0x000E6, 0x00655, 0x00656, 0x000DC,
+    0x00657, 0x0065B, 0x000E6, 0x0065C, 0x0065C, 0x000DC, 0x0065D, 0x0065E, 0x000E6,
+    0x0065F, 0x0065F, 0x000DC, 0x00670, 0x00670, 0x00023, 0x006D6, 0x006DC, 0x000E6,
+    0x006DF, 0x006E2, 0x000E6, 0x006E3, 0x006E3, 0x000DC, 0x006E4, 0x006E4, 0x000E6,
+    0x006E7, 0x006E8, 0x000E6, 0x006EA, 0x006EA, 0x000DC, 0x006EB, 0x006EC, 0x000E6,
+    0x006ED, 0x006ED, 0x000DC, 0x00711, 0x00711, 0x00024, 0x00730, 0x00730, 0x000E6,
+    0x00731, 0x00731, 0x000DC, 0x00732, 0x00733, 0x000E6, 0x00734, 0x00734, 0x000DC,
+    0x00735, 0x00736, 0x000E6, 0x00737, 0x00739, 0x000DC, 0x0073A, 0x0073A, 0x000E6,
+    0x0073B, 0x0073C, 0x000DC, 0x0073D, 0x0073D, 0x000E6, 0x0073E, 0x0073E, 0x000DC,
+    0x0073F, 0x00741, 0x000E6, 0x00742, 0x00742, 0x000DC, 0x00743, 0x00743, 0x000E6,
+    0x00744, 0x00744, 0x000DC, 0x00745, 0x00745, 0x000E6, 0x00746, 0x00746, 0x000DC,
+    0x00747, 0x00747, 0x000E6, 0x00748, 0x00748, 0x000DC, 0x00749, 0x0074A, 0x000E6,
+    0x007EB, 0x007F1, 0x000E6, 0x007F2, 0x007F2, 0x000DC, 0x007F3, 0x007F3, 0x000E6,
+    0x007FD, 0x007FD, 0x000DC, 0x00816, 0x00819, 0x000E6, 0x0081B, 0x00823, 0x000E6,
+    0x00825, 0x00827, 0x000E6, 0x00829, 0x0082D, 0x000E6, 0x00859, 0x0085B, 0x000DC,
+    0x00898, 0x00898, 0x000E6, 0x00899, 0x0089B, 0x000DC, 0x0089C, 0x0089F, 0x000E6,
+    0x008CA, 0x008CE, 0x000E6, 0x008CF, 0x008D3, 0x000DC, 0x008D4, 0x008E1, 0x000E6,
+    0x008E3, 0x008E3, 0x000DC, 0x008E4, 0x008E5, 0x000E6, 0x008E6, 0x008E6, 0x000DC,
+    0x008E7, 0x008E8, 0x000E6, 0x008E9, 0x008E9, 0x000DC, 0x008EA, 0x008EC, 0x000E6,
+    0x008ED, 0x008EF, 0x000DC, 0x008F0, 0x008F0, 0x0001B, 0x008F1, 0x008F1, 0x0001C,
+    0x008F2, 0x008F2, 0x0001D, 0x008F3, 0x008F5, 0x000E6, 0x008F6, 0x008F6, 0x000DC,
+    0x008F7, 0x008F8, 0x000E6, 0x008F9, 0x008FA, 0x000DC, 0x008FB, 0x008FF, 0x000E6,
+    0x0093C, 0x0093C, 0x00007, 0x0094D, 0x0094D, 0x00009, 0x00951, 0x00951, 0x000E6,
+    0x00952, 0x00952, 0x000DC, 0x00953, 0x00954, 0x000E6, 0x009BC, 0x009BC, 0x00007,
+    0x009CD, 0x009CD, 0x00009, 0x009FE, 0x009FE, 0x000E6, 0x00A3C, 0x00A3C, 0x00007,
+    0x00A4D, 0x00A4D, 0x00009, 0x00ABC, 0x00ABC, 0x00007, 0x00ACD, 0x00ACD, 0x00009,
+    0x00B3C, 0x00B3C, 0x00007, 0x00B4D, 0x00B4D, 0x00009, 0x00BCD, 0x00BCD, 0x00009,
+    0x00C3C, 0x00C3C, 0x00007, 0x00C4D, 0x00C4D, 0x00009, 0x00C55, 0x00C55, 0x00054,
+    0x00C56, 0x00C56, 0x0005B, 0x00CBC, 0x00CBC, 0x00007, 0x00CCD, 0x00CCD, 0x00009,
+    0x00D3B, 0x00D3C, 0x00009, 0x00D4D, 0x00D4D, 0x00009, 0x00DCA, 0x00DCA, 0x00009,
+    0x00E38, 0x00E39, 0x00067, 0x00E3A, 0x00E3A, 0x00009, 0x00E48, 0x00E4B, 0x0006B,
+    0x00EB8, 0x00EB9, 0x00076, 0x00EBA, 0x00EBA, 0x00009, 0x00EC8, 0x00ECB, 0x0007A,
+    0x00F18, 0x00F19, 0x000DC, 0x00F35, 0x00F35, 0x000DC, 0x00F37, 0x00F37, 0x000DC,
+    0x00F39, 0x00F39, 0x000D8, 0x00F71, 0x00F71, 0x00081, 0x00F72, 0x00F72, 0x00082,
+    0x00F74, 0x00F74, 0x00084, 0x00F7A, 0x00F7D, 0x00082, 0x00F80, 0x00F80, 0x00082,
+    0x00F82, 0x00F83, 0x000E6, 0x00F84, 0x00F84, 0x00009, 0x00F86, 0x00F87, 0x000E6,
+    0x00FC6, 0x00FC6, 0x000DC, 0x01037, 0x01037, 0x00007, 0x01039, 0x0103A, 0x00009,
+    0x0108D, 0x0108D, 0x000DC, 0x0135D, 0x0135F, 0x000E6, 0x01714, 0x01715, 0x00009,
+    0x01734, 0x01734, 0x00009, 0x017D2, 0x017D2, 0x00009, 0x017DD, 0x017DD, 0x000E6,
+    0x018A9, 0x018A9, 0x000E4, 0x01939, 0x01939, 0x000DE, 0x0193A, 0x0193A, 0x000E6,
+    0x0193B, 0x0193B, 0x000DC, 0x01A17, 0x01A17, 0x000E6, 0x01A18, 0x01A18, 0x000DC,
+    0x01A60, 0x01A60, 0x00009, 0x01A75, 0x01A7C, 0x000E6, 0x01A7F, 0x01A7F, 0x000DC,
+    0x01AB0, 0x01AB4, 0x000E6, 0x01AB5, 0x01ABA, 0x000DC, 0x01ABB, 0x01ABC, 0x000E6,
+    0x01ABD, 0x01ABD, 0x000DC, 0x01ABF, 0x01AC0, 0x000DC, 0x01AC1, 0x01AC2, 0x000E6,
+    0x01AC3, 0x01AC4, 0x000DC, 0x01AC5, 0x01AC9, 0x000E6, 0x01ACA, 0x01ACA, 0x000DC,
+    0x01ACB, 0x01ACE, 0x000E6, 0x01B34, 0x01B34, 0x00007, 0x01B44, 0x01B44, 0x00009,
+    0x01B6B, 0x01B6B, 0x000E6, 0x01B6C, 0x01B6C, 0x000DC, 0x01B6D, 0x01B73, 0x000E6,
+    0x01BAA, 0x01BAB, 0x00009, 0x01BE6, 0x01BE6, 0x00007, 0x01BF2, 0x01BF3, 0x00009,
+    0x01C37, 0x01C37, 0x00007, 0x01CD0, 0x01CD2, 0x000E6, 0x01CD4, 0x01CD4, 0x00001,
+    0x01CD5, 0x01CD9, 0x000DC, 0x01CDA, 0x01CDB, 0x000E6, 0x01CDC, 0x01CDF, 0x000DC,
+    0x01CE0, 0x01CE0, 0x000E6, 0x01CE2, 0x01CE8, 0x00001, 0x01CED, 0x01CED, 0x000DC,
+    0x01CF4, 0x01CF4, 0x000E6, 0x01CF8, 0x01CF9, 0x000E6, 0x01DC0, 0x01DC1, 0x000E6,
+    0x01DC2, 0x01DC2, 0x000DC, 0x01DC3, 0x01DC9, 0x000E6, 0x01DCA, 0x01DCA, 0x000DC,
+    0x01DCB, 0x01DCC, 0x000E6, 0x01DCD, 0x01DCD, 0x000EA, 0x01DCE, 0x01DCE, 0x000D6,
+    0x01DCF, 0x01DCF, 0x000DC, 0x01DD0, 0x01DD0, 0x000CA, 0x01DD1, 0x01DF5, 0x000E6,
+    0x01DF6, 0x01DF6, 0x000E8, 0x01DF7, 0x01DF8, 0x000E4, 0x01DF9, 0x01DF9, 0x000DC,
+    0x01DFA, 0x01DFA, 0x000DA, 0x01DFB, 0x01DFB, 0x000E6, 0x01DFC, 0x01DFC, 0x000E9,
+    0x01DFD, 0x01DFD, 0x000DC, 0x01DFE, 0x01DFE, 0x000E6, 0x01DFF, 0x01DFF, 0x000DC,
+    0x020D0, 0x020D1, 0x000E6, 0x020D2, 0x020D3, 0x00001, 0x020D4, 0x020D7, 0x000E6,
+    0x020D8, 0x020DA, 0x00001, 0x020DB, 0x020DC, 0x000E6, 0x020E1, 0x020E1, 0x000E6,
+    0x020E5, 0x020E6, 0x00001, 0x020E7, 0x020E7, 0x000E6, 0x020E8, 0x020E8, 0x000DC,
+    0x020E9, 0x020E9, 0x000E6, 0x020EA, 0x020EB, 0x00001, 0x020EC, 0x020EF, 0x000DC,
+    0x020F0, 0x020F0, 0x000E6, 0x02CEF, 0x02CF1, 0x000E6, 0x02D7F, 0x02D7F, 0x00009,
+    0x02DE0, 0x02DFF, 0x000E6, 0x0302A, 0x0302A, 0x000DA, 0x0302B, 0x0302B, 0x000E4,
+    0x0302C, 0x0302C, 0x000E8, 0x0302D, 0x0302D, 0x000DE, 0x0302E, 0x0302F, 0x000E0,
+    0x03099, 0x0309A, 0x00008, 0x0A66F, 0x0A66F, 0x000E6, 0x0A674, 0x0A67D, 0x000E6,
+    0x0A69E, 0x0A69F, 0x000E6, 0x0A6F0, 0x0A6F1, 0x000E6, 0x0A806, 0x0A806, 0x00009,
+    0x0A82C, 0x0A82C, 0x00009, 0x0A8C4, 0x0A8C4, 0x00009, 0x0A8E0, 0x0A8F1, 0x000E6,
+    0x0A92B, 0x0A92D, 0x000DC, 0x0A953, 0x0A953, 0x00009, 0x0A9B3, 0x0A9B3, 0x00007,
+    0x0A9C0, 0x0A9C0, 0x00009, 0x0AAB0, 0x0AAB0, 0x000E6, 0x0AAB2, 0x0AAB3, 0x000E6,
+    0x0AAB4, 0x0AAB4, 0x000DC, 0x0AAB7, 0x0AAB8, 0x000E6, 0x0AABE, 0x0AABF, 0x000E6,
+    0x0AAC1, 0x0AAC1, 0x000E6, 0x0AAF6, 0x0AAF6, 0x00009, 0x0ABED, 0x0ABED, 0x00009,
+    0x0FB1E, 0x0FB1E, 0x0001A, 0x0FE20, 0x0FE26, 0x000E6, 0x0FE27, 0x0FE2D, 0x000DC,
+    0x0FE2E, 0x0FE2F, 0x000E6, 0x101FD, 0x101FD, 0x000DC, 0x102E0, 0x102E0, 0x000DC,
+    0x10376, 0x1037A, 0x000E6, 0x10A0D, 0x10A0D, 0x000DC, 0x10A0F, 0x10A0F, 0x000E6,
+    0x10A38, 0x10A38, 0x000E6, 0x10A39, 0x10A39, 0x00001, 0x10A3A, 0x10A3A, 0x000DC,
+    0x10A3F, 0x10A3F, 0x00009, 0x10AE5, 0x10AE5, 0x000E6, 0x10AE6, 0x10AE6, 0x000DC,
+    0x10D24, 0x10D27, 0x000E6, 0x10EAB, 0x10EAC, 0x000E6, 0x10F46, 0x10F47, 0x000DC,
+    0x10F48, 0x10F4A, 0x000E6, 0x10F4B, 0x10F4B, 0x000DC, 0x10F4C, 0x10F4C, 0x000E6,
+    0x10F4D, 0x10F50, 0x000DC, 0x10F82, 0x10F82, 0x000E6, 0x10F83, 0x10F83, 0x000DC,
+    0x10F84, 0x10F84, 0x000E6, 0x10F85, 0x10F85, 0x000DC, 0x11046, 0x11046, 0x00009,
+    0x11070, 0x11070, 0x00009, 0x1107F, 0x1107F, 0x00009, 0x110B9, 0x110B9, 0x00009,
+    0x110BA, 0x110BA, 0x00007, 0x11100, 0x11102, 0x000E6, 0x11133, 0x11134, 0x00009,
+    0x11173, 0x11173, 0x00007, 0x111C0, 0x111C0, 0x00009, 0x111CA, 0x111CA, 0x00007,
+    0x11235, 0x11235, 0x00009, 0x11236, 0x11236, 0x00007, 0x112E9, 0x112E9, 0x00007,
+    0x112EA, 0x112EA, 0x00009, 0x1133B, 0x1133C, 0x00007, 0x1134D, 0x1134D, 0x00009,
+    0x11366, 0x1136C, 0x000E6, 0x11370, 0x11374, 0x000E6, 0x11442, 0x11442, 0x00009,
+    0x11446, 0x11446, 0x00007, 0x1145E, 0x1145E, 0x000E6, 0x114C2, 0x114C2, 0x00009,
+    0x114C3, 0x114C3, 0x00007, 0x115BF, 0x115BF, 0x00009, 0x115C0, 0x115C0, 0x00007,
+    0x1163F, 0x1163F, 0x00009, 0x116B6, 0x116B6, 0x00009, 0x116B7, 0x116B7, 0x00007,
+    0x1172B, 0x1172B, 0x00009, 0x11839, 0x11839, 0x00009, 0x1183A, 0x1183A, 0x00007,
+    0x1193D, 0x1193E, 0x00009, 0x11943, 0x11943, 0x00007, 0x119E0, 0x119E0, 0x00009,
+    0x11A34, 0x11A34, 0x00009, 0x11A47, 0x11A47, 0x00009, 0x11A99, 0x11A99, 0x00009,
+    0x11C3F, 0x11C3F, 0x00009, 0x11D42, 0x11D42, 0x00007, 0x11D44, 0x11D45, 0x00009,
+    0x11D97, 0x11D97, 0x00009, 0x16AF0, 0x16AF4, 0x00001, 0x16B30, 0x16B36, 0x000E6,
+    0x16FF0, 0x16FF1, 0x00006, 0x1BC9E, 0x1BC9E, 0x00001, 0x1D165, 0x1D166, 0x000D8,
+    0x1D167, 0x1D169, 0x00001, 0x1D16D, 0x1D16D, 0x000E2, 0x1D16E, 0x1D172, 0x000D8,
+    0x1D17B, 0x1D182, 0x000DC, 0x1D185, 0x1D189, 0x000E6, 0x1D18A, 0x1D18B, 0x000DC,
+    0x1D1AA, 0x1D1AD, 0x000E6, 0x1D242, 0x1D244, 0x000E6, 0x1E000, 0x1E006, 0x000E6,
+    0x1E008, 0x1E018, 0x000E6, 0x1E01B, 0x1E021, 0x000E6, 0x1E023, 0x1E024, 0x000E6,
+    0x1E026, 0x1E02A, 0x000E6, 0x1E130, 0x1E136, 0x000E6, 0x1E2AE, 0x1E2AE, 0x000E6,
+    0x1E2EC, 0x1E2EF, 0x000E6, 0x1E8D0, 0x1E8D6, 0x000DC, 0x1E944, 0x1E949, 0x000E6,
+    0x1E94A, 0x1E94A, 0x00007,
+};